@@ -0,0 +1,540 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// El-bench
+// ========
+// Sweep the requested kernels over the given datatypes, problem sizes,
+// process grids, and algorithmic variants and write the results as JSON for
+// performance regression tracking. Each run is repeated 'warmup' times
+// (untimed) and then 'reps' times, where each repetition is timed as the
+// maximum over the processes. If requested, the communication volume is then
+// measured via the MPI traffic accounting in one more (untimed) repetition,
+// so that the accounting does not perturb the timings. The flop counts are
+// the usual nominal counts for square problems (with complex flops counted as
+// four real flops), except for sparse LDL, which uses the exact count of the
+// fronts.
+//
+// The input report and the progress are written to stderr so that stdout
+// only contains the JSON when no output file is given (builds with
+// EL_PROFILE also write their profile to stdout unless El::SetProfileOutput
+// is given a file).
+//
+// Example:
+//
+//   mpirun -np 4 El-bench --kernels Gemm,LU --sizes 1000,2000
+//     --types double,dcomplex --gridHeights 1,2 --output results.json
+
+namespace {
+
+struct BenchCtrl
+{
+    Int warmup, reps;
+    bool commVolume;
+    vector<string> kernels, variants;
+};
+
+template<typename... ArgPack>
+void Progress( mpi::Comm comm, const ArgPack& ... args )
+{
+    if( mpi::Rank(comm) == 0 )
+        cerr << BuildString( args... ) << endl;
+}
+
+vector<string> SplitList( const string& list )
+{
+    vector<string> items;
+    std::istringstream stream( list );
+    string item;
+    while( std::getline( stream, item, ',' ) )
+        if( !item.empty() )
+            items.push_back( item );
+    return items;
+}
+
+bool Selected( const vector<string>& list, const string& item )
+{
+    for( const auto& entry : list )
+        if( entry == "all" || entry == item )
+            return true;
+    return false;
+}
+
+string JSONString( const string& s )
+{
+    string escaped = "\"";
+    for( const char c : s )
+    {
+        if( c == '"' || c == '\\' )
+            escaped += '\\';
+        escaped += c;
+    }
+    return escaped + "\"";
+}
+
+struct Measurement
+{
+    // The (maximum over the processes of the) time of each repetition
+    vector<double> times;
+    // The number of bytes sent and received in one repetition (summed over
+    // the processes)
+    double bytesSent=0, bytesRecv=0;
+    string error;
+};
+
+// Time 'run' after each call to 'prepare' (which is not timed) and then
+// measure the communication volume of one more call
+Measurement Measure
+( const BenchCtrl& ctrl, mpi::Comm comm,
+  const function<void()>& prepare, const function<void()>& run )
+{
+    Measurement measurement;
+    try
+    {
+        for( Int rep=0; rep<ctrl.warmup; ++rep )
+        {
+            prepare();
+            run();
+        }
+
+        Timer timer;
+        mpi::SetTrafficAccounting( false );
+        for( Int rep=0; rep<ctrl.reps; ++rep )
+        {
+            prepare();
+            mpi::Barrier( comm );
+            timer.Start();
+            run();
+            const double localTime = timer.Stop();
+            measurement.times.push_back
+            ( mpi::AllReduce( localTime, mpi::MAX, comm ) );
+        }
+
+        if( ctrl.commVolume )
+        {
+            prepare();
+            mpi::ClearTraffic();
+            mpi::SetTrafficAccounting( true );
+            run();
+            mpi::SetTrafficAccounting( false );
+            long long localSent=0, localRecv=0;
+            for( const auto& entry : mpi::TrafficSummary() )
+            {
+                localSent += entry.stats.bytesSent;
+                localRecv += entry.stats.bytesRecv;
+            }
+            measurement.bytesSent = mpi::AllReduce( double(localSent), comm );
+            measurement.bytesRecv = mpi::AllReduce( double(localRecv), comm );
+        }
+    }
+    catch( std::exception& e )
+    {
+        mpi::SetTrafficAccounting( false );
+        measurement.error = e.what();
+    }
+    return measurement;
+}
+
+string Record
+( const string& kernel, const string& variant, const string& type, Int n,
+  const string& layout, double flops, const Measurement& measurement )
+{
+    std::ostringstream os;
+    os.precision( 10 );
+    os << "{\"kernel\": " << JSONString(kernel)
+       << ", \"variant\": " << JSONString(variant)
+       << ", \"type\": " << JSONString(type)
+       << ", \"n\": " << n << ", " << layout;
+    if( !measurement.error.empty() )
+    {
+        os << ", \"error\": " << JSONString(measurement.error) << "}";
+        return os.str();
+    }
+
+    vector<double> times( measurement.times );
+    std::sort( times.begin(), times.end() );
+    const Int reps = times.size();
+    double mean=0, stddev=0, median=0;
+    if( reps > 0 )
+    {
+        for( const double time : times )
+            mean += time;
+        mean /= reps;
+        for( const double time : times )
+            stddev += (time-mean)*(time-mean);
+        stddev = ( reps > 1 ? Sqrt(stddev/(reps-1)) : 0 );
+        median = ( reps % 2 == 1 ? times[reps/2]
+                                 : (times[reps/2-1]+times[reps/2])/2 );
+    }
+    os << ", \"flops\": " << flops
+       << ", \"time\": {\"min\": " << (reps>0 ? times.front() : 0)
+       << ", \"median\": " << median << ", \"mean\": " << mean
+       << ", \"max\": " << (reps>0 ? times.back() : 0)
+       << ", \"stddev\": " << stddev << "}"
+       << ", \"gflops\": {\"median\": " << (median>0 ? flops/median/1e9 : 0)
+       << ", \"best\": "
+       << (reps>0 && times.front()>0 ? flops/times.front()/1e9 : 0) << "}"
+       << ", \"bytesSent\": " << measurement.bytesSent
+       << ", \"bytesRecv\": " << measurement.bytesRecv << "}";
+    return os.str();
+}
+
+template<typename F>
+void DenseBenchmarks
+( const BenchCtrl& ctrl, const Grid& g, Int n, vector<string>& records )
+{
+    typedef Base<F> Real;
+    const mpi::Comm comm = g.ViewingComm();
+    const string type = TypeName<F>();
+    const double scale = ( IsComplex<F>::value ? 4 : 1 );
+    const double cube = double(n)*n*n;
+    const string layout =
+      "\"grid\": [" + std::to_string(g.Height()) + ", " +
+      std::to_string(g.Width()) + "]";
+    auto none = [](){};
+
+    auto bench =
+      [&]( const string& kernel, const string& variant, double flops,
+           const function<void()>& prepare, const function<void()>& run )
+      {
+          if( !Selected(ctrl.variants,variant) )
+              return;
+          const Measurement measurement = Measure( ctrl, comm, prepare, run );
+          if( g.ViewingRank() == 0 )
+              records.push_back
+              ( Record(kernel,variant,type,n,layout,scale*flops,measurement) );
+      };
+
+    if( Selected(ctrl.kernels,"Gemm") )
+    {
+        DistMatrix<F> A(g), B(g), C(g);
+        Uniform( A, n, n );
+        Uniform( B, n, n );
+        Zeros( C, n, n );
+        const std::pair<GemmAlgorithm,string> algs[] =
+          { {GEMM_DEFAULT,"default"}, {GEMM_SUMMA_A,"SUMMA_A"},
+            {GEMM_SUMMA_B,"SUMMA_B"}, {GEMM_SUMMA_C,"SUMMA_C"},
+            {GEMM_SUMMA_DOT,"SUMMA_DOT"}, {GEMM_CANNON,"Cannon"},
+            {GEMM_SUMMA_C_PIPELINED,"SUMMA_C_pipelined"}, {GEMM_25D,"2.5D"} };
+        for( const auto& alg : algs )
+            bench
+            ( "Gemm", alg.second, 2*cube, none,
+              [&]()
+              { Gemm( NORMAL, NORMAL, F(1), A, B, F(0), C, alg.first ); } );
+    }
+
+    if( Selected(ctrl.kernels,"Trsm") )
+    {
+        DistMatrix<F> A(g), B(g), X(g);
+        Uniform( A, n, n );
+        ShiftDiagonal( A, F(n) );
+        Uniform( B, n, n );
+        const std::pair<TrsmAlgorithm,string> algs[] =
+          { {TRSM_DEFAULT,"default"}, {TRSM_LARGE,"large"},
+            {TRSM_MEDIUM,"medium"}, {TRSM_SMALL,"small"} };
+        for( const auto& alg : algs )
+            bench
+            ( "Trsm", alg.second, cube, [&]() { X = B; },
+              [&]()
+              { Trsm( LEFT, LOWER, NORMAL, NON_UNIT, F(1), A, X, false,
+                      alg.first ); } );
+    }
+
+    const std::pair<UpperOrLower,string> uplos[] =
+      { {LOWER,"lower"}, {UPPER,"upper"} };
+    if( Selected(ctrl.kernels,"Herk") )
+    {
+        DistMatrix<F> A(g), C(g);
+        Uniform( A, n, n );
+        Zeros( C, n, n );
+        for( const auto& uplo : uplos )
+            bench
+            ( "Herk", uplo.second, cube, none,
+              [&]() { Herk( uplo.first, NORMAL, Real(1), A, Real(0), C ); } );
+    }
+
+    if( Selected(ctrl.kernels,"Cholesky") )
+    {
+        DistMatrix<F> AOrig(g), A(g);
+        HermitianUniformSpectrum( AOrig, n, 1, 10 );
+        for( const auto& uplo : uplos )
+            bench
+            ( "Cholesky", uplo.second, cube/3, [&]() { A = AOrig; },
+              [&]() { Cholesky( uplo.first, A ); } );
+    }
+
+    if( Selected(ctrl.kernels,"LU") )
+    {
+        DistMatrix<F> AOrig(g), A(g);
+        DistPermutation P(g), Q(g);
+        Uniform( AOrig, n, n );
+        auto prepare = [&]() { A = AOrig; };
+        bench
+        ( "LU", "partial", 2*cube/3, prepare, [&]() { LU( A, P ); } );
+        bench
+        ( "LU", "full", 2*cube/3, prepare, [&]() { LU( A, P, Q ); } );
+        bench
+        ( "LU", "none", 2*cube/3, prepare, [&]() { LU( A ); } );
+    }
+
+    if( Selected(ctrl.kernels,"QR") )
+    {
+        DistMatrix<F> AOrig(g), A(g);
+        DistMatrix<F,MD,STAR> householderScalars(g);
+        DistMatrix<Real,MD,STAR> signature(g);
+        Uniform( AOrig, n, n );
+        bench
+        ( "QR", "householder", 4*cube/3, [&]() { A = AOrig; },
+          [&]() { QR( A, householderScalars, signature ); } );
+    }
+
+    if( Selected(ctrl.kernels,"HermitianEig") )
+    {
+        DistMatrix<F> AOrig(g), A(g), Q(g);
+        DistMatrix<Real,VR,STAR> w(g);
+        HermitianUniformSpectrum( AOrig, n, -10, 10 );
+        auto prepare = [&]() { A = AOrig; };
+        bench
+        ( "HermitianEig", "values", 4*cube/3, prepare,
+          [&]() { HermitianEig( LOWER, A, w ); } );
+        bench
+        ( "HermitianEig", "vectors", 10*cube/3, prepare,
+          [&]() { HermitianEig( LOWER, A, w, Q ); } );
+    }
+
+    if( Selected(ctrl.kernels,"SVD") )
+    {
+        DistMatrix<F> AOrig(g), A(g), U(g), V(g);
+        DistMatrix<Real,VR,STAR> s(g);
+        Uniform( AOrig, n, n );
+        bench
+        ( "SVD", "values", 8*cube/3, [&]() { A = AOrig; },
+          [&]() { SVD( A, s ); } );
+        bench
+        ( "SVD", "vectors", 20*cube/3, none,
+          [&]() { SVD( AOrig, U, s, V ); } );
+    }
+}
+
+// The sparse kernels use the negative of the 3D Laplacian over a
+// k x k x k grid (and ignore the process grid)
+template<typename F>
+void SparseBenchmarks
+( const BenchCtrl& ctrl, Int k, Int numRHS, mpi::Comm comm,
+  vector<string>& records )
+{
+    const string type = TypeName<F>();
+    const double scale = ( IsComplex<F>::value ? 4 : 1 );
+    const string layout =
+      "\"processes\": " + std::to_string(mpi::Size(comm));
+    const Int n = k*k*k;
+
+    DistSparseMatrix<F> A(comm);
+    Laplacian( A, k, k, k );
+    A *= -F(1);
+
+    if( Selected(ctrl.kernels,"SparseMultiply") &&
+        Selected(ctrl.variants,"normal") )
+    {
+        DistMultiVec<F> X(n,numRHS,comm), Y(n,numRHS,comm);
+        MakeUniform( X );
+        const double flops = 2.*A.NumEntries()*numRHS;
+        const Measurement measurement =
+          Measure
+          ( ctrl, comm, [](){},
+            [&]() { Multiply( NORMAL, F(1), A, X, F(0), Y ); } );
+        if( mpi::Rank(comm) == 0 )
+            records.push_back
+            ( Record
+              ("SparseMultiply","normal",type,n,layout,scale*flops,
+               measurement) );
+    }
+
+    if( Selected(ctrl.kernels,"SparseLDL") )
+    {
+        ldl::DistNodeInfo info;
+        ldl::DistSeparator sep;
+        DistMap map;
+        ldl::NestedDissection( A.DistGraph(), map, sep, info );
+        ldl::DistFront<F> front;
+
+        const std::pair<LDLFrontType,string> types[] =
+          { {LDL_1D,"1d"}, {LDL_2D,"2d"}, {LDL_SELINV_2D,"selinv2d"} };
+        for( const auto& frontType : types )
+        {
+            if( !Selected(ctrl.variants,frontType.second) )
+                continue;
+            const Measurement measurement =
+              Measure
+              ( ctrl, comm, [&]() { front.Pull( A, map, sep, info ); },
+                [&]() { LDL( info, front, frontType.first ); } );
+            const bool selInv = ( frontType.first == LDL_SELINV_2D );
+            double flops = 0;
+            if( measurement.error.empty() )
+                flops =
+                  1e9*mpi::AllReduce( front.LocalFactorGFlops(selInv), comm );
+            if( mpi::Rank(comm) == 0 )
+                records.push_back
+                ( Record
+                  ("SparseLDL",frontType.second,type,n,layout,flops,
+                   measurement) );
+        }
+    }
+}
+
+template<typename F>
+void Benchmarks
+( const BenchCtrl& ctrl,
+  const vector<Int>& sizes,
+  const vector<Int>& gridHeights,
+  const vector<Int>& sparseSizes,
+  Int numRHS,
+  vector<string>& records )
+{
+    const mpi::Comm comm = mpi::COMM_WORLD;
+    const int commSize = mpi::Size( comm );
+    for( Int gridHeight : gridHeights )
+    {
+        if( gridHeight == 0 )
+            gridHeight = Grid::FindFactor( commSize );
+        if( commSize % gridHeight != 0 )
+        {
+            Progress
+            (comm,"Skipping grid height ",gridHeight," since it does not "
+             "divide the number of processes");
+            continue;
+        }
+        const Grid g( comm, gridHeight );
+        for( const Int n : sizes )
+        {
+            Progress
+            (comm,TypeName<F>()," with n=",n," on a ",g.Height()," x ",
+             g.Width()," grid");
+            DenseBenchmarks<F>( ctrl, g, n, records );
+        }
+    }
+    for( const Int k : sparseSizes )
+    {
+        Progress(comm,TypeName<F>()," with a ",k,"^3 Laplacian");
+        SparseBenchmarks<F>( ctrl, k, numRHS, comm, records );
+    }
+}
+
+vector<Int> IntList( const string& list )
+{
+    vector<Int> values;
+    for( const auto& item : SplitList(list) )
+        values.push_back( std::stoll(item) );
+    return values;
+}
+
+} // anonymous namespace
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    const mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::Rank( comm );
+
+    try
+    {
+        const string kernels =
+          Input("--kernels","comma-separated kernels (or all): Gemm, Trsm, "
+                "Herk, Cholesky, LU, QR, HermitianEig, SVD, SparseMultiply, "
+                "SparseLDL",string("all"));
+        const string variants =
+          Input("--variants","comma-separated algorithmic variants (or all)",
+                string("all"));
+        const string types =
+          Input("--types","comma-separated datatypes: float, double, "
+                "scomplex, dcomplex",string("double"));
+        const string sizes =
+          Input("--sizes","comma-separated dense problem sizes",
+                string("1000"));
+        const string gridHeights =
+          Input("--gridHeights","comma-separated process grid heights "
+                "(0 for square)",string("0"));
+        const string sparseSizes =
+          Input("--sparseSizes","comma-separated dimensions of the 3D "
+                "Laplacians",string("20"));
+        const Int numRHS =
+          Input("--numRHS","number of vectors for SparseMultiply",Int(1));
+        const Int nb = Input("--nb","algorithmic blocksize",Int(96));
+        const Int warmup = Input("--warmup","untimed repetitions",Int(1));
+        const Int reps = Input("--reps","timed repetitions",Int(3));
+        const bool commVolume =
+          Input("--commVolume","measure the communication volume?",true);
+        const string output =
+          Input("--output","JSON output file (empty for stdout)",string(""));
+        ProcessInput();
+        GetArgs().PrintReport( cerr );
+
+        SetBlocksize( nb );
+        BenchCtrl ctrl;
+        ctrl.warmup = warmup;
+        ctrl.reps = reps;
+        ctrl.commVolume = commVolume;
+        ctrl.kernels = SplitList( kernels );
+        ctrl.variants = SplitList( variants );
+        const vector<Int> sizeList = IntList( sizes );
+        const vector<Int> gridHeightList = IntList( gridHeights );
+        const vector<Int> sparseSizeList = IntList( sparseSizes );
+
+        vector<string> records;
+        for( const auto& type : SplitList(types) )
+        {
+            if( type == "float" )
+                Benchmarks<float>
+                ( ctrl, sizeList, gridHeightList, sparseSizeList, numRHS,
+                  records );
+            else if( type == "double" )
+                Benchmarks<double>
+                ( ctrl, sizeList, gridHeightList, sparseSizeList, numRHS,
+                  records );
+            else if( type == "scomplex" )
+                Benchmarks<Complex<float>>
+                ( ctrl, sizeList, gridHeightList, sparseSizeList, numRHS,
+                  records );
+            else if( type == "dcomplex" )
+                Benchmarks<Complex<double>>
+                ( ctrl, sizeList, gridHeightList, sparseSizeList, numRHS,
+                  records );
+            else
+                LogicError("Unsupported datatype: ",type);
+        }
+
+        if( commRank == 0 )
+        {
+            std::ofstream file;
+            if( !output.empty() )
+            {
+                file.open( output.c_str() );
+                if( !file.is_open() )
+                    RuntimeError("Could not open ",output);
+            }
+            ostream& os = ( output.empty() ? cout : file );
+            os << "{\n  \"benchmark\": \"El-bench\",\n"
+               << "  \"version\": \"" << EL_VERSION_MAJOR << "."
+               << EL_VERSION_MINOR << "\",\n"
+               << "  \"commit\": \"" << EL_GIT_SHA1 << "\",\n"
+               << "  \"processes\": " << mpi::Size(comm) << ",\n"
+               << "  \"blocksize\": " << nb << ",\n"
+               << "  \"warmup\": " << warmup << ",\n"
+               << "  \"repetitions\": " << reps << ",\n"
+               << "  \"results\": [";
+            for( Int k=0; k<Int(records.size()); ++k )
+                os << ( k == 0 ? "\n    " : ",\n    " ) << records[k];
+            os << "\n  ]\n}" << endl;
+        }
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
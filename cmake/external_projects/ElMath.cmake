@@ -434,6 +434,35 @@ if(NOT EL_DISABLE_QD)
     list(APPEND MATH_LIBS_AT_CONFIG ${QD_LIBRARIES})
     message(STATUS "Including ${QD_INCLUDES} to add support for QD")
     include_directories(${QD_INCLUDES})
+
+    # The vectorized double-double kernels are compiled with ISA-specific
+    # flags and without floating-point contraction (which would break their
+    # error-free transformations); they are selected at runtime
+    set(EL_QD_AVX2_FLAGS "-mavx2 -mfma -ffp-contract=off")
+    set(EL_QD_AVX512_FLAGS "-mavx512f -mfma -ffp-contract=off")
+    set(CMAKE_REQUIRED_FLAGS "${EL_QD_AVX2_FLAGS}")
+    set(QD_AVX2_CODE
+      "#include <immintrin.h>
+       int main( int argc, char* argv[] )
+       {
+           __m256d a = _mm256_set1_pd(1.), b = _mm256_set1_pd(2.);
+           __m256d c = _mm256_fmadd_pd(a,b,a);
+           __builtin_cpu_init();
+           return __builtin_cpu_supports(\"avx2\") ? int(c[0]) : 0;
+       }")
+    check_cxx_source_compiles("${QD_AVX2_CODE}" EL_HAVE_QD_AVX2)
+    set(CMAKE_REQUIRED_FLAGS "${EL_QD_AVX512_FLAGS}")
+    set(QD_AVX512_CODE
+      "#include <immintrin.h>
+       int main( int argc, char* argv[] )
+       {
+           __m512d a = _mm512_set1_pd(1.), b = _mm512_set1_pd(2.);
+           __m512d c = _mm512_abs_pd(_mm512_fmadd_pd(a,b,a));
+           __builtin_cpu_init();
+           return __builtin_cpu_supports(\"avx512f\") ? int(c[0]) : 0;
+       }")
+    check_cxx_source_compiles("${QD_AVX512_CODE}" EL_HAVE_QD_AVX512)
+    unset(CMAKE_REQUIRED_FLAGS)
   endif()
 endif()
 
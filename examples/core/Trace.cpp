@@ -0,0 +1,65 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Trace a distributed Gemm and LU factorization (the library regions are only
+// recorded if Elemental was configured with EL_PROFILE) and merge the
+// per-process traces into a Chrome trace. With '--mergeOnly', the existing
+// per-process traces with the given basename are merged instead.
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    const mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+
+    try
+    {
+        const Int n = Input("--n","matrix size",500);
+        const Int nb = Input("--nb","algorithmic blocksize",96);
+        const string basename =
+          Input("--basename","basename of the per-process traces",
+                string("trace"));
+        const string output =
+          Input("--output","filename of the merged trace",string("trace.json"));
+        const bool mergeOnly =
+          Input("--mergeOnly","only merge existing traces?",false);
+        const int numProcesses =
+          Input("--numProcesses","number of traces to merge",commSize);
+        ProcessInput();
+        PrintInputReport();
+
+        if( !mergeOnly )
+        {
+            SetBlocksize( nb );
+            const Grid g( comm );
+            DistMatrix<double> A(g), B(g), C(g);
+            Uniform( A, n, n );
+            Uniform( B, n, n );
+            Zeros( C, n, n );
+
+            StartTracing( comm );
+            Gemm( NORMAL, NORMAL, 1., A, B, 0., C );
+            LU( C );
+            StopTracing();
+
+            WriteTrace( basename, comm );
+            mpi::Barrier( comm );
+        }
+        if( commRank == 0 )
+        {
+            MergeTraces( basename, numProcesses, output );
+            Output("Wrote ",output);
+        }
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -38,7 +38,16 @@ void Axpy( S alphaS, const Matrix<T>& X, Matrix<T>& Y )
           if( XLength != YLength )
               LogicError("Nonconformal Axpy");
         )
-        blas::Axpy( XLength, alpha, XBuf, XStride, YBuf, YStride );
+        const Int numChunks = NumParallelChunks<T>( XLength );
+        EL_PARALLEL_FOR_IF(numChunks > 1)
+        for( Int chunk=0; chunk<numChunks; ++chunk )
+        {
+            const Int start = (chunk*XLength) / numChunks;
+            const Int end = ((chunk+1)*XLength) / numChunks;
+            blas::Axpy
+            ( end-start, alpha,
+              &XBuf[start*XStride], XStride, &YBuf[start*YStride], YStride );
+        }
     }
     else
     {
@@ -48,11 +57,17 @@ void Axpy( S alphaS, const Matrix<T>& X, Matrix<T>& Y )
               LogicError("Nonconformal Axpy");
         )
         if( nX <= mX )
+        {
+            EL_PARALLEL_FOR_IF(ParallelizeWork<T>(mX*nX))
             for( Int j=0; j<nX; ++j )
                 blas::Axpy( mX, alpha, &XBuf[j*ldX], 1, &YBuf[j*ldY], 1 );
+        }
         else
+        {
+            EL_PARALLEL_FOR_IF(ParallelizeWork<T>(mX*nX))
             for( Int i=0; i<mX; ++i )
                 blas::Axpy( nX, alpha, &XBuf[i], ldX, &YBuf[i], ldY );
+        }
     }
 }
 
@@ -11,6 +11,7 @@
 
 #include <El/blas_like/level1/Copy/internal_decl.hpp>
 #include <El/blas_like/level1/Copy/GeneralPurpose.hpp>
+#include <El/blas_like/level1/Copy/RedistPlan.hpp>
 #include <El/blas_like/level1/Copy/util.hpp>
 
 namespace El {
@@ -39,6 +40,7 @@ template<typename T,Dist U,Dist V>
 void Copy( const ElementalMatrix<T>& A, DistMatrix<T,U,V>& B )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("Copy")
     B = A;
 }
 
@@ -48,6 +50,7 @@ template<typename S,typename T,Dist U,Dist V>
 void Copy( const ElementalMatrix<S>& A, DistMatrix<T,U,V>& B )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("Copy")
     if( A.Grid() == B.Grid() && A.ColDist() == U && A.RowDist() == V )
     {
         if( !B.RootConstrained() )
@@ -18,11 +18,14 @@ void AllGather
         DistMatrix<T,Collect<U>(),Collect<V>()>& B ) 
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("copy::AllGather")
     AssertSameGrids( A, B );
 
     const Int height = A.Height();
     const Int width = A.Width();
     B.SetGrid( A.Grid() );
+    if( AllGatherShared( A, B ) )
+        return;
     B.Resize( height, width );
 
     if( A.Participating() )
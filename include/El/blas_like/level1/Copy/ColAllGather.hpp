@@ -17,6 +17,7 @@ template<typename T>
 void ColAllGather( const ElementalMatrix<T>& A, ElementalMatrix<T>& B ) 
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("copy::ColAllGather")
     DEBUG_ONLY(
       if( B.ColDist() != Collect(A.ColDist()) ||
           B.RowDist() != A.RowDist() )
@@ -34,6 +35,8 @@ void ColAllGather( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
           "performing the redistribution with a (conjugate)-transpose"
           << endl;
 #endif
+    if( ColAllGatherShared( A, B ) )
+        return;
     B.AlignRowsAndResize( A.RowAlign(), height, width, false, false );
 
     if( A.Participating() )
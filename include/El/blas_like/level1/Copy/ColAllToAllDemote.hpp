@@ -18,6 +18,7 @@ void ColAllToAllDemote
         DistMatrix<T,        U,                     V   >& B )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("copy::ColAllToAllDemote")
     AssertSameGrids( A, B );
 
     const Int height = A.Height();
@@ -18,6 +18,7 @@ void ColAllToAllPromote
         DistMatrix<T,Partial<U>(),PartialUnionRow<U,V>()>& B )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("copy::ColAllToAllPromote")
     AssertSameGrids( A, B );
 
     const Int height = A.Height();
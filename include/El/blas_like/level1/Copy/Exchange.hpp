@@ -19,6 +19,7 @@ void Exchange
   int sendRank, int recvRank, mpi::Comm comm )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("copy::Exchange")
     DEBUG_ONLY(AssertSameGrids( A, B ))
     const int myRank = mpi::Rank( comm );
     DEBUG_ONLY(
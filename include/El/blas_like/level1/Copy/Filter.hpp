@@ -18,6 +18,7 @@ void Filter
         DistMatrix<T,        U,           V   >& B )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("copy::Filter")
     AssertSameGrids( A, B );
 
     B.Resize( A.Height(), A.Width() );
@@ -12,148 +12,186 @@
 namespace El {
 namespace copy {
 
+// Entries are transmitted in the smaller of the source and target types
+// (preferring the source type), unless only one of them is packed
+template<typename S,typename T>
+struct TransmitType
+{
+    static const bool useTarget =
+      IsPacked<T>::value &&
+      (!IsPacked<S>::value || sizeof(T) < sizeof(S));
+    typedef typename std::conditional<useTarget,T,S>::type type;
+};
+
+// Redistribute blocks of columns at a time so that the send and receive
+// buffers fit within RedistMemoryLimit() (if it is nonzero).
+//
+// Only the values are transmitted: the sender and the receiver of each entry
+// both enumerate the entries they have in common in column-major order, so
+// that the receiver can derive the local index of each value from the rank
+// which sent it.
 template<typename S,typename T,typename=EnableIf<CanCast<S,T>>>
 void Helper
 ( const AbstractDistMatrix<S>& A,
         AbstractDistMatrix<T>& B ) 
 {
     DEBUG_CSE
-
-    // TODO: Decide whether S or T should be used as the transmission type
-    //       based upon which is smaller. Transmit S by default.
+    typedef typename TransmitType<S,T>::type X;
     const Int height = A.Height();
     const Int width = A.Width();
+    const Grid& gA = A.Grid();
     const Grid& g = B.Grid();
-    const Dist colDist=B.ColDist(), rowDist=B.RowDist();
-    const int root = B.Root();
     B.Resize( height, width );
-    const bool BPartic = B.Participating();
 
-    const bool includeViewers = (A.Grid() != B.Grid());
+    const bool includeViewers = (gA != g);
+    mpi::Comm comm;
+    if( includeViewers )
+        comm = g.ViewingComm();
+    else if( g.InGrid() )
+        comm = g.VCComm();
+    else
+        return;
+    const int commSize = mpi::Size( comm );
+
+    // The ranks in 'comm' of the processes which send the entries of each
+    // distribution rank of A and which receive those of each distribution
+    // rank of B
+    const int colStrideA = A.ColStride();
+    const int colStrideB = B.ColStride();
+    vector<int> distMapA(colStrideA*A.RowStride()),
+                distMapB(colStrideB*B.RowStride());
+    for( size_t q=0; q<distMapA.size(); ++q )
+    {
+        const int vcOwner = gA.CoordsToVC(A.ColDist(),A.RowDist(),q,A.Root());
+        distMapA[q] = ( includeViewers ? gA.VCToViewing(vcOwner) : vcOwner );
+    }
+    for( size_t q=0; q<distMapB.size(); ++q )
+    {
+        const int vcOwner = g.CoordsToVC(B.ColDist(),B.RowDist(),q,B.Root());
+        distMapB[q] = ( includeViewers ? g.VCToViewing(vcOwner) : vcOwner );
+    }
+
+    // Only the first redundant copy of A sends its entries, and only the
+    // first redundant copy of B receives them
+    const bool sending = ( A.Participating() && A.RedundantRank() == 0 );
+    const bool receiving = ( B.Participating() && B.RedundantRank() == 0 );
+    const Int localHeightA = ( sending ? A.LocalHeight() : 0 );
+    const Int localHeightB = ( receiving ? B.LocalHeight() : 0 );
+    vector<int> sendRowOwners(localHeightA), recvRowOwners(localHeightB);
+    for( Int iLoc=0; iLoc<localHeightA; ++iLoc )
+        sendRowOwners[iLoc] = B.RowOwner(A.GlobalRow(iLoc));
+    for( Int iLoc=0; iLoc<localHeightB; ++iLoc )
+        recvRowOwners[iLoc] = A.RowOwner(B.GlobalRow(iLoc));
+
+    Int blockWidth = width;
+    const size_t memoryLimit = RedistMemoryLimit();
+    if( memoryLimit > 0 && width > 0 )
+    {
+        const double bytesPerCol =
+          sizeof(X)*(double(localHeightA)/A.RowStride() +
+                     double(localHeightB)/B.RowStride());
+        Int localBlockWidth = width;
+        if( bytesPerCol > 0 )
+            localBlockWidth =
+              Max( Int(Min(double(memoryLimit)/bytesPerCol,double(width))),
+                   Int(1) );
+        blockWidth = mpi::AllReduce( localBlockWidth, mpi::MIN, comm );
+    }
 
-    const Int localHeight = A.LocalHeight();
-    const Int localWidth = A.LocalWidth();
     auto& ALoc = A.LockedMatrix();
     auto& BLoc = B.Matrix();
-
-    // TODO: Break into smaller pieces to avoid excessive memory usage?
-    vector<Entry<S>> remoteEntries;
-    vector<int> distOwners;
-    if( A.RedundantRank() == 0 )
+    vector<int> sendCounts, sendOffs, recvCounts, recvOffs, offs;
+    vector<X> sendBuf, recvBuf;
+    for( Int jStart=0; jStart<width; jStart+=blockWidth )
     {
-        const bool noRedundant = B.RedundantSize() == 1;
-        const int colStride = B.ColStride();
-        const int rowRank = B.RowRank();
-        const int colRank = B.ColRank();
-
-        vector<Int> globalRows(localHeight), localRows(localHeight);
-        vector<int> ownerRows(localHeight);
-        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        const Int jEnd = Min( jStart+blockWidth, width );
+        Int jLocStartA=0, jLocEndA=0, jLocStartB=0, jLocEndB=0;
+        if( sending )
         {
-            const Int i = A.GlobalRow(iLoc);
-            const int ownerRow = B.RowOwner(i);
-            globalRows[iLoc] = i;
-            ownerRows[iLoc] = ownerRow;
-            localRows[iLoc] = B.LocalRow(i,ownerRow);
+            jLocStartA = A.LocalColOffset(jStart);
+            jLocEndA = A.LocalColOffset(jEnd);
+        }
+        if( B.Participating() )
+        {
+            jLocStartB = B.LocalColOffset(jStart);
+            jLocEndB = B.LocalColOffset(jEnd);
         }
 
-        remoteEntries.reserve( localHeight*localWidth );
-        distOwners.reserve( localHeight*localWidth );
-        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        // Count and pack the entries to send
+        // ==================================
+        sendCounts.assign( commSize, 0 );
+        for( Int jLoc=jLocStartA; jLoc<jLocEndA; ++jLoc )
+        {
+            const int colOffset = colStrideB*B.ColOwner(A.GlobalCol(jLoc));
+            for( Int iLoc=0; iLoc<localHeightA; ++iLoc )
+                ++sendCounts[distMapB[sendRowOwners[iLoc]+colOffset]];
+        }
+        const Int totalSend = Scan( sendCounts, sendOffs );
+        FastResize( sendBuf, totalSend );
+        offs = sendOffs;
+        for( Int jLoc=jLocStartA; jLoc<jLocEndA; ++jLoc )
         {
-            const Int j = A.GlobalCol(jLoc);
-            const int ownerCol = B.ColOwner(j);
-            const Int localCol = B.LocalCol(j,ownerCol);
-            const bool isLocalCol = ( BPartic && ownerCol == rowRank );
-            for( Int iLoc=0; iLoc<localHeight; ++iLoc ) 
+            const int colOffset = colStrideB*B.ColOwner(A.GlobalCol(jLoc));
+            for( Int iLoc=0; iLoc<localHeightA; ++iLoc )
             {
-                const int ownerRow = ownerRows[iLoc];
-                const Int localRow = localRows[iLoc];
-                const bool isLocalRow = ( BPartic && ownerRow == colRank );
-                const S& alpha = ALoc(iLoc,jLoc);
-                if( noRedundant && isLocalRow && isLocalCol )
-                {
-                    BLoc(localRow,localCol) = Caster<S,T>::Cast(alpha);
-                }
-                else
-                {
-                    remoteEntries.push_back
-                    ( Entry<S>{localRow,localCol,alpha} );
-                    distOwners.push_back( ownerRow + colStride*ownerCol );
-                }
+                const int owner = distMapB[sendRowOwners[iLoc]+colOffset];
+                sendBuf[offs[owner]++] = Caster<S,X>::Cast(ALoc(iLoc,jLoc));
             }
-        }    
-    }
-
-    // Compute the metadata
-    // ====================
-    const Int totalSend = remoteEntries.size();
-    mpi::Comm comm;
-    vector<int> sendCounts, owners(totalSend);
-    if( includeViewers )
-    {
-        comm = g.ViewingComm();
-        const int commSize = mpi::Size( comm );
-
-        vector<int> distMap(commSize);
-        for( int q=0; q<commSize; ++q )
-        {
-            const int vcOwner = g.CoordsToVC(colDist,rowDist,q,root);
-            distMap[q] = g.VCToViewing(vcOwner);
         }
 
-        sendCounts.resize(commSize,0);
-        for( Int k=0; k<totalSend; ++k )
+        // Count the entries to receive
+        // ============================
+        recvCounts.assign( commSize, 0 );
+        if( receiving )
         {
-            owners[k] = distMap[distOwners[k]];
-            ++sendCounts[owners[k]];
+            for( Int jLoc=jLocStartB; jLoc<jLocEndB; ++jLoc )
+            {
+                const int colOffset =
+                  colStrideA*A.ColOwner(B.GlobalCol(jLoc));
+                for( Int iLoc=0; iLoc<localHeightB; ++iLoc )
+                    ++recvCounts[distMapA[recvRowOwners[iLoc]+colOffset]];
+            }
         }
-    }
-    else
-    {
-        if( !g.InGrid() )
-            return;
-        comm = g.VCComm();
-        const int commSize = mpi::Size( comm );
+        const Int totalRecv = Scan( recvCounts, recvOffs );
+        FastResize( recvBuf, totalRecv );
 
-        vector<int> distMap(commSize);
-        for( int q=0; q<commSize; ++q )
-            distMap[q] = g.CoordsToVC(colDist,rowDist,q,root);
-
-        sendCounts.resize(commSize,0);
-        for( Int k=0; k<totalSend; ++k )
+        // Exchange and unpack the data
+        // ============================
+        mpi::AllToAll
+        ( sendBuf.data(), sendCounts.data(), sendOffs.data(),
+          recvBuf.data(), recvCounts.data(), recvOffs.data(), comm );
+        if( receiving )
         {
-            owners[k] = distMap[distOwners[k]];
-            ++sendCounts[owners[k]];
+            offs = recvOffs;
+            for( Int jLoc=jLocStartB; jLoc<jLocEndB; ++jLoc )
+            {
+                const int colOffset =
+                  colStrideA*A.ColOwner(B.GlobalCol(jLoc));
+                for( Int iLoc=0; iLoc<localHeightB; ++iLoc )
+                {
+                    const int owner =
+                      distMapA[recvRowOwners[iLoc]+colOffset];
+                    BLoc(iLoc,jLoc) =
+                      Caster<X,T>::Cast(recvBuf[offs[owner]++]);
+                }
+            }
         }
-    }
-    SwapClear( distOwners );
-
-    // Pack the data
-    // =============
-    vector<int> sendOffs;
-    Scan( sendCounts, sendOffs );
-    vector<Entry<S>> sendBuf;
-    FastResize( sendBuf, totalSend );
-    auto offs = sendOffs;
-    for( Int k=0; k<totalSend; ++k )
-        sendBuf[offs[owners[k]]++] = remoteEntries[k];
-    SwapClear( remoteEntries );
-    SwapClear( owners );
-
-    // Exchange and unpack the data
-    // ============================
-    auto recvBuf = mpi::AllToAll( sendBuf, sendCounts, sendOffs, comm );
-    if( B.Participating() )
-    {
-        Int recvBufSize = recvBuf.size();
-        mpi::Broadcast( recvBufSize, 0, B.RedundantComm() );
-        FastResize( recvBuf, recvBufSize );
-        mpi::Broadcast( recvBuf.data(), recvBufSize, 0, B.RedundantComm() );
-        for( Int k=0; k<recvBufSize; ++k )
+        if( B.Participating() && B.RedundantSize() > 1 &&
+            jLocEndB > jLocStartB )
         {
-            const auto& entry = recvBuf[k];
-            BLoc(entry.i,entry.j) = Caster<S,T>::Cast(entry.value);
+            const Int localHeight = BLoc.Height();
+            if( localHeight == BLoc.LDim() )
+            {
+                mpi::Broadcast
+                ( BLoc.Buffer(0,jLocStartB), localHeight*(jLocEndB-jLocStartB),
+                  0, B.RedundantComm() );
+            }
+            else
+            {
+                for( Int jLoc=jLocStartB; jLoc<jLocEndB; ++jLoc )
+                    mpi::Broadcast
+                    ( BLoc.Buffer(0,jLoc), localHeight, 0, B.RedundantComm() );
+            }
         }
     }
 }
@@ -164,6 +202,7 @@ void GeneralPurpose
         AbstractDistMatrix<T>& B ) 
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("copy::GeneralPurpose")
 
     if( A.Grid().Size() == 1 && B.Grid().Size() == 1 )
     {
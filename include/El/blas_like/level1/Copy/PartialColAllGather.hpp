@@ -18,6 +18,7 @@ void PartialColAllGather
         DistMatrix<T,Partial<U>(),V>& B ) 
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("copy::PartialColAllGather")
     AssertSameGrids( A, B );
 
     const Int height = A.Height();
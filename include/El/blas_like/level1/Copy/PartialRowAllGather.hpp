@@ -18,6 +18,7 @@ void PartialRowAllGather
 ( const ElementalMatrix<T>& A, ElementalMatrix<T>& B ) 
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("copy::PartialRowAllGather")
     DEBUG_ONLY(
       if( B.ColDist() != A.ColDist() ||
           B.RowDist() != Partial(A.RowDist()) ) 
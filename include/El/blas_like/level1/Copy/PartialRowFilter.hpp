@@ -17,6 +17,7 @@ void PartialRowFilter
 ( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("copy::PartialRowFilter")
     DEBUG_ONLY(
       if( A.ColDist() != B.ColDist() ||
           A.RowDist() != Partial(B.RowDist()) )
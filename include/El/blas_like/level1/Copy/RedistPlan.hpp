@@ -0,0 +1,691 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BLAS_COPY_REDISTPLAN_HPP
+#define EL_BLAS_COPY_REDISTPLAN_HPP
+
+namespace El {
+
+// The ways in which a plan redistributes the entries. The first three apply
+// to element-wise distributions over the same grid and only store O(p)
+// metadata, while the last stores the source and destination of each entry.
+namespace RedistKernelNS {
+enum RedistKernel {
+  // Each process already owns the entries of B (e.g., Filter, ColFilter, and
+  // PartialColFilter), and so they are copied without communication
+  REDIST_LOCAL,
+  // Each process of B gathers its entries from the processes of a
+  // subcommunicator of A (e.g., AllGather, ColAllGather, and
+  // PartialColAllGather)
+  REDIST_ALLGATHER,
+  // Each pair of processes exchanges the strided submatrix of their local
+  // matrices which they have in common (e.g., the all-to-all promotions and
+  // demotions, TransposeDist, and misaligned Translates)
+  REDIST_STRIDED,
+  // As in copy::GeneralPurpose (e.g., for block distributions or between
+  // grids), the local indices of each entry are stored
+  REDIST_GENERAL
+};
+}
+using namespace RedistKernelNS;
+
+// The strided submatrix with rows rowStart+i*rowStep, 0 <= i < numRows, and
+// columns colStart+j*colStep, 0 <= j < numCols, of a local matrix (with the
+// steps stored by the plan)
+struct RedistBlock
+{
+    Int rowStart=0, numRows=0, colStart=0, numCols=0;
+    Int Size() const { return numRows*numCols; }
+};
+
+// A reusable plan for redistributing a matrix from the distribution of A to
+// that of B (including their alignments, roots, grids, and the matrix shape).
+//
+// Building the plan determines which kernel applies and precomputes its
+// communicators, portion sizes, and offsets (or, for REDIST_GENERAL, the
+// local indices of the packed entries), so that each execution only packs,
+// exchanges, and unpacks the values and performs no owner computations.
+//
+// Only the first redundant copy of A sends its entries. With
+// REDIST_GENERAL, the first redundant copy of B broadcasts the received
+// entries to the others (as in copy::GeneralPurpose), whereas the other
+// kernels deliver them to every copy directly.
+struct RedistPlan
+{
+    Int height=0, width=0;
+    DistData dataA, dataB;
+    bool includeViewers=false;
+    // False if this process does not take part in the redistribution
+    bool active=false;
+    RedistKernel kernel=REDIST_GENERAL;
+    mpi::Comm comm;
+
+    // The steps of the blocks of the local matrices of A and B
+    Int srcRowStep=1, srcColStep=1, destRowStep=1, destColStep=1;
+    // REDIST_LOCAL (and the portion of REDIST_STRIDED that the process keeps)
+    RedistBlock localSrc, localDest;
+    // REDIST_ALLGATHER: the blocks of B formed from the local matrices of the
+    // members of 'gatherComm', each sent as a portion of 'portionSize' entries
+    mpi::Comm gatherComm;
+    int portionSize=0;
+    // REDIST_STRIDED: the blocks sent to and received from each process of
+    // 'comm' (the counts exclude the local portion)
+    vector<RedistBlock> sendBlocks, recvBlocks;
+
+    vector<int> sendCounts, sendOffs;
+    vector<int> recvCounts, recvOffs;
+
+    // REDIST_GENERAL
+    // --------------
+    // The local entries of A which are sent, in their packed order
+    vector<Int> sendRows, sendCols;
+    // The local entries of B which the received values are unpacked into
+    vector<Int> recvRows, recvCols;
+    // The entries of A which are directly copied into the local entries of B
+    vector<Int> localSrcRows, localSrcCols, localDestRows, localDestCols;
+
+    RedistPlan() { }
+    template<typename S,typename T>
+    RedistPlan
+    ( const AbstractDistMatrix<S>& A, const AbstractDistMatrix<T>& B )
+    { Build( A, B ); }
+
+    template<typename S,typename T>
+    void Build
+    ( const AbstractDistMatrix<S>& A, const AbstractDistMatrix<T>& B );
+
+    // Whether or not the plan applies to the redistribution of A into B
+    template<typename S,typename T>
+    bool Matches
+    ( const AbstractDistMatrix<S>& A, const AbstractDistMatrix<T>& B ) const;
+
+private:
+    template<typename S,typename T>
+    bool BuildLocal
+    ( const AbstractDistMatrix<S>& A, const AbstractDistMatrix<T>& B );
+    template<typename S,typename T>
+    bool BuildAllGather
+    ( const AbstractDistMatrix<S>& A, const AbstractDistMatrix<T>& B );
+    template<typename S,typename T>
+    void BuildStrided
+    ( const AbstractDistMatrix<S>& A, const AbstractDistMatrix<T>& B );
+    template<typename S,typename T>
+    void BuildGeneral
+    ( const AbstractDistMatrix<S>& A, const AbstractDistMatrix<T>& B );
+};
+
+namespace copy {
+namespace util {
+
+// The residue modulo lcm(s,t) of the intersection of the residue classes
+// a mod s and b mod t, or -1 if the intersection is empty
+inline Int IntersectResidues( Int a, Int s, Int b, Int t )
+{
+    // Find x such that s x = gcd(s,t) (mod t)
+    Int r0=s, r1=t, x0=1, x1=0;
+    while( r1 != 0 )
+    {
+        const Int q = r0 / r1;
+        Int tmp = r0 - q*r1; r0 = r1; r1 = tmp;
+        tmp = x0 - q*x1; x0 = x1; x1 = tmp;
+    }
+    const Int gcd = r0;
+    if( (b-a) % gcd != 0 )
+        return -1;
+    const Int tReduced = t / gcd;
+    const Int lcm = s*tReduced;
+    Int k = ((b-a)/gcd % tReduced) * (x0 % tReduced) % tReduced;
+    Int residue = (a + s*k) % lcm;
+    if( residue < 0 )
+        residue += lcm;
+    return residue;
+}
+
+// The blocks of the local matrices of the processes with the given shifts in
+// A and B which hold the entries that they have in common
+inline void SharedBlocks
+( Int height, Int width,
+  Int AColShift, Int ARowShift, Int AColStride, Int ARowStride,
+  Int BColShift, Int BRowShift, Int BColStride, Int BRowStride,
+  RedistBlock& ABlock, RedistBlock& BBlock )
+{
+    const Int row =
+      IntersectResidues( AColShift, AColStride, BColShift, BColStride );
+    const Int col =
+      IntersectResidues( ARowShift, ARowStride, BRowShift, BRowStride );
+    if( row < 0 || col < 0 )
+    {
+        ABlock = BBlock = RedistBlock();
+        return;
+    }
+    const Int rowLCM = AColStride/GCD(AColStride,BColStride)*BColStride;
+    const Int colLCM = ARowStride/GCD(ARowStride,BRowStride)*BRowStride;
+    ABlock.numRows = BBlock.numRows = Length( height, row, rowLCM );
+    ABlock.numCols = BBlock.numCols = Length( width, col, colLCM );
+    ABlock.rowStart = (row-AColShift) / AColStride;
+    ABlock.colStart = (col-ARowShift) / ARowStride;
+    BBlock.rowStart = (row-BColShift) / BColStride;
+    BBlock.colStart = (col-BRowShift) / BRowStride;
+}
+
+template<typename S>
+void PackBlock
+( const RedistBlock& block, Int rowStep, Int colStep,
+  const S* A, Int ALDim, S* buf )
+{
+    for( Int j=0; j<block.numCols; ++j )
+    {
+        const S* ACol = &A[(block.colStart+j*colStep)*ALDim];
+        for( Int i=0; i<block.numRows; ++i )
+            buf[i+j*block.numRows] = ACol[block.rowStart+i*rowStep];
+    }
+}
+
+template<typename S,typename T>
+void UnpackBlock
+( const RedistBlock& block, Int rowStep, Int colStep,
+  const S* buf, T* B, Int BLDim )
+{
+    for( Int j=0; j<block.numCols; ++j )
+    {
+        T* BCol = &B[(block.colStart+j*colStep)*BLDim];
+        for( Int i=0; i<block.numRows; ++i )
+            BCol[block.rowStart+i*rowStep] =
+              Caster<S,T>::Cast(buf[i+j*block.numRows]);
+    }
+}
+
+template<typename S,typename T>
+void CopyBlock
+( const RedistBlock& srcBlock, Int srcRowStep, Int srcColStep,
+  const S* A, Int ALDim,
+  const RedistBlock& destBlock, Int destRowStep, Int destColStep,
+        T* B, Int BLDim )
+{
+    for( Int j=0; j<srcBlock.numCols; ++j )
+    {
+        const S* ACol = &A[(srcBlock.colStart+j*srcColStep)*ALDim];
+        T* BCol = &B[(destBlock.colStart+j*destColStep)*BLDim];
+        for( Int i=0; i<srcBlock.numRows; ++i )
+            BCol[destBlock.rowStart+i*destRowStep] =
+              Caster<S,T>::Cast(ACol[srcBlock.rowStart+i*srcRowStep]);
+    }
+}
+
+} // namespace util
+} // namespace copy
+
+template<typename S,typename T>
+void RedistPlan::Build
+( const AbstractDistMatrix<S>& A, const AbstractDistMatrix<T>& B )
+{
+    DEBUG_CSE
+    height = A.Height();
+    width = A.Width();
+    dataA = DistData(A);
+    dataB = DistData(B);
+    includeViewers = ( A.Grid() != B.Grid() );
+
+    const Grid& g = B.Grid();
+    kernel = REDIST_GENERAL;
+    srcRowStep = srcColStep = destRowStep = destColStep = 1;
+    localSrc = localDest = RedistBlock();
+    portionSize = 0;
+    sendBlocks.clear(); recvBlocks.clear();
+    sendCounts.clear(); sendOffs.clear();
+    recvCounts.clear(); recvOffs.clear();
+    sendRows.clear(); sendCols.clear();
+    recvRows.clear(); recvCols.clear();
+    localSrcRows.clear(); localSrcCols.clear();
+    localDestRows.clear(); localDestCols.clear();
+    if( includeViewers )
+        comm = g.ViewingComm();
+    else if( g.InGrid() )
+        comm = g.VCComm();
+    else
+    {
+        active = false;
+        return;
+    }
+    active = true;
+
+    if( !includeViewers && A.Wrap() == ELEMENT && B.Wrap() == ELEMENT )
+    {
+        if( BuildLocal( A, B ) || BuildAllGather( A, B ) )
+            return;
+        BuildStrided( A, B );
+    }
+    else
+        BuildGeneral( A, B );
+}
+
+template<typename S,typename T>
+bool RedistPlan::BuildLocal
+( const AbstractDistMatrix<S>& A, const AbstractDistMatrix<T>& B )
+{
+    DEBUG_CSE
+    // Each participating process of B must own every row and column of its
+    // local matrix within A
+    const Int AColStride=A.ColStride(), ARowStride=A.RowStride(),
+              BColStride=B.ColStride(), BRowStride=B.RowStride();
+    const Int AColShift=A.ColShift(), ARowShift=A.RowShift(),
+              BColShift=B.ColShift(), BRowShift=B.RowShift();
+    int applies = 1;
+    if( B.Participating() )
+        applies = A.Participating() &&
+          BColStride % AColStride == 0 && BRowStride % ARowStride == 0 &&
+          (BColShift-AColShift) % AColStride == 0 &&
+          (BRowShift-ARowShift) % ARowStride == 0;
+    if( !mpi::AllReduce( applies, mpi::MIN, comm ) )
+        return false;
+
+    kernel = REDIST_LOCAL;
+    srcRowStep = BColStride / AColStride;
+    srcColStep = BRowStride / ARowStride;
+    if( B.Participating() )
+    {
+        localSrc.rowStart = (BColShift-AColShift) / AColStride;
+        localSrc.colStart = (BRowShift-ARowShift) / ARowStride;
+        localSrc.numRows = Length( height, BColShift, BColStride );
+        localSrc.numCols = Length( width, BRowShift, BRowStride );
+        localDest.numRows = localSrc.numRows;
+        localDest.numCols = localSrc.numCols;
+    }
+    return true;
+}
+
+template<typename S,typename T>
+bool RedistPlan::BuildAllGather
+( const AbstractDistMatrix<S>& A, const AbstractDistMatrix<T>& B )
+{
+    DEBUG_CSE
+    const Int AColStride=A.ColStride(), ARowStride=A.RowStride(),
+              BColStride=B.ColStride(), BRowStride=B.RowStride();
+    if( AColStride % BColStride != 0 || ARowStride % BRowStride != 0 )
+        return false;
+    const int gatherSize = (AColStride/BColStride)*(ARowStride/BRowStride);
+    if( gatherSize == 1 )
+        return false;
+    const int partic = A.Participating() && B.Participating();
+    if( !mpi::AllReduce( partic, mpi::MIN, comm ) )
+        return false;
+
+    // Find the subcommunicator of A whose members hold exactly the entries
+    // of our local matrix of B
+    const Int BColShift=B.ColShift(), BRowShift=B.RowShift();
+    const mpi::Comm candidates[] =
+      { A.ColComm(), A.RowComm(),
+        A.PartialColComm(), A.PartialRowComm(),
+        A.PartialUnionColComm(), A.PartialUnionRowComm(),
+        A.DistComm() };
+    vector<int> sendShifts(2), shifts(2*gatherSize);
+    sendShifts[0] = A.ColShift();
+    sendShifts[1] = A.RowShift();
+    for( const mpi::Comm& candidate : candidates )
+    {
+        if( mpi::Size(candidate) != gatherSize )
+            continue;
+        mpi::AllGather( sendShifts.data(), 2, shifts.data(), 2, candidate );
+        vector<pair<int,int>> shiftPairs( gatherSize );
+        int covers = 1;
+        for( int q=0; q<gatherSize; ++q )
+        {
+            shiftPairs[q] = pair<int,int>(shifts[2*q],shifts[2*q+1]);
+            if( (shifts[2*q]-BColShift) % BColStride != 0 ||
+                (shifts[2*q+1]-BRowShift) % BRowStride != 0 )
+                covers = 0;
+        }
+        std::sort( shiftPairs.begin(), shiftPairs.end() );
+        for( int q=1; q<gatherSize; ++q )
+            if( shiftPairs[q] == shiftPairs[q-1] )
+                covers = 0;
+        if( !mpi::AllReduce( covers, mpi::MIN, comm ) )
+            continue;
+
+        kernel = REDIST_ALLGATHER;
+        gatherComm = candidate;
+        destRowStep = AColStride / BColStride;
+        destColStep = ARowStride / BRowStride;
+        recvBlocks.resize( gatherSize );
+        for( int q=0; q<gatherSize; ++q )
+        {
+            RedistBlock& block = recvBlocks[q];
+            block.rowStart = (shifts[2*q]-BColShift) / BColStride;
+            block.colStart = (shifts[2*q+1]-BRowShift) / BRowStride;
+            block.numRows = Length( height, shifts[2*q], AColStride );
+            block.numCols = Length( width, shifts[2*q+1], ARowStride );
+            portionSize = Max( portionSize, int(block.Size()) );
+        }
+        return true;
+    }
+    return false;
+}
+
+template<typename S,typename T>
+void RedistPlan::BuildStrided
+( const AbstractDistMatrix<S>& A, const AbstractDistMatrix<T>& B )
+{
+    DEBUG_CSE
+    kernel = REDIST_STRIDED;
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+    const Int AColStride=A.ColStride(), ARowStride=A.RowStride(),
+              BColStride=B.ColStride(), BRowStride=B.RowStride();
+    const bool sends = ( A.Participating() && A.RedundantRank() == 0 );
+    const bool recvs = B.Participating();
+
+    const Int rowLCM = AColStride/GCD(AColStride,BColStride)*BColStride;
+    const Int colLCM = ARowStride/GCD(ARowStride,BRowStride)*BRowStride;
+    srcRowStep = rowLCM / AColStride;
+    srcColStep = colLCM / ARowStride;
+    destRowStep = rowLCM / BColStride;
+    destColStep = colLCM / BRowStride;
+
+    // Exchange the shifts of each process (or -1 if it does not send/recv)
+    vector<int> myShifts(4), shifts(4*commSize);
+    myShifts[0] = ( sends ? A.ColShift() : -1 );
+    myShifts[1] = ( sends ? A.RowShift() : -1 );
+    myShifts[2] = ( recvs ? B.ColShift() : -1 );
+    myShifts[3] = ( recvs ? B.RowShift() : -1 );
+    mpi::AllGather( myShifts.data(), 4, shifts.data(), 4, comm );
+
+    RedistBlock unused;
+    sendBlocks.assign( commSize, RedistBlock() );
+    recvBlocks.assign( commSize, RedistBlock() );
+    sendCounts.assign( commSize, 0 );
+    recvCounts.assign( commSize, 0 );
+    for( int q=0; q<commSize; ++q )
+    {
+        if( sends && shifts[4*q+2] >= 0 )
+        {
+            copy::util::SharedBlocks
+            ( height, width,
+              myShifts[0], myShifts[1], AColStride, ARowStride,
+              shifts[4*q+2], shifts[4*q+3], BColStride, BRowStride,
+              sendBlocks[q], unused );
+            if( q != commRank )
+                sendCounts[q] = sendBlocks[q].Size();
+        }
+        if( recvs && shifts[4*q] >= 0 )
+        {
+            copy::util::SharedBlocks
+            ( height, width,
+              shifts[4*q], shifts[4*q+1], AColStride, ARowStride,
+              myShifts[2], myShifts[3], BColStride, BRowStride,
+              unused, recvBlocks[q] );
+            if( q != commRank )
+                recvCounts[q] = recvBlocks[q].Size();
+        }
+    }
+    if( sends && recvs )
+    {
+        localSrc = sendBlocks[commRank];
+        localDest = recvBlocks[commRank];
+    }
+    Scan( sendCounts, sendOffs );
+    Scan( recvCounts, recvOffs );
+}
+
+template<typename S,typename T>
+void RedistPlan::BuildGeneral
+( const AbstractDistMatrix<S>& A, const AbstractDistMatrix<T>& B )
+{
+    DEBUG_CSE
+    const Grid& g = B.Grid();
+    const Dist colDist=B.ColDist(), rowDist=B.RowDist();
+    const int root = B.Root();
+    const bool BPartic = B.Participating();
+    const int commSize = mpi::Size( comm );
+
+    vector<int> distMap(commSize);
+    for( int q=0; q<commSize; ++q )
+    {
+        const int vcOwner = g.CoordsToVC(colDist,rowDist,q,root);
+        distMap[q] = ( includeViewers ? g.VCToViewing(vcOwner) : vcOwner );
+    }
+
+    // Determine the owners and destination indices of our entries
+    // ===========================================================
+    vector<int> owners;
+    vector<Int> remoteRows, remoteCols, destRows, destCols;
+    if( A.RedundantRank() == 0 )
+    {
+        const Int localHeight = A.LocalHeight();
+        const Int localWidth = A.LocalWidth();
+        const bool noRedundant = B.RedundantSize() == 1;
+        const int colStride = B.ColStride();
+        const int rowRank = B.RowRank();
+        const int colRank = B.ColRank();
+
+        vector<Int> localRows(localHeight);
+        vector<int> ownerRows(localHeight);
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const Int i = A.GlobalRow(iLoc);
+            ownerRows[iLoc] = B.RowOwner(i);
+            localRows[iLoc] = B.LocalRow(i,ownerRows[iLoc]);
+        }
+
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        {
+            const Int j = A.GlobalCol(jLoc);
+            const int ownerCol = B.ColOwner(j);
+            const Int localCol = B.LocalCol(j,ownerCol);
+            const bool isLocalCol = ( BPartic && ownerCol == rowRank );
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            {
+                const int ownerRow = ownerRows[iLoc];
+                const bool isLocalRow = ( BPartic && ownerRow == colRank );
+                if( noRedundant && isLocalRow && isLocalCol )
+                {
+                    localSrcRows.push_back( iLoc );
+                    localSrcCols.push_back( jLoc );
+                    localDestRows.push_back( localRows[iLoc] );
+                    localDestCols.push_back( localCol );
+                }
+                else
+                {
+                    remoteRows.push_back( iLoc );
+                    remoteCols.push_back( jLoc );
+                    destRows.push_back( localRows[iLoc] );
+                    destCols.push_back( localCol );
+                    owners.push_back( distMap[ownerRow+colStride*ownerCol] );
+                }
+            }
+        }
+    }
+
+    // Order the sends by their owners
+    // ===============================
+    const Int totalSend = owners.size();
+    sendCounts.assign( commSize, 0 );
+    for( Int k=0; k<totalSend; ++k )
+        ++sendCounts[owners[k]];
+    Scan( sendCounts, sendOffs );
+    FastResize( sendRows, totalSend );
+    FastResize( sendCols, totalSend );
+    vector<Int> sendDestInds;
+    FastResize( sendDestInds, 2*totalSend );
+    auto offs = sendOffs;
+    for( Int k=0; k<totalSend; ++k )
+    {
+        const Int s = offs[owners[k]]++;
+        sendRows[s] = remoteRows[k];
+        sendCols[s] = remoteCols[k];
+        sendDestInds[2*s  ] = destRows[k];
+        sendDestInds[2*s+1] = destCols[k];
+    }
+    SwapClear( owners );
+    SwapClear( remoteRows );
+    SwapClear( remoteCols );
+    SwapClear( destRows );
+    SwapClear( destCols );
+
+    // Exchange the destination indices once
+    // =====================================
+    recvCounts.resize( commSize );
+    mpi::AllToAll( sendCounts.data(), 1, recvCounts.data(), 1, comm );
+    const Int totalRecv = Scan( recvCounts, recvOffs );
+    vector<int> sendIndCounts(commSize), sendIndOffs(commSize),
+                recvIndCounts(commSize), recvIndOffs(commSize);
+    for( int q=0; q<commSize; ++q )
+    {
+        sendIndCounts[q] = 2*sendCounts[q];
+        sendIndOffs[q] = 2*sendOffs[q];
+        recvIndCounts[q] = 2*recvCounts[q];
+        recvIndOffs[q] = 2*recvOffs[q];
+    }
+    vector<Int> recvDestInds;
+    FastResize( recvDestInds, 2*totalRecv );
+    mpi::AllToAll
+    ( sendDestInds.data(), sendIndCounts.data(), sendIndOffs.data(),
+      recvDestInds.data(), recvIndCounts.data(), recvIndOffs.data(), comm );
+    SwapClear( sendDestInds );
+
+    // Every redundant copy of B unpacks the same entries
+    Int recvSize = totalRecv;
+    if( BPartic && B.RedundantSize() > 1 )
+    {
+        mpi::Broadcast( recvSize, 0, B.RedundantComm() );
+        FastResize( recvDestInds, 2*recvSize );
+        mpi::Broadcast
+        ( recvDestInds.data(), 2*recvSize, 0, B.RedundantComm() );
+    }
+    if( !BPartic )
+        recvSize = 0;
+    FastResize( recvRows, recvSize );
+    FastResize( recvCols, recvSize );
+    for( Int k=0; k<recvSize; ++k )
+    {
+        recvRows[k] = recvDestInds[2*k];
+        recvCols[k] = recvDestInds[2*k+1];
+    }
+}
+
+template<typename S,typename T>
+bool RedistPlan::Matches
+( const AbstractDistMatrix<S>& A, const AbstractDistMatrix<T>& B ) const
+{
+    const DistData newDataA = DistData(A);
+    const DistData newDataB = DistData(B);
+    return A.Height() == height && A.Width() == width &&
+           newDataA == dataA && newDataB == dataB &&
+           newDataA.colCut == dataA.colCut && newDataA.rowCut == dataA.rowCut &&
+           newDataB.colCut == dataB.colCut && newDataB.rowCut == dataB.rowCut;
+}
+
+// Redistribute A into B (resizing B) using a plan built for their
+// distributions and shape
+template<typename S,typename T,typename=EnableIf<CanCast<S,T>>>
+void Execute
+( const RedistPlan& plan,
+  const AbstractDistMatrix<S>& A,
+        AbstractDistMatrix<T>& B )
+{
+    DEBUG_CSE
+    DEBUG_ONLY(
+      if( !plan.Matches( A, B ) )
+          LogicError("Redistribution plan does not match A and B");
+    )
+    B.Resize( plan.height, plan.width );
+    if( !plan.active )
+        return;
+
+    const S* ABuf = A.LockedBuffer();
+    const Int ALDim = A.LDim();
+    T* BBuf = B.Buffer();
+    const Int BLDim = B.LDim();
+
+    if( plan.kernel == REDIST_LOCAL )
+    {
+        copy::util::CopyBlock
+        ( plan.localSrc, plan.srcRowStep, plan.srcColStep, ABuf, ALDim,
+          plan.localDest, plan.destRowStep, plan.destColStep, BBuf, BLDim );
+    }
+    else if( plan.kernel == REDIST_ALLGATHER )
+    {
+        const int gatherSize = plan.recvBlocks.size();
+        vector<S> buffer;
+        FastResize( buffer, (gatherSize+1)*plan.portionSize );
+        S* sendBuf = buffer.data();
+        S* recvBuf = sendBuf + plan.portionSize;
+        RedistBlock ABlock;
+        ABlock.numRows = A.LocalHeight();
+        ABlock.numCols = A.LocalWidth();
+        copy::util::PackBlock( ABlock, 1, 1, ABuf, ALDim, sendBuf );
+        mpi::AllGather
+        ( sendBuf, plan.portionSize,
+          recvBuf, plan.portionSize, plan.gatherComm );
+        for( int q=0; q<gatherSize; ++q )
+            copy::util::UnpackBlock
+            ( plan.recvBlocks[q], plan.destRowStep, plan.destColStep,
+              &recvBuf[q*plan.portionSize], BBuf, BLDim );
+    }
+    else if( plan.kernel == REDIST_STRIDED )
+    {
+        const int commSize = plan.sendCounts.size();
+        const Int totalSend = plan.sendOffs.back() + plan.sendCounts.back();
+        const Int totalRecv = plan.recvOffs.back() + plan.recvCounts.back();
+        vector<S> sendBuf, recvBuf;
+        FastResize( sendBuf, Max(totalSend,Int(1)) );
+        FastResize( recvBuf, Max(totalRecv,Int(1)) );
+        for( int q=0; q<commSize; ++q )
+            if( plan.sendCounts[q] != 0 )
+                copy::util::PackBlock
+                ( plan.sendBlocks[q], plan.srcRowStep, plan.srcColStep,
+                  ABuf, ALDim, &sendBuf[plan.sendOffs[q]] );
+        copy::util::CopyBlock
+        ( plan.localSrc, plan.srcRowStep, plan.srcColStep, ABuf, ALDim,
+          plan.localDest, plan.destRowStep, plan.destColStep, BBuf, BLDim );
+        mpi::SparseAllToAll
+        ( sendBuf, plan.sendCounts, plan.sendOffs,
+          recvBuf, plan.recvCounts, plan.recvOffs, plan.comm );
+        SwapClear( sendBuf );
+        for( int q=0; q<commSize; ++q )
+            if( plan.recvCounts[q] != 0 )
+                copy::util::UnpackBlock
+                ( plan.recvBlocks[q], plan.destRowStep, plan.destColStep,
+                  &recvBuf[plan.recvOffs[q]], BBuf, BLDim );
+    }
+    else
+    {
+        // Pack the values and directly copy the local ones
+        const Int totalSend = plan.sendRows.size();
+        vector<S> sendBuf;
+        FastResize( sendBuf, totalSend );
+        for( Int k=0; k<totalSend; ++k )
+            sendBuf[k] = ABuf[plan.sendRows[k]+plan.sendCols[k]*ALDim];
+        const Int numLocal = plan.localSrcRows.size();
+        for( Int k=0; k<numLocal; ++k )
+            BBuf[plan.localDestRows[k]+plan.localDestCols[k]*BLDim] =
+              Caster<S,T>::Cast
+              (ABuf[plan.localSrcRows[k]+plan.localSrcCols[k]*ALDim]);
+
+        // Exchange and unpack the values
+        const Int recvSize = plan.recvRows.size();
+        vector<S> recvBuf;
+        FastResize( recvBuf, Max(recvSize,Int(1)) );
+        mpi::SparseAllToAll
+        ( sendBuf, plan.sendCounts, plan.sendOffs,
+          recvBuf, plan.recvCounts, plan.recvOffs, plan.comm );
+        SwapClear( sendBuf );
+        if( B.Participating() )
+        {
+            if( B.RedundantSize() > 1 )
+                mpi::Broadcast
+                ( recvBuf.data(), recvSize, 0, B.RedundantComm() );
+            for( Int k=0; k<recvSize; ++k )
+                BBuf[plan.recvRows[k]+plan.recvCols[k]*BLDim] =
+                  Caster<S,T>::Cast(recvBuf[k]);
+        }
+    }
+}
+
+} // namespace El
+
+#endif // ifndef EL_BLAS_COPY_REDISTPLAN_HPP
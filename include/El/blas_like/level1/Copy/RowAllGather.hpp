@@ -17,6 +17,7 @@ template<typename T>
 void RowAllGather( const ElementalMatrix<T>& A, ElementalMatrix<T>& B ) 
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("copy::RowAllGather")
     DEBUG_ONLY(
       if( A.ColDist() != B.ColDist() || 
           Collect(A.RowDist()) != B.RowDist() )
@@ -25,6 +26,8 @@ void RowAllGather( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
     AssertSameGrids( A, B );
     const Int height = A.Height();
     const Int width = A.Width();
+    if( RowAllGatherShared( A, B ) )
+        return;
     B.AlignColsAndResize( A.ColAlign(), height, width, false, false );
 
     if( A.Participating() )
@@ -18,6 +18,7 @@ void RowAllToAllDemote
           DistMatrix<T,                U,             V   >& B )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("copy::RowAllToAllDemote")
     AssertSameGrids( A, B );
 
     const Int height = A.Height();
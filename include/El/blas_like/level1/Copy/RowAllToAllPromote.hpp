@@ -18,6 +18,7 @@ void RowAllToAllPromote
         DistMatrix<T,PartialUnionCol<U,V>(),Partial<V>()>& B )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("copy::RowAllToAllPromote")
     AssertSameGrids( A, B );
 
     const Int height = A.Height();
@@ -18,6 +18,7 @@ void RowFilter
 ( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("copy::RowFilter")
     DEBUG_ONLY(
       if( A.ColDist() != B.ColDist() ||
           A.RowDist() != Collect(B.RowDist()) )
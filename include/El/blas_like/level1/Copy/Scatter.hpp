@@ -18,6 +18,7 @@ void Scatter
         ElementalMatrix<T>& B )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("copy::Scatter")
     AssertSameGrids( A, B );
 
     const Int m = A.Height();
@@ -0,0 +1,329 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BLAS_COPY_SHAREDALLGATHER_HPP
+#define EL_BLAS_COPY_SHAREDALLGATHER_HPP
+
+namespace El {
+namespace copy {
+
+// The processes of the communicator of the given distribution which share
+// our node
+inline mpi::Comm DistNodeComm( const Grid& g, Dist dist )
+{
+    switch( dist )
+    {
+    case MC: return g.MCNodeComm();
+    case MR: return g.MRNodeComm();
+    case VC:
+    case VR: return g.NodeComm();
+    // The node-local portions of the diagonal communicators are not stored
+    default: return mpi::COMM_SELF;
+    }
+}
+
+// The first processes of each node within 'comm', the communicator of the
+// given distribution (every process is a leader when the node-local
+// communicator is COMM_SELF)
+inline mpi::Comm DistNodeLeaderComm( const Grid& g, Dist dist, mpi::Comm comm )
+{
+    switch( dist )
+    {
+    case MC: return g.MCNodeLeaderComm();
+    case MR: return g.MRNodeLeaderComm();
+    case VC:
+    case VR: return g.NodeLeaderComm();
+    default: return comm;
+    }
+}
+
+template<typename T>
+bool UseSharedReplication
+( const ElementalMatrix<T>& A, const ElementalMatrix<T>& B )
+{
+    return IsPacked<T>::value && SharedReplication() &&
+           A.Grid().InGrid() && A.CrossSize() == 1 &&
+           (!B.Viewing() || B.NodeShared());
+}
+
+namespace util {
+
+// All-gather the 'numSlots' packed portions (each of 'portionSize' entries)
+// distributed over a communicator into 'resultSize' entries of a window which
+// is shared by the processes of 'nodeComm' (the processes of the communicator
+// which share our node). The process contributing the portion for slot s
+// passes it in 'portion' along with 'slot' (and the other processes pass a
+// slot of -1).
+//
+// The portions are first written into the grid's node-shared staging window
+// so that only the first process of each node (the members of 'leaderComm')
+// takes part in the exchange between nodes, and the processes on each node
+// then unpack disjoint subsets of the portions into the result via 'unpack'.
+// If 'resultWindow' was allocated over 'nodeComm' and is already large
+// enough, it is reused for the result.
+template<typename T>
+void SharedAllGather
+( const T* portion, int slot, int numSlots, Int portionSize,
+  const Grid& g, mpi::Comm nodeComm, mpi::Comm leaderComm,
+  Int resultSize, function<void(int,const T*,T*)> unpack,
+  T*& result, std::shared_ptr<mpi::Window>& resultWindow )
+{
+    DEBUG_CSE
+    const int nodeRank = mpi::Rank( nodeComm );
+    const int nodeSize = mpi::Size( nodeComm );
+    const bool leader = ( nodeRank == 0 );
+
+    // Write our portion into the node's staging window
+    mpi::Window stagingWindow;
+    T* staging = static_cast<T*>
+      (g.NodeStaging
+       ( nodeComm, size_t(numSlots)*portionSize*sizeof(T), stagingWindow ));
+    if( slot >= 0 )
+        MemCopy( &staging[slot*portionSize], portion, portionSize );
+    vector<int> nodeSlots(nodeSize);
+    mpi::AllGather( &slot, 1, nodeSlots.data(), 1, nodeComm );
+    mpi::SyncShared( stagingWindow, nodeComm );
+
+    // Exchange the portions of each node between the node leaders
+    if( leader )
+    {
+        vector<int> mySlots;
+        for( const int nodeSlot : nodeSlots )
+            if( nodeSlot >= 0 )
+                mySlots.push_back( nodeSlot );
+        const int numMySlots = mySlots.size();
+
+        const int numLeaders = mpi::Size( leaderComm );
+        vector<int> slotCounts(numLeaders), slotOffs;
+        mpi::AllGather( &numMySlots, 1, slotCounts.data(), 1, leaderComm );
+        const int totalSlots = Scan( slotCounts, slotOffs );
+        vector<int> allSlots(totalSlots);
+        mpi::AllGather
+        ( mySlots.data(), numMySlots,
+          allSlots.data(), slotCounts.data(), slotOffs.data(), leaderComm );
+
+        vector<T> sendBuf, recvBuf;
+        FastResize( sendBuf, numMySlots*portionSize );
+        FastResize( recvBuf, totalSlots*portionSize );
+        for( int k=0; k<numMySlots; ++k )
+            MemCopy
+            ( &sendBuf[k*portionSize], &staging[mySlots[k]*portionSize],
+              portionSize );
+        vector<int> recvCounts(numLeaders), recvOffs(numLeaders);
+        for( int q=0; q<numLeaders; ++q )
+        {
+            recvCounts[q] = slotCounts[q]*portionSize;
+            recvOffs[q] = slotOffs[q]*portionSize;
+        }
+        mpi::AllGather
+        ( sendBuf.data(), numMySlots*portionSize,
+          recvBuf.data(), recvCounts.data(), recvOffs.data(), leaderComm );
+
+        const int leaderRank = mpi::Rank( leaderComm );
+        for( int q=0; q<numLeaders; ++q )
+        {
+            if( q == leaderRank )
+                continue;
+            for( int k=slotOffs[q]; k<slotOffs[q]+slotCounts[q]; ++k )
+                MemCopy
+                ( &staging[allSlots[k]*portionSize], &recvBuf[k*portionSize],
+                  portionSize );
+        }
+    }
+
+    // Unpack the portions into the node's copy of the result (every process
+    // of the node agrees on whether the previous window can be reused, since
+    // they all hold it and the requested sizes agree). A window shared over
+    // a different node-local communicator (e.g., by a previous column-wise
+    // all-gather into the same matrix) is replaced.
+    const size_t resultBytes = Max( size_t(resultSize)*sizeof(T), size_t(1) );
+    if( !resultWindow || resultWindow->comm != nodeComm ||
+        resultWindow->numBytes < resultBytes )
+    {
+        resultWindow.reset
+        ( new mpi::Window,
+          []( mpi::Window* w )
+          {
+              if( !mpi::Finalized() )
+                  mpi::Free( *w );
+              delete w;
+          } );
+        mpi::AllocateShared( resultBytes, nodeComm, *resultWindow );
+    }
+    result = static_cast<T*>( resultWindow->base );
+    mpi::SyncShared( stagingWindow, nodeComm );
+    for( int s=nodeRank; s<numSlots; s+=nodeSize )
+        unpack( s, &staging[s*portionSize], result );
+    mpi::SyncShared( *resultWindow, nodeComm );
+}
+
+} // namespace util
+
+// (U,V) |-> (* ,* )
+template<typename T>
+bool AllGatherShared( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
+{
+    DEBUG_CSE
+    if( !UseSharedReplication( A, B ) || A.DistSize() == 1 ||
+        B.ColDist() != STAR || B.RowDist() != STAR )
+        return false;
+
+    const Grid& g = A.Grid();
+    const Int height = A.Height();
+    const Int width = A.Width();
+    const Int colStride = A.ColStride();
+    const Int rowStride = A.RowStride();
+    const Int colAlign = A.ColAlign();
+    const Int rowAlign = A.RowAlign();
+    const Int maxLocalHeight = MaxLength(height,colStride);
+    const Int maxLocalWidth = MaxLength(width,rowStride);
+    const Int portionSize = mpi::Pad( maxLocalHeight*maxLocalWidth );
+
+    // Only the first redundant copy of A contributes its portion
+    vector<T> portion;
+    int slot = -1;
+    if( A.RedundantRank() == 0 )
+    {
+        slot = A.DistRank();
+        FastResize( portion, portionSize );
+        util::InterleaveMatrix
+        ( A.LocalHeight(), A.LocalWidth(),
+          A.LockedBuffer(), 1, A.LDim(),
+          portion.data(),   1, A.LocalHeight() );
+    }
+
+    const Int ldim = Max(height,1);
+    auto unpack = [&]( int s, const T* APortion, T* BBuf )
+      {
+          const Int colShift = Shift_( s % colStride, colAlign, colStride );
+          const Int rowShift = Shift_( s / colStride, rowAlign, rowStride );
+          const Int localHeight = Length_( height, colShift, colStride );
+          const Int localWidth = Length_( width, rowShift, rowStride );
+          util::InterleaveMatrix
+          ( localHeight, localWidth,
+            APortion, 1, localHeight,
+            &BBuf[colShift+rowShift*ldim], colStride, rowStride*ldim );
+      };
+    T* buffer;
+    std::shared_ptr<mpi::Window> window = B.SharedWindow();
+    util::SharedAllGather<T>
+    ( portion.data(), slot, A.DistSize(), portionSize,
+      g, g.NodeComm(), g.NodeLeaderComm(), ldim*width, unpack,
+      buffer, window );
+    B.AttachShared( height, width, g, 0, 0, buffer, ldim, std::move(window) );
+    return true;
+}
+
+// (U,V) |-> (Collect(U),V)
+template<typename T>
+bool ColAllGatherShared( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
+{
+    DEBUG_CSE
+    if( !UseSharedReplication( A, B ) || A.ColStride() == 1 )
+        return false;
+    // Hold onto the previous window (if any) so that it can be reused
+    std::shared_ptr<mpi::Window> window = B.SharedWindow();
+    // Only aligned redistributions are supported
+    B.AlignRowsAndResize( A.RowAlign(), 0, 0, false, false );
+    if( B.RowAlign() != A.RowAlign() )
+        return false;
+
+    const Grid& g = A.Grid();
+    const Int height = A.Height();
+    const Int width = A.Width();
+    const Int colStride = A.ColStride();
+    const Int colAlign = A.ColAlign();
+    const Int localWidth = A.LocalWidth();
+    const Int maxLocalHeight = MaxLength(height,colStride);
+    const Int portionSize = mpi::Pad( maxLocalHeight*localWidth );
+
+    vector<T> portion;
+    FastResize( portion, portionSize );
+    util::InterleaveMatrix
+    ( A.LocalHeight(), localWidth,
+      A.LockedBuffer(), 1, A.LDim(),
+      portion.data(),   1, A.LocalHeight() );
+
+    const Int ldim = Max(height,1);
+    auto unpack = [&]( int s, const T* APortion, T* BBuf )
+      {
+          const Int colShift = Shift_( s, colAlign, colStride );
+          const Int localHeight = Length_( height, colShift, colStride );
+          util::InterleaveMatrix
+          ( localHeight, localWidth,
+            APortion, 1, localHeight,
+            &BBuf[colShift], colStride, ldim );
+      };
+    T* buffer;
+    util::SharedAllGather<T>
+    ( portion.data(), A.ColRank(), colStride, portionSize,
+      g, DistNodeComm(g,A.ColDist()),
+      DistNodeLeaderComm(g,A.ColDist(),A.ColComm()), ldim*localWidth, unpack,
+      buffer, window );
+    B.AttachShared
+    ( height, width, g, 0, B.RowAlign(), buffer, ldim, std::move(window),
+      B.Root() );
+    return true;
+}
+
+// (U,V) |-> (U,Collect(V))
+template<typename T>
+bool RowAllGatherShared( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
+{
+    DEBUG_CSE
+    if( !UseSharedReplication( A, B ) || A.RowStride() == 1 )
+        return false;
+    // Hold onto the previous window (if any) so that it can be reused
+    std::shared_ptr<mpi::Window> window = B.SharedWindow();
+    // Only aligned redistributions are supported
+    B.AlignColsAndResize( A.ColAlign(), 0, 0, false, false );
+    if( B.ColAlign() != A.ColAlign() )
+        return false;
+
+    const Grid& g = A.Grid();
+    const Int height = A.Height();
+    const Int width = A.Width();
+    const Int rowStride = A.RowStride();
+    const Int rowAlign = A.RowAlign();
+    const Int localHeight = A.LocalHeight();
+    const Int maxLocalWidth = MaxLength(width,rowStride);
+    const Int portionSize = mpi::Pad( localHeight*maxLocalWidth );
+
+    vector<T> portion;
+    FastResize( portion, portionSize );
+    util::InterleaveMatrix
+    ( localHeight, A.LocalWidth(),
+      A.LockedBuffer(), 1, A.LDim(),
+      portion.data(),   1, localHeight );
+
+    const Int ldim = Max(localHeight,Int(1));
+    auto unpack = [&]( int s, const T* APortion, T* BBuf )
+      {
+          const Int rowShift = Shift_( s, rowAlign, rowStride );
+          const Int localWidth = Length_( width, rowShift, rowStride );
+          util::InterleaveMatrix
+          ( localHeight, localWidth,
+            APortion, 1, localHeight,
+            &BBuf[rowShift*ldim], 1, rowStride*ldim );
+      };
+    T* buffer;
+    util::SharedAllGather<T>
+    ( portion.data(), A.RowRank(), rowStride, portionSize,
+      g, DistNodeComm(g,A.RowDist()),
+      DistNodeLeaderComm(g,A.RowDist(),A.RowComm()), ldim*width, unpack,
+      buffer, window );
+    B.AttachShared
+    ( height, width, g, B.ColAlign(), 0, buffer, ldim, std::move(window),
+      B.Root() );
+    return true;
+}
+
+} // namespace copy
+} // namespace El
+
+#endif // ifndef EL_BLAS_COPY_SHAREDALLGATHER_HPP
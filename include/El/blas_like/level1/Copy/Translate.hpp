@@ -18,6 +18,7 @@ void Translate
         DistMatrix<T,U,V>& B ) 
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("copy::Translate")
     if( A.Grid() != B.Grid() )
     {
         copy::TranslateBetweenGrids( A, B );
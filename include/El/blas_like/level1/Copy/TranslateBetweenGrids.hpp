@@ -18,6 +18,7 @@ void TranslateBetweenGrids
         DistMatrix<T,U,V>& B ) 
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("copy::TranslateBetweenGrids")
     GeneralPurpose( A, B );
 }
 
@@ -17,6 +17,7 @@ template<typename T,Dist U,Dist V>
 void TransposeDist( const DistMatrix<T,U,V>& A, DistMatrix<T,V,U>& B ) 
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("copy::TransposeDist")
     AssertSameGrids( A, B );
 
     const Grid& g = B.Grid();
@@ -56,7 +57,7 @@ void TransposeDist( const DistMatrix<T,U,V>& A, DistMatrix<T,V,U>& B )
             // TODO: Use kernel from copy::util
             const Int AColShift = A.ColShift();
             const T* ABuf = A.LockedBuffer();
-            EL_PARALLEL_FOR
+            EL_PARALLEL_FOR_IF(ParallelizeWork<T>(rowStrideA*portionSize))
             for( Int k=0; k<rowStrideA; ++k )
             {
                 T* data = &recvBuf[k*portionSize];
@@ -91,7 +92,7 @@ void TransposeDist( const DistMatrix<T,U,V>& A, DistMatrix<T,V,U>& B )
             // Unpack
             // TODO: Use kernel from copy::util
             T* bufB = B.Buffer();
-            EL_PARALLEL_FOR
+            EL_PARALLEL_FOR_IF(ParallelizeWork<T>(colStrideA*portionSize))
             for( Int k=0; k<colStrideA; ++k )
             {
                 const T* data = &sendBuf[k*portionSize];
@@ -129,7 +130,7 @@ void TransposeDist( const DistMatrix<T,U,V>& A, DistMatrix<T,V,U>& B )
             // Pack
             // TODO: Use kernel from copy::util
             const T* ABuf = A.LockedBuffer();
-            EL_PARALLEL_FOR
+            EL_PARALLEL_FOR_IF(ParallelizeWork<T>(colStrideA*portionSize))
             for( Int k=0; k<colStrideA; ++k )
             {
                 T* data = &recvBuf[k*portionSize];
@@ -164,7 +165,7 @@ void TransposeDist( const DistMatrix<T,U,V>& A, DistMatrix<T,V,U>& B )
             // Unpack
             // TODO: Use kernel from copy::util
             T* bufB = B.Buffer();
-            EL_PARALLEL_FOR
+            EL_PARALLEL_FOR_IF(ParallelizeWork<T>(rowStrideA*portionSize))
             for( Int k=0; k<rowStrideA; ++k )
             {
                 const T* data = &sendBuf[k*portionSize];
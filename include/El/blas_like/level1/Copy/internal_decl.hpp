@@ -104,6 +104,16 @@ template<typename T>
 void PartialRowFilter
 ( const BlockMatrix<T>& A, BlockMatrix<T>& B );
 
+// All-gathers whose results are stored once per node (see
+// SetSharedReplication); they return false, without communicating, if they
+// do not apply to the pair of matrices
+template<typename T>
+bool AllGatherShared( const ElementalMatrix<T>& A, ElementalMatrix<T>& B );
+template<typename T>
+bool ColAllGatherShared( const ElementalMatrix<T>& A, ElementalMatrix<T>& B );
+template<typename T>
+bool RowAllGatherShared( const ElementalMatrix<T>& A, ElementalMatrix<T>& B );
+
 template<typename T,Dist U,Dist V>
 void AllGather
 ( const DistMatrix<T,        U,           V   >& A, 
@@ -9,6 +9,8 @@
 #ifndef EL_BLAS1_COPY_INTERNAL_IMPL_HPP
 #define EL_BLAS1_COPY_INTERNAL_IMPL_HPP
 
+#include <El/blas_like/level1/Copy/SharedAllGather.hpp>
+
 #include <El/blas_like/level1/Copy/AllGather.hpp>
 #include <El/blas_like/level1/Copy/ColAllGather.hpp>
 #include <El/blas_like/level1/Copy/ColAllToAllDemote.hpp>
@@ -13,15 +13,26 @@ namespace El {
 namespace copy {
 namespace util {
 
+// All of the packing and unpacking routines below are built on top of
+// InterleaveMatrix, whose columns are copied by separate threads when the
+// matrix is large enough (see NumParallelChunks)
 template<typename T>
 void InterleaveMatrix
 ( Int height, Int width,
   const T* A, Int colStrideA, Int rowStrideA,
         T* B, Int colStrideB, Int rowStrideB )
 {
+    const bool parallel = ( width > 1 && ParallelizeWork<T>(height*width) );
     if( colStrideA == 1 && colStrideB == 1 )
     {
-        lapack::Copy( 'F', height, width, A, rowStrideA, B, rowStrideB );
+        if( parallel )
+        {
+            EL_PARALLEL_FOR
+            for( Int j=0; j<width; ++j )
+                MemCopy( &B[j*rowStrideB], &A[j*rowStrideA], height );
+        }
+        else
+            lapack::Copy( 'F', height, width, A, rowStrideA, B, rowStrideB );
     }
     else
     {
@@ -31,6 +42,7 @@ void InterleaveMatrix
           A, rowStrideA, colStrideA,
           B, rowStrideB, colStrideB );
 #else
+        EL_PARALLEL_FOR_IF(parallel)
         for( Int j=0; j<width; ++j )
             StridedMemCopy
             ( &B[j*rowStrideB], colStrideB,
@@ -190,10 +202,10 @@ void RowStridedPack
     {
         const Int rowShift = Shift_( k, rowAlign, rowStride );
         const Int localWidth = Length_( width, rowShift, rowStride );
-        lapack::Copy
-        ( 'F', height, localWidth, 
-          &A[rowShift*ALDim],        rowStride*ALDim,
-          &BPortions[k*portionSize], height );
+        InterleaveMatrix
+        ( height, localWidth,
+          &A[rowShift*ALDim],        1, rowStride*ALDim,
+          &BPortions[k*portionSize], 1, height );
     }
 }
 
@@ -208,10 +220,10 @@ void RowStridedUnpack
     {
         const Int rowShift = Shift_( k, rowAlign, rowStride );
         const Int localWidth = Length_( width, rowShift, rowStride );
-        lapack::Copy
-        ( 'F', height, localWidth,
-          &APortions[k*portionSize], height,
-          &B[rowShift*BLDim],        rowStride*BLDim );
+        InterleaveMatrix
+        ( height, localWidth,
+          &APortions[k*portionSize], 1, height,
+          &B[rowShift*BLDim],        1, rowStride*BLDim );
     }
 }
 
@@ -230,10 +242,10 @@ void PartialRowStridedPack
             Shift_( rowRankPart+k*rowStridePart, rowAlign, rowStride );
         const Int rowOffset = (rowShift-rowShiftA) / rowStridePart;
         const Int localWidth = Length_( width, rowShift, rowStride );
-        lapack::Copy
-        ( 'F', height, localWidth,
-          &A[rowOffset*ALDim],       rowStrideUnion*ALDim,
-          &BPortions[k*portionSize], height );
+        InterleaveMatrix
+        ( height, localWidth,
+          &A[rowOffset*ALDim],       1, rowStrideUnion*ALDim,
+          &BPortions[k*portionSize], 1, height );
     }
 }
 template<typename T>
@@ -251,10 +263,10 @@ void PartialRowStridedUnpack
             Shift_( rowRankPart+k*rowStridePart, rowAlign, rowStride );
         const Int rowOffset = (rowShift-rowShiftB) / rowStridePart;
         const Int localWidth = Length_( width, rowShift, rowStride );
-        lapack::Copy
-        ( 'F', height, localWidth,
-          &APortions[k*portionSize], height,
-          &B[rowOffset*BLDim],       rowStrideUnion*BLDim );
+        InterleaveMatrix
+        ( height, localWidth,
+          &APortions[k*portionSize], 1, height,
+          &B[rowOffset*BLDim],       1, rowStrideUnion*BLDim );
     }
 }
 
@@ -0,0 +1,475 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BLAS_COPYASYNC_HPP
+#define EL_BLAS_COPYASYNC_HPP
+
+namespace El {
+
+template<typename T>
+CopyRequest<T>::CopyRequest( CopyRequest<T>&& req )
+: pending(req.pending), request(std::move(req.request)),
+  buffer(std::move(req.buffer)), unpack(std::move(req.unpack))
+{ req.pending = false; }
+
+template<typename T>
+CopyRequest<T>& CopyRequest<T>::operator=( CopyRequest<T>&& req )
+{
+    if( this != &req )
+    {
+        if( pending )
+            Wait();
+        pending = req.pending;
+        request = std::move(req.request);
+        buffer = std::move(req.buffer);
+        unpack = std::move(req.unpack);
+        req.pending = false;
+    }
+    return *this;
+}
+
+template<typename T>
+CopyRequest<T>::~CopyRequest()
+{
+    if( pending )
+        Wait();
+}
+
+template<typename T>
+bool CopyRequest<T>::Test()
+{
+    DEBUG_CSE
+    if( pending )
+    {
+        if( !mpi::Test( request ) )
+            return false;
+        // Completing via Wait ensures that serialized data is unpacked
+        Wait();
+    }
+    return true;
+}
+
+template<typename T>
+void CopyRequest<T>::Wait()
+{
+    DEBUG_CSE
+    if( pending )
+    {
+        mpi::Wait( request );
+        pending = false;
+        if( unpack )
+            unpack();
+        SwapClear( buffer );
+    }
+}
+
+namespace copy {
+
+// The nonblocking analogues of the aligned cases of the specialized
+// redistributions. Each returns false (after aligning B where it is not
+// constrained) if A and B are not aligned, or if A is not stored by every
+// process (e.g., [MD,STAR]), in which case the caller should fall back to the
+// blocking redistribution.
+
+// (U,V) |-> (Collect(U),V)
+template<typename T>
+bool ColAllGatherAsync
+( const ElementalMatrix<T>& A, ElementalMatrix<T>& B, CopyRequest<T>& req )
+{
+    DEBUG_CSE
+    const Int height = A.Height();
+    const Int width = A.Width();
+    B.AlignRowsAndResize( A.RowAlign(), height, width, false, false );
+    if( B.RowAlign() != A.RowAlign() )
+        return false;
+    // The blocking redistribution completes by broadcasting over the cross
+    // communicator (e.g., from the diagonal of an [MD,STAR] matrix to the
+    // processes off of it), which is not overlapped
+    if( A.CrossSize() != 1 )
+        return false;
+    if( !A.Participating() )
+        return true;
+
+    const Int colStride = A.ColStride();
+    ElementalMatrix<T>* BPtr = &B;
+    if( colStride == 1 )
+    {
+        Copy( A.LockedMatrix(), B.Matrix() );
+    }
+    else if( height == 1 )
+    {
+        const Int localWidthB = B.LocalWidth();
+        FastResize( req.buffer, localWidthB );
+        T* bcastBuf = req.buffer.data();
+        if( A.ColRank() == A.ColAlign() )
+            StridedMemCopy
+            ( bcastBuf, 1, A.LockedBuffer(), A.LDim(), localWidthB );
+        mpi::IBroadcast
+        ( bcastBuf, localWidthB, A.ColAlign(), A.ColComm(), req.request );
+        req.unpack = [=]()
+          { StridedMemCopy
+            ( BPtr->Buffer(), BPtr->LDim(), bcastBuf, 1, localWidthB ); };
+        req.pending = true;
+    }
+    else
+    {
+        const Int maxLocalHeight = MaxLength(height,colStride);
+        const Int localWidth = A.LocalWidth();
+        const Int portionSize = mpi::Pad( maxLocalHeight*localWidth );
+        const Int colAlign = A.ColAlign();
+
+        FastResize( req.buffer, (colStride+1)*portionSize );
+        T* sendBuf = &req.buffer[0];
+        T* recvBuf = &req.buffer[portionSize];
+
+        util::InterleaveMatrix
+        ( A.LocalHeight(), localWidth,
+          A.LockedBuffer(), 1, A.LDim(),
+          sendBuf,          1, A.LocalHeight() );
+        mpi::IAllGather
+        ( sendBuf, portionSize, recvBuf, portionSize, A.ColComm(),
+          req.request );
+        req.unpack = [=]()
+          { util::ColStridedUnpack
+            ( height, localWidth, colAlign, colStride,
+              recvBuf,         portionSize,
+              BPtr->Buffer(), BPtr->LDim() ); };
+        req.pending = true;
+    }
+    return true;
+}
+
+// (U,V) |-> (U,Collect(V))
+template<typename T>
+bool RowAllGatherAsync
+( const ElementalMatrix<T>& A, ElementalMatrix<T>& B, CopyRequest<T>& req )
+{
+    DEBUG_CSE
+    const Int height = A.Height();
+    const Int width = A.Width();
+    B.AlignColsAndResize( A.ColAlign(), height, width, false, false );
+    if( B.ColAlign() != A.ColAlign() )
+        return false;
+    // The blocking redistribution completes by broadcasting over the cross
+    // communicator (e.g., from the diagonal of an [MD,STAR] matrix to the
+    // processes off of it), which is not overlapped
+    if( A.CrossSize() != 1 )
+        return false;
+    if( !A.Participating() )
+        return true;
+
+    const Int rowStride = A.RowStride();
+    ElementalMatrix<T>* BPtr = &B;
+    if( rowStride == 1 )
+    {
+        Copy( A.LockedMatrix(), B.Matrix() );
+    }
+    else if( width == 1 )
+    {
+        // Broadcast directly into the (single) local column of B
+        if( A.RowRank() == A.RowAlign() )
+            B.Matrix() = A.LockedMatrix();
+        mpi::IBroadcast
+        ( B.Buffer(), B.LocalHeight(), A.RowAlign(), A.RowComm(),
+          req.request );
+        req.pending = true;
+    }
+    else
+    {
+        const Int localHeight = A.LocalHeight();
+        const Int maxLocalWidth = MaxLength(width,rowStride);
+        const Int portionSize = mpi::Pad( localHeight*maxLocalWidth );
+        const Int rowAlign = A.RowAlign();
+
+        FastResize( req.buffer, (rowStride+1)*portionSize );
+        T* sendBuf = &req.buffer[0];
+        T* recvBuf = &req.buffer[portionSize];
+
+        util::InterleaveMatrix
+        ( localHeight, A.LocalWidth(),
+          A.LockedBuffer(), 1, A.LDim(),
+          sendBuf,          1, localHeight );
+        mpi::IAllGather
+        ( sendBuf, portionSize, recvBuf, portionSize, A.RowComm(),
+          req.request );
+        req.unpack = [=]()
+          { util::RowStridedUnpack
+            ( localHeight, width, rowAlign, rowStride,
+              recvBuf,        portionSize,
+              BPtr->Buffer(), BPtr->LDim() ); };
+        req.pending = true;
+    }
+    return true;
+}
+
+// (U,V) |-> (Partial(U),PartialUnionRow(U,V))
+template<typename T>
+bool ColAllToAllPromoteAsync
+( const ElementalMatrix<T>& A, ElementalMatrix<T>& B, CopyRequest<T>& req )
+{
+    DEBUG_CSE
+    const Int height = A.Height();
+    const Int width = A.Width();
+    B.AlignColsAndResize
+    ( Mod(A.ColAlign(),B.ColStride()), height, width, false, false );
+    if( !B.Participating() )
+        return true;
+
+    const Int colStride = A.ColStride();
+    const Int colStridePart = A.PartialColStride();
+    const Int colStrideUnion = A.PartialUnionColStride();
+    const Int colRankPart = A.PartialColRank();
+    if( B.ColAlign() != Mod(A.ColAlign(),colStridePart) )
+        return false;
+    if( colStrideUnion == 1 )
+    {
+        Copy( A.LockedMatrix(), B.Matrix() );
+        return true;
+    }
+
+    const Int maxLocalHeight = MaxLength(height,colStride);
+    const Int maxLocalWidth = MaxLength(width,colStrideUnion);
+    const Int portionSize = mpi::Pad( maxLocalHeight*maxLocalWidth );
+    const Int colAlignA = A.ColAlign();
+    const Int colShiftB = B.ColShift();
+    const Int localWidthB = B.LocalWidth();
+
+    FastResize( req.buffer, 2*colStrideUnion*portionSize );
+    T* firstBuf  = &req.buffer[0];
+    T* secondBuf = &req.buffer[colStrideUnion*portionSize];
+
+    util::RowStridedPack
+    ( A.LocalHeight(), width,
+      B.RowAlign(), colStrideUnion,
+      A.LockedBuffer(), A.LDim(),
+      firstBuf,         portionSize );
+    mpi::IAllToAll
+    ( firstBuf,  portionSize,
+      secondBuf, portionSize, A.PartialUnionColComm(), req.request );
+    ElementalMatrix<T>* BPtr = &B;
+    req.unpack = [=]()
+      { util::PartialColStridedUnpack
+        ( height, localWidthB,
+          colAlignA, colStride,
+          colStrideUnion, colStridePart, colRankPart,
+          colShiftB,
+          secondBuf,      portionSize,
+          BPtr->Buffer(), BPtr->LDim() ); };
+    req.pending = true;
+    return true;
+}
+
+// (U,V) |-> (PartialUnionCol(U,V),Partial(V))
+template<typename T>
+bool RowAllToAllPromoteAsync
+( const ElementalMatrix<T>& A, ElementalMatrix<T>& B, CopyRequest<T>& req )
+{
+    DEBUG_CSE
+    const Int height = A.Height();
+    const Int width = A.Width();
+    B.AlignRowsAndResize
+    ( Mod(A.RowAlign(),B.RowStride()), height, width, false, false );
+    if( !B.Participating() )
+        return true;
+
+    const Int rowStride = A.RowStride();
+    const Int rowStridePart = A.PartialRowStride();
+    const Int rowStrideUnion = A.PartialUnionRowStride();
+    const Int rowRankPart = A.PartialRowRank();
+    if( B.RowAlign() != Mod(A.RowAlign(),rowStridePart) )
+        return false;
+    if( rowStrideUnion == 1 )
+    {
+        Copy( A.LockedMatrix(), B.Matrix() );
+        return true;
+    }
+
+    const Int maxLocalWidth = MaxLength(width,rowStride);
+    const Int maxLocalHeight = MaxLength(height,rowStrideUnion);
+    const Int portionSize = mpi::Pad( maxLocalHeight*maxLocalWidth );
+    const Int rowAlignA = A.RowAlign();
+    const Int rowShiftB = B.RowShift();
+    const Int localHeightB = B.LocalHeight();
+
+    FastResize( req.buffer, 2*rowStrideUnion*portionSize );
+    T* firstBuf  = &req.buffer[0];
+    T* secondBuf = &req.buffer[rowStrideUnion*portionSize];
+
+    util::ColStridedPack
+    ( height, A.LocalWidth(),
+      B.ColAlign(), rowStrideUnion,
+      A.LockedBuffer(), A.LDim(),
+      firstBuf,         portionSize );
+    mpi::IAllToAll
+    ( firstBuf,  portionSize,
+      secondBuf, portionSize, A.PartialUnionRowComm(), req.request );
+    ElementalMatrix<T>* BPtr = &B;
+    req.unpack = [=]()
+      { util::PartialRowStridedUnpack
+        ( localHeightB, width,
+          rowAlignA, rowStride,
+          rowStrideUnion, rowStridePart, rowRankPart,
+          rowShiftB,
+          secondBuf,      portionSize,
+          BPtr->Buffer(), BPtr->LDim() ); };
+    req.pending = true;
+    return true;
+}
+
+// (Partial(U),PartialUnionRow(U,V)) |-> (U,V)
+template<typename T>
+bool ColAllToAllDemoteAsync
+( const ElementalMatrix<T>& A, ElementalMatrix<T>& B, CopyRequest<T>& req )
+{
+    DEBUG_CSE
+    const Int height = A.Height();
+    const Int width = A.Width();
+    B.AlignColsAndResize( A.ColAlign(), height, width, false, false );
+    if( !B.Participating() )
+        return true;
+
+    const Int colAlign = B.ColAlign();
+    const Int colStride = B.ColStride();
+    const Int colStridePart = B.PartialColStride();
+    const Int colStrideUnion = B.PartialUnionColStride();
+    const Int colRankPart = B.PartialColRank();
+    if( Mod(colAlign,colStridePart) != A.ColAlign() )
+        return false;
+    if( colStrideUnion == 1 )
+    {
+        Copy( A.LockedMatrix(), B.Matrix() );
+        return true;
+    }
+
+    const Int maxLocalHeight = MaxLength(height,colStride);
+    const Int maxLocalWidth = MaxLength(width,colStrideUnion);
+    const Int portionSize = mpi::Pad( maxLocalHeight*maxLocalWidth );
+    const Int rowAlignA = A.RowAlign();
+    const Int localHeightB = B.LocalHeight();
+
+    FastResize( req.buffer, 2*colStrideUnion*portionSize );
+    T* firstBuf  = &req.buffer[0];
+    T* secondBuf = &req.buffer[colStrideUnion*portionSize];
+
+    util::PartialColStridedPack
+    ( height, A.LocalWidth(),
+      colAlign, colStride,
+      colStrideUnion, colStridePart, colRankPart,
+      A.ColShift(),
+      A.LockedBuffer(), A.LDim(),
+      firstBuf,         portionSize );
+    mpi::IAllToAll
+    ( firstBuf,  portionSize,
+      secondBuf, portionSize, B.PartialUnionColComm(), req.request );
+    ElementalMatrix<T>* BPtr = &B;
+    req.unpack = [=]()
+      { util::RowStridedUnpack
+        ( localHeightB, width,
+          rowAlignA, colStrideUnion,
+          secondBuf,      portionSize,
+          BPtr->Buffer(), BPtr->LDim() ); };
+    req.pending = true;
+    return true;
+}
+
+// (PartialUnionCol(U,V),Partial(V)) |-> (U,V)
+template<typename T>
+bool RowAllToAllDemoteAsync
+( const ElementalMatrix<T>& A, ElementalMatrix<T>& B, CopyRequest<T>& req )
+{
+    DEBUG_CSE
+    const Int height = A.Height();
+    const Int width = A.Width();
+    B.AlignRowsAndResize( A.RowAlign(), height, width, false, false );
+    if( !B.Participating() )
+        return true;
+
+    const Int rowAlign = B.RowAlign();
+    const Int rowStride = B.RowStride();
+    const Int rowStridePart = B.PartialRowStride();
+    const Int rowStrideUnion = B.PartialUnionRowStride();
+    const Int rowRankPart = B.PartialRowRank();
+    if( Mod(rowAlign,rowStridePart) != A.RowAlign() )
+        return false;
+    if( rowStrideUnion == 1 )
+    {
+        Copy( A.LockedMatrix(), B.Matrix() );
+        return true;
+    }
+
+    const Int maxLocalHeight = MaxLength(height,rowStrideUnion);
+    const Int maxLocalWidth = MaxLength(width,rowStride);
+    const Int portionSize = mpi::Pad( maxLocalHeight*maxLocalWidth );
+    const Int colAlignA = A.ColAlign();
+    const Int localWidthB = B.LocalWidth();
+
+    FastResize( req.buffer, 2*rowStrideUnion*portionSize );
+    T* firstBuf  = &req.buffer[0];
+    T* secondBuf = &req.buffer[rowStrideUnion*portionSize];
+
+    util::PartialRowStridedPack
+    ( A.LocalHeight(), width,
+      rowAlign, rowStride,
+      rowStrideUnion, rowStridePart, rowRankPart,
+      A.RowShift(),
+      A.LockedBuffer(), A.LDim(),
+      firstBuf,         portionSize );
+    mpi::IAllToAll
+    ( firstBuf,  portionSize,
+      secondBuf, portionSize, B.PartialUnionRowComm(), req.request );
+    ElementalMatrix<T>* BPtr = &B;
+    req.unpack = [=]()
+      { util::ColStridedUnpack
+        ( height, localWidthB,
+          colAlignA, rowStrideUnion,
+          secondBuf,      portionSize,
+          BPtr->Buffer(), BPtr->LDim() ); };
+    req.pending = true;
+    return true;
+}
+
+} // namespace copy
+
+template<typename T>
+CopyRequest<T> CopyAsync( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
+{
+    DEBUG_CSE
+    CopyRequest<T> req;
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    if( A.Grid() == B.Grid() )
+    {
+        const Dist U=A.ColDist(), V=A.RowDist(),
+                   UB=B.ColDist(), VB=B.RowDist();
+        bool started = false;
+        if( U != STAR && U != CIRC && UB == Collect(U) && VB == V )
+            started = copy::ColAllGatherAsync( A, B, req );
+        else if( V != STAR && V != CIRC && UB == U && VB == Collect(V) )
+            started = copy::RowAllGatherAsync( A, B, req );
+        else if( Partial(U) != U &&
+                 UB == Partial(U) && VB == PartialUnionRow(U,V) )
+            started = copy::ColAllToAllPromoteAsync( A, B, req );
+        else if( Partial(V) != V &&
+                 UB == PartialUnionCol(U,V) && VB == Partial(V) )
+            started = copy::RowAllToAllPromoteAsync( A, B, req );
+        else if( Partial(UB) != UB &&
+                 U == Partial(UB) && V == PartialUnionRow(UB,VB) )
+            started = copy::ColAllToAllDemoteAsync( A, B, req );
+        else if( Partial(VB) != VB &&
+                 U == PartialUnionCol(UB,VB) && V == Partial(VB) )
+            started = copy::RowAllToAllDemoteAsync( A, B, req );
+        if( started )
+            return req;
+    }
+#endif
+    Copy( A, B );
+    return req;
+}
+
+} // namespace El
+
+#endif // ifndef EL_BLAS_COPYASYNC_HPP
@@ -32,6 +32,79 @@ T Dot( const DistMultiVec<T>& A, const DistMultiVec<T>& B )
     return HilbertSchmidt( A, B );
 }
 
+template<typename F>
+Int QueueDot
+( const ElementalMatrix<F>& A, const ElementalMatrix<F>& B,
+  DeferredReduction<Base<F>>& reduction )
+{
+    DEBUG_CSE
+    if( A.Height() != B.Height() || A.Width() != B.Width() )
+        LogicError("Matrices must be the same size");
+    AssertSameGrids( A, B );
+    if( A.DistData().colDist != B.DistData().colDist ||
+        A.DistData().rowDist != B.DistData().rowDist )
+        LogicError("A and B must have the same distribution");
+    if( A.ColAlign() != B.ColAlign() || A.RowAlign() != B.RowAlign() )
+        LogicError("Matrices must be aligned");
+
+    // Only the first redundant copy of the participating processes contributes
+    const bool contribute = A.Participating() && A.RedundantRank() == 0;
+    if( UseReproducibleSum<F>() )
+    {
+        const Int localHeight = A.LocalHeight();
+        const F* ABuf = A.LockedBuffer();
+        const F* BBuf = B.LockedBuffer();
+        const Int ALDim = A.LDim();
+        const Int BLDim = B.LDim();
+        auto term = [&]( Int k )
+          {
+              const Int iLoc = k % localHeight;
+              const Int jLoc = k / localHeight;
+              return Conj(ABuf[iLoc+jLoc*ALDim])*BBuf[iLoc+jLoc*BLDim];
+          };
+        const Int numLocalTerms =
+          ( contribute ? localHeight*A.LocalWidth() : 0 );
+        return QueueReproducibleSum<F>( numLocalTerms, term, reduction );
+    }
+
+    F localInnerProd(0);
+    if( contribute )
+        localInnerProd = HilbertSchmidt( A.LockedMatrix(), B.LockedMatrix() );
+    return reduction.QueueSum( localInnerProd );
+}
+
+template<typename F>
+Int QueueDot
+( const DistMultiVec<F>& A, const DistMultiVec<F>& B,
+  DeferredReduction<Base<F>>& reduction )
+{
+    DEBUG_CSE
+    if( A.Height() != B.Height() || A.Width() != B.Width() )
+        LogicError("A and B must have the same dimensions");
+    if( A.LocalHeight() != B.LocalHeight() )
+        LogicError("A and B must have the same local heights");
+    if( A.FirstLocalRow() != B.FirstLocalRow() )
+        LogicError("A and B must own the same rows");
+    if( UseReproducibleSum<F>() )
+    {
+        const Int localHeight = A.LocalHeight();
+        const F* ABuf = A.LockedMatrix().LockedBuffer();
+        const F* BBuf = B.LockedMatrix().LockedBuffer();
+        const Int ALDim = A.LockedMatrix().LDim();
+        const Int BLDim = B.LockedMatrix().LDim();
+        auto term = [&]( Int k )
+          {
+              const Int iLoc = k % localHeight;
+              const Int j = k / localHeight;
+              return Conj(ABuf[iLoc+j*ALDim])*BBuf[iLoc+j*BLDim];
+          };
+        return QueueReproducibleSum<F>
+          ( localHeight*A.Width(), term, reduction );
+    }
+    return reduction.QueueSum
+      ( HilbertSchmidt( A.LockedMatrix(), B.LockedMatrix() ) );
+}
+
 // TODO: Think about using a more stable accumulation algorithm?
 
 template<typename T> 
@@ -40,12 +113,37 @@ T Dotu( const Matrix<T>& A, const Matrix<T>& B )
     DEBUG_CSE
     if( A.Height() != B.Height() || A.Width() != B.Width() )
         LogicError("Matrices must be the same size");
-    T sum(0);
     const Int width = A.Width();
     const Int height = A.Height();
-    for( Int j=0; j<width; ++j )
-        for( Int i=0; i<height; ++i )
-            sum += A(i,j)*B(i,j);
+    const T* ABuf = A.LockedBuffer();
+    const T* BBuf = B.LockedBuffer();
+    const Int ALDim = A.LDim();
+    const Int BLDim = B.LDim();
+    if( UseReproducibleSum<T>() )
+    {
+        auto term = [&]( Int k )
+          {
+              const Int i = k % height;
+              const Int j = k / height;
+              return ABuf[i+j*ALDim]*BBuf[i+j*BLDim];
+          };
+        return ReproducibleSum<T>( height*width, term, mpi::COMM_SELF );
+    }
+
+    const Int numChunks = Min( NumParallelChunks<T>(height*width), width );
+    vector<T> partials( numChunks, T(0) );
+    EL_PARALLEL_FOR_IF(numChunks > 1)
+    for( Int chunk=0; chunk<numChunks; ++chunk )
+    {
+        const Int jStart = (chunk*width) / numChunks;
+        const Int jEnd = ((chunk+1)*width) / numChunks;
+        for( Int j=jStart; j<jEnd; ++j )
+            for( Int i=0; i<height; ++i )
+                partials[chunk] += ABuf[i+j*ALDim]*BBuf[i+j*BLDim];
+    }
+    T sum(0);
+    for( Int chunk=0; chunk<numChunks; ++chunk )
+        sum += partials[chunk];
     return sum;
 }
 
@@ -66,15 +164,29 @@ T Dotu( const ElementalMatrix<T>& A, const ElementalMatrix<T>& B )
     T innerProd;
     if( A.Participating() )
     {
-        T localInnerProd(0);
         auto& ALoc = A.LockedMatrix();
         auto& BLoc = B.LockedMatrix();
         const Int localHeight = A.LocalHeight();
         const Int localWidth = A.LocalWidth();
-        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-                localInnerProd += ALoc(iLoc,jLoc)*BLoc(iLoc,jLoc);
-        innerProd = mpi::AllReduce( localInnerProd, A.DistComm() );
+        if( UseReproducibleSum<T>() )
+        {
+            auto term = [&]( Int k )
+              {
+                  const Int iLoc = k % localHeight;
+                  const Int jLoc = k / localHeight;
+                  return ALoc(iLoc,jLoc)*BLoc(iLoc,jLoc);
+              };
+            innerProd = ReproducibleSum<T>
+              ( localHeight*localWidth, term, A.DistComm() );
+        }
+        else
+        {
+            T localInnerProd(0);
+            for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+                for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                    localInnerProd += ALoc(iLoc,jLoc)*BLoc(iLoc,jLoc);
+            innerProd = mpi::AllReduce( localInnerProd, A.DistComm() );
+        }
     }
     mpi::Broadcast( innerProd, A.Root(), A.CrossComm() );
     return innerProd;
@@ -98,6 +210,16 @@ T Dotu( const DistMultiVec<T>& A, const DistMultiVec<T>& B )
     const Int width = A.Width();
     auto& ALoc = A.LockedMatrix();
     auto& BLoc = B.LockedMatrix();
+    if( UseReproducibleSum<T>() )
+    {
+        auto term = [&]( Int k )
+          {
+              const Int iLoc = k % localHeight;
+              const Int j = k / localHeight;
+              return ALoc(iLoc,j)*BLoc(iLoc,j);
+          };
+        return ReproducibleSum<T>( localHeight*width, term, A.Comm() );
+    }
     for( Int j=0; j<width; ++j )
         for( Int iLoc=0; iLoc<localHeight; ++iLoc )    
             localInnerProd += ALoc(iLoc,j)*BLoc(iLoc,j);
@@ -131,6 +253,21 @@ T Dotu( const DistMultiVec<T>& A, const DistMultiVec<T>& B )
 #define EL_ENABLE_BIGFLOAT
 #include <El/macros/Instantiate.h>
 
+#define PROTO(F) \
+  EL_EXTERN template Int QueueDot \
+  ( const ElementalMatrix<F>& A, const ElementalMatrix<F>& B, \
+    DeferredReduction<Base<F>>& reduction ); \
+  EL_EXTERN template Int QueueDot \
+  ( const DistMultiVec<F>& A, const DistMultiVec<F>& B, \
+    DeferredReduction<Base<F>>& reduction );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
 #undef EL_EXTERN
 
 } // namespace El
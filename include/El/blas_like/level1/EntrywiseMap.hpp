@@ -19,6 +19,9 @@ void EntrywiseMap( Matrix<T>& A, function<T(T)> func )
     const Int n = A.Width();
     T* ABuf = A.Buffer();
     const Int ALDim = A.LDim();
+    // The map is only threaded for packed types, whose maps are assumed to
+    // be thread-safe
+    EL_PARALLEL_FOR_IF(ParallelizeWork<T>(m*n))
     for( Int j=0; j<n; ++j )
         for( Int i=0; i<m; ++i )
             ABuf[i+j*ALDim] = func(ABuf[i+j*ALDim]);
@@ -64,6 +67,8 @@ void EntrywiseMap( const Matrix<S>& A, Matrix<T>& B, function<T(S)> func )
     B.Resize( m, n );
     T* BBuf = B.Buffer();
     const Int BLDim = B.LDim();
+    EL_PARALLEL_FOR_IF
+    (IsPacked<S>::value && ParallelizeWork<T>(m*n))
     for( Int j=0; j<n; ++j )
         for( Int i=0; i<m; ++i )
             BBuf[i+j*BLDim] = func(ABuf[i+j*ALDim]);
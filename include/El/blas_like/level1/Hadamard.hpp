@@ -23,9 +23,16 @@ void Hadamard( const Matrix<T>& A, const Matrix<T>& B, Matrix<T>& C )
 
     const Int height = A.Height();
     const Int width = A.Width();
+    const T* ABuf = A.LockedBuffer();
+    const T* BBuf = B.LockedBuffer();
+          T* CBuf = C.Buffer();
+    const Int ALDim = A.LDim();
+    const Int BLDim = B.LDim();
+    const Int CLDim = C.LDim();
+    EL_PARALLEL_FOR_IF(ParallelizeWork<T>(height*width))
     for( Int j=0; j<width; ++j )
         for( Int i=0; i<height; ++i )
-            C(i,j) = A(i,j)*B(i,j);
+            CBuf[i+j*CLDim] = ABuf[i+j*ALDim]*BBuf[i+j*BLDim];
 }
 
 template<typename T> 
@@ -22,7 +22,7 @@ void MakeTrapezoidal( UpperOrLower uplo, Matrix<T>& A, Int offset )
 
     if( uplo == LOWER )
     {
-        EL_PARALLEL_FOR
+        EL_PARALLEL_FOR_IF(ParallelizeWork<T>(height*width))
         for( Int j=Max(0,offset+1); j<width; ++j )
         {
             const Int lastZeroRow = j-offset-1;
@@ -32,7 +32,7 @@ void MakeTrapezoidal( UpperOrLower uplo, Matrix<T>& A, Int offset )
     }
     else
     {
-        EL_PARALLEL_FOR
+        EL_PARALLEL_FOR_IF(ParallelizeWork<T>(height*width))
         for( Int j=0; j<width; ++j )
         {
             const Int firstZeroRow = Max(j-offset+1,0);
@@ -56,7 +56,7 @@ MakeTrapezoidal( UpperOrLower uplo, AbstractDistMatrix<T>& A, Int offset )
 
     if( uplo == LOWER )
     {
-        EL_PARALLEL_FOR
+        EL_PARALLEL_FOR_IF(ParallelizeWork<T>(localHeight*localWidth))
         for( Int jLoc=0; jLoc<localWidth; ++jLoc )
         {
             const Int j = A.GlobalCol(jLoc);
@@ -71,7 +71,7 @@ MakeTrapezoidal( UpperOrLower uplo, AbstractDistMatrix<T>& A, Int offset )
     }
     else
     {
-        EL_PARALLEL_FOR
+        EL_PARALLEL_FOR_IF(ParallelizeWork<T>(localHeight*localWidth))
         for( Int jLoc=0; jLoc<localWidth; ++jLoc )
         {
             const Int j = A.GlobalCol(jLoc);
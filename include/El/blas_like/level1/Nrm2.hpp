@@ -16,6 +16,12 @@ template<typename F>
 Base<F> FrobeniusNorm( const AbstractDistMatrix<F>& A );
 template<typename F>
 Base<F> FrobeniusNorm( const DistMultiVec<F>& A );
+template<typename F>
+Int QueueFrobeniusNorm
+( const AbstractDistMatrix<F>& A, DeferredReduction<Base<F>>& reduction );
+template<typename F>
+Int QueueFrobeniusNorm
+( const DistMultiVec<F>& A, DeferredReduction<Base<F>>& reduction );
 
 template<typename F>
 Base<F> Nrm2( const Matrix<F>& x )
@@ -25,12 +31,42 @@ Base<F> Nrm2( const Matrix<F>& x )
       if( x.Height() != 1 && x.Width() != 1 )
           LogicError("Expected vector input");
     )
-    Base<F> norm;
-    if( x.Width() == 1 )
-        norm = blas::Nrm2( x.Height(), x.LockedBuffer(), 1 );
-    else
-        norm = blas::Nrm2( x.Width(), x.LockedBuffer(), x.LDim() );
-    return norm;
+    typedef Base<F> Real;
+    const Int length = ( x.Width() == 1 ? x.Height() : x.Width() );
+    const Int stride = ( x.Width() == 1 ? 1 : x.LDim() );
+    const F* xBuf = x.LockedBuffer();
+    if( UseReproducibleSum<F>() )
+    {
+        auto entry = [&]( Int k ) { return xBuf[k*stride]; };
+        return ReproducibleNorm<F>( length, entry, mpi::COMM_SELF );
+    }
+    const Int numChunks = NumParallelChunks<F>( length );
+    if( numChunks == 1 )
+        return blas::Nrm2( length, xBuf, stride );
+
+    // Combine the norms of the chunks relative to the largest of them to
+    // avoid overflow and underflow
+    vector<Real> chunkNorms( numChunks );
+    EL_PARALLEL_FOR
+    for( Int chunk=0; chunk<numChunks; ++chunk )
+    {
+        const Int start = (chunk*length) / numChunks;
+        const Int end = ((chunk+1)*length) / numChunks;
+        chunkNorms[chunk] =
+          blas::Nrm2( end-start, &xBuf[start*stride], stride );
+    }
+    Real scale = 0;
+    for( Int chunk=0; chunk<numChunks; ++chunk )
+        scale = Max( scale, chunkNorms[chunk] );
+    if( scale == Real(0) )
+        return scale;
+    Real scaledSquare = 0;
+    for( Int chunk=0; chunk<numChunks; ++chunk )
+    {
+        const Real ratio = chunkNorms[chunk] / scale;
+        scaledSquare += ratio*ratio;
+    }
+    return scale*Sqrt(scaledSquare);
 }
 
 template<typename F>
@@ -55,6 +91,30 @@ Base<F> Nrm2( const DistMultiVec<F>& x )
     return FrobeniusNorm( x );
 }
 
+template<typename F>
+Int QueueNrm2
+( const AbstractDistMatrix<F>& x, DeferredReduction<Base<F>>& reduction )
+{
+    DEBUG_CSE
+    DEBUG_ONLY(
+      if( x.Height() != 1 && x.Width() != 1 )
+          LogicError("x must be a vector");
+    )
+    return QueueFrobeniusNorm( x, reduction );
+}
+
+template<typename F>
+Int QueueNrm2
+( const DistMultiVec<F>& x, DeferredReduction<Base<F>>& reduction )
+{
+    DEBUG_CSE
+    DEBUG_ONLY(
+      if( x.Height() != 1 && x.Width() != 1 )
+          LogicError("x must be a vector");
+    )
+    return QueueFrobeniusNorm( x, reduction );
+}
+
 #ifdef EL_INSTANTIATE_BLAS_LEVEL1
 # define EL_EXTERN
 #else
@@ -64,7 +124,11 @@ Base<F> Nrm2( const DistMultiVec<F>& x )
 #define PROTO(F) \
   EL_EXTERN template Base<F> Nrm2( const Matrix<F>& x ); \
   EL_EXTERN template Base<F> Nrm2( const AbstractDistMatrix<F>& x ); \
-  EL_EXTERN template Base<F> Nrm2( const DistMultiVec<F>& x );
+  EL_EXTERN template Base<F> Nrm2( const DistMultiVec<F>& x ); \
+  EL_EXTERN template Int QueueNrm2 \
+  ( const AbstractDistMatrix<F>& x, DeferredReduction<Base<F>>& reduction ); \
+  EL_EXTERN template Int QueueNrm2 \
+  ( const DistMultiVec<F>& x, DeferredReduction<Base<F>>& reduction );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
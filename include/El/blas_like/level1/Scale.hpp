@@ -26,6 +26,7 @@ void Scale( S alphaS, Matrix<T>& A )
 
     if( alpha == T(0) )
     {
+        EL_PARALLEL_FOR_IF(ParallelizeWork<T>(height*width))
         for( Int j=0; j<width; ++j )
             for( Int i=0; i<height; ++i )
                 ABuf[i+j*ALDim] = 0;
@@ -34,11 +35,13 @@ void Scale( S alphaS, Matrix<T>& A )
     {
         if( height >= width )
         {
+            EL_PARALLEL_FOR_IF(ParallelizeWork<T>(height*width))
             for( Int j=0; j<width; ++j )
                 blas::Scal( height, alpha, &ABuf[j*ALDim], 1 );
         }
         else
         {
+            EL_PARALLEL_FOR_IF(ParallelizeWork<T>(height*width))
             for( Int i=0; i<height; ++i )
                 blas::Scal( width, alpha, &ABuf[i], ALDim );
         }
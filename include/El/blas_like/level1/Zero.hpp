@@ -17,7 +17,7 @@ void Zero( Matrix<T>& A )
     DEBUG_CSE
     const Int height = A.Height();
     const Int width = A.Width();
-    EL_PARALLEL_FOR
+    EL_PARALLEL_FOR_IF(ParallelizeWork<T>(height*width))
     for( Int j=0; j<width; ++j )
         MemZero( A.Buffer(0,j), height );
 }
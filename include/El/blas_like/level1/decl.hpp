@@ -466,6 +466,57 @@ void Copy( const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& B );
 template<typename S,typename T,typename=EnableIf<CanCast<S,T>>>
 void Copy( const AbstractDistMatrix<S>& A, AbstractDistMatrix<T>& B );
 
+// CopyAsync
+// =========
+// A redistribution started by CopyAsync. The target matrix must not be
+// accessed (nor resized or destroyed) until Wait has returned.
+template<typename T>
+struct CopyRequest
+{
+    bool pending=false;
+    mpi::Request<T> request;
+    vector<T> buffer;
+    // Unpacks the received data into the target matrix
+    function<void()> unpack;
+
+    CopyRequest() { }
+    CopyRequest( CopyRequest<T>&& req );
+    CopyRequest<T>& operator=( CopyRequest<T>&& req );
+    ~CopyRequest();
+
+    // Returns true (after unpacking) if the redistribution has completed
+    bool Test();
+    void Wait();
+};
+
+// Start redistributing A into B, where the redistributions which are a
+// single all-gather ([U,V] -> [Collect(U),V] or [U,Collect(V)]) or a single
+// all-to-all (e.g., [VC,* ] <-> [MC,MR] or [* ,VR] <-> [MC,MR]) between
+// aligned matrices are posted as nonblocking collectives. All other
+// redistributions (or all of them if nonblocking collectives are not
+// available) are performed immediately and return a completed request.
+template<typename T>
+CopyRequest<T> CopyAsync( const ElementalMatrix<T>& A, ElementalMatrix<T>& B );
+
+// The general-purpose redistributions process blocks of columns at a time
+// so that their send and receive buffers fit within the given number of bytes
+// per process. A limit of zero (the default) redistributes all columns at
+// once.
+void SetRedistMemoryLimit( size_t numBytes );
+size_t RedistMemoryLimit();
+
+// If enabled, the all-gathers into [* ,* ] and into matrices which are
+// replicated over the process rows or columns (e.g., [MC,* ] and [* ,MR])
+// store a single copy of the result per node in an MPI-3 shared-memory window
+// which is viewed by every process on the node holding the same entries.
+// Only the leader of each node then takes part in the inter-node exchange.
+// The first non-const access to the local data of such a matrix (e.g., via
+// Matrix(), Buffer(), or SetLocal) replaces it by a private copy, so that
+// node-mates never observe each other's updates; they also switch back to
+// private storage when resized.
+void SetSharedReplication( bool shared );
+bool SharedReplication();
+
 template<typename T>
 void CopyFromRoot
 ( const Matrix<T>& A, DistMatrix<T,CIRC,CIRC>& B,
@@ -748,6 +799,18 @@ T Dot( const ElementalMatrix<T>& A, const ElementalMatrix<T>& B );
 template<typename T>
 T Dot( const DistMultiVec<T>& A, const DistMultiVec<T>& B );
 
+// Queue the local contributions to Dot(A,B) into a deferred reduction over a
+// communicator containing every process of the grid (or communicator) of A
+// and return the slot of the result
+template<typename F>
+Int QueueDot
+( const ElementalMatrix<F>& A, const ElementalMatrix<F>& B,
+  DeferredReduction<Base<F>>& reduction );
+template<typename F>
+Int QueueDot
+( const DistMultiVec<F>& A, const DistMultiVec<F>& B,
+  DeferredReduction<Base<F>>& reduction );
+
 // Dotu
 // ====
 template<typename T>
@@ -1390,6 +1453,15 @@ Base<F> Nrm2( const AbstractDistMatrix<F>& x );
 template<typename F>
 Base<F> Nrm2( const DistMultiVec<F>& x );
 
+// Queue the local contributions to Nrm2(x) into a deferred reduction (see
+// QueueDot)
+template<typename F>
+Int QueueNrm2
+( const AbstractDistMatrix<F>& x, DeferredReduction<Base<F>>& reduction );
+template<typename F>
+Int QueueNrm2
+( const DistMultiVec<F>& x, DeferredReduction<Base<F>>& reduction );
+
 // QuasiDiagonalScale
 // ==================
 template<typename F,typename FMain>
@@ -20,6 +20,7 @@
 #include <El/blas_like/level1/ConjugateSubmatrix.hpp>
 #include <El/blas_like/level1/Contract.hpp>
 #include <El/blas_like/level1/Copy.hpp>
+#include <El/blas_like/level1/CopyAsync.hpp>
 #include <El/blas_like/level1/DiagonalScale.hpp>
 #include <El/blas_like/level1/DiagonalScaleTrapezoid.hpp>
 #include <El/blas_like/level1/DiagonalSolve.hpp>
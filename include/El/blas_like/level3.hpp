@@ -26,32 +26,63 @@ enum GemmAlgorithm {
   GEMM_SUMMA_B,
   GEMM_SUMMA_C,
   GEMM_SUMMA_DOT,
-  GEMM_CANNON
+  GEMM_CANNON,
+  GEMM_SUMMA_C_PIPELINED,
+  GEMM_25D
 };
 }
 using namespace GemmAlgorithmNS;
 
+// GEMM_25D splits the processes into 'depth' layers which each multiply a
+// slice of the summation dimension on their own grid. A depth of zero (the
+// default) selects the largest depth which divides the number of processes,
+// is at most its cube root, and whose replicated copies of C fit within the
+// memory limit. A memory limit of zero (the default) uses the physical memory
+// currently available to each process.
+void SetGemm25DDepth( Int depth );
+Int Gemm25DDepth();
+void SetGemm25DMemoryLimit( size_t numBytes );
+size_t Gemm25DMemoryLimit();
+
+// The engine used for the local products. GEMM_OZAKI splits real operands
+// of precision beyond double (DoubleDouble, QuadDouble, Quad, and BigFloat)
+// into double-precision slices whose products are formed exactly by the
+// native dgemm and accumulated in the extended precision; it is ignored for
+// all other types. The distributed Gemm uses the engine for each of its
+// local products.
+namespace GemmEngineNS {
+enum GemmEngine {
+  GEMM_ENGINE_DEFAULT,
+  GEMM_OZAKI
+};
+}
+using namespace GemmEngineNS;
+
 template<typename T>
 void Gemm
 ( Orientation orientA, Orientation orientB,
-  T alpha, const Matrix<T>& A, const Matrix<T>& B, T beta, Matrix<T>& C );
+  T alpha, const Matrix<T>& A, const Matrix<T>& B, T beta, Matrix<T>& C,
+  GemmEngine engine=GEMM_ENGINE_DEFAULT );
 
 template<typename T>
 void Gemm
 ( Orientation orientA, Orientation orientB,
-  T alpha, const Matrix<T>& A, const Matrix<T>& B, Matrix<T>& C );
+  T alpha, const Matrix<T>& A, const Matrix<T>& B, Matrix<T>& C,
+  GemmEngine engine=GEMM_ENGINE_DEFAULT );
 
 template<typename T>
 void Gemm
 ( Orientation orientA, Orientation orientB,
   T alpha, const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& B,
-  T beta,        AbstractDistMatrix<T>& C, GemmAlgorithm alg=GEMM_DEFAULT );
+  T beta,        AbstractDistMatrix<T>& C, GemmAlgorithm alg=GEMM_DEFAULT,
+  GemmEngine engine=GEMM_ENGINE_DEFAULT );
 
 template<typename T>
 void Gemm
 ( Orientation orientA, Orientation orientB,
   T alpha, const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& B,
-                 AbstractDistMatrix<T>& C, GemmAlgorithm alg=GEMM_DEFAULT );
+                 AbstractDistMatrix<T>& C, GemmAlgorithm alg=GEMM_DEFAULT,
+  GemmEngine engine=GEMM_ENGINE_DEFAULT );
 
 template<typename T>
 void LocalGemm
@@ -476,6 +507,70 @@ void LocalTrsm
         AbstractDistMatrix<F>& X,
   bool checkIfSingular=false );
 
+// Performance model
+// =================
+// An alpha-beta-gamma model of the local Gemm and of the point-to-point
+// messages within the process columns and rows which, once calibrated (or
+// read from a file) and set, is used by GEMM_DEFAULT to choose between the
+// SUMMA variants and Cannon's algorithm and by TRSM_DEFAULT to choose between
+// TRSM_LARGE, TRSM_MEDIUM, and TRSM_SMALL (for left-sided solves). Without a
+// model, the usual shape-based heuristics are used.
+//
+// The flop rate is measured with double-precision and is used for every
+// datatype, and message sizes are computed from sizeof(T).
+struct PerfModel
+{
+    // Seconds per flop of the local Gemm
+    double flopTime=0;
+    // Latency (in seconds) and inverse bandwidth (in seconds per byte) of
+    // messages within a process column (i.e., over ColComm)
+    double colLatency=0, colInvBandwidth=0;
+    // Latency and inverse bandwidth of messages within a process row
+    double rowLatency=0, rowInvBandwidth=0;
+};
+
+// Measure the model on the given grid (collective over the grid)
+PerfModel CalibratePerfModel( const Grid& grid );
+
+void SetPerfModel( const PerfModel& model );
+void ClearPerfModel();
+bool HavePerfModel();
+const PerfModel& GetPerfModel();
+
+void WritePerfModel( const PerfModel& model, const string& filename );
+PerfModel ReadPerfModel( const string& filename );
+
+// The modeled time of C := alpha op(A) op(B) + beta C with the given algorithm
+// (which may not be GEMM_DEFAULT) and the cheapest such algorithm
+template<typename T>
+double ModeledGemmTime
+( GemmAlgorithm alg, Orientation orientA, Orientation orientB,
+  const AbstractDistMatrix<T>& A,
+  const AbstractDistMatrix<T>& B,
+  const AbstractDistMatrix<T>& C,
+  const PerfModel& model );
+template<typename T>
+GemmAlgorithm ModeledGemmAlgorithm
+( Orientation orientA, Orientation orientB,
+  const AbstractDistMatrix<T>& A,
+  const AbstractDistMatrix<T>& B,
+  const AbstractDistMatrix<T>& C,
+  const PerfModel& model );
+
+// The modeled time of a left-sided Trsm with the given algorithm (which may
+// not be TRSM_DEFAULT) and the cheapest such algorithm
+template<typename F>
+double ModeledTrsmTime
+( TrsmAlgorithm alg,
+  const AbstractDistMatrix<F>& A,
+  const AbstractDistMatrix<F>& B,
+  const PerfModel& model );
+template<typename F>
+TrsmAlgorithm ModeledTrsmAlgorithm
+( const AbstractDistMatrix<F>& A,
+  const AbstractDistMatrix<F>& B,
+  const PerfModel& model );
+
 // Trstrm
 // ======
 template<typename F>
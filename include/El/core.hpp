@@ -17,6 +17,7 @@
 #include <cmath>
 #include <complex>
 #include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <cstring>
 #include <ctime>
@@ -205,6 +206,7 @@ template<typename T> struct IsStdScalar<Complex<T>>
 #include <El/core/environment/decl.hpp>
 
 #include <El/core/Timer.hpp>
+#include <El/core/Profile.hpp>
 #include <El/core/indexing/decl.hpp>
 #include <El/core/imports/blas.hpp>
 #include <El/core/imports/lapack.hpp>
@@ -215,6 +217,8 @@ template<typename T> struct IsStdScalar<Complex<T>>
 #include <El/core/imports/scalapack.hpp>
 
 #include <El/core/limits.hpp>
+#include <El/core/BinnedSum.hpp>
+#include <El/core/DeferredReduction.hpp>
 
 #include <El/core/Memory.hpp>
 
@@ -245,6 +249,7 @@ class DistMatrix;
 #include <El/core/Matrix/impl.hpp>
 #include <El/core/Grid.hpp>
 #include <El/core/DistMatrix.hpp>
+#include <El/core/Workspace.hpp>
 #include <El/core/Proxy.hpp>
 
 // Implement the intertwined parts of the library
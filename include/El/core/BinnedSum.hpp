@@ -0,0 +1,251 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BINNEDSUM_HPP
+#define EL_BINNEDSUM_HPP
+
+namespace El {
+
+// Reproducible summation via pre-rounding: given an upper bound on the
+// magnitudes of the terms, each term is split into 'numFolds' pieces which
+// are multiples of fixed powers of two (that only depend upon the bound).
+// Each fold can then be summed exactly, and therefore in any order, as long as
+// there are at most 2^logMaxTerms terms, and the folds are added in a fixed
+// order, so that the result does not depend upon the order of the terms or
+// upon how they are distributed. The portion of each term which lies below
+// the last fold (roughly 2^-60 relative to the bound) is dropped.
+//
+// The terms are accumulated in double precision. If the bound is zero or not
+// finite, the terms are instead summed directly into the first fold.
+//
+// The folds lie on a fixed grid of exponents (the multiples of foldWidth), and
+// a term's pieces within the folds do not depend upon how far above the term
+// the leading fold is. Partial sums binned relative to a smaller bound (e.g.,
+// the local bound of a single process) can thus be converted exactly into
+// those relative to a larger one (e.g., the global bound) via Align.
+class SumBins
+{
+public:
+    static const int numFolds = 4;
+    static const int logMaxTerms = 32;
+    static const int foldWidth =
+      std::numeric_limits<double>::digits - logMaxTerms - 1;
+
+    explicit SumBins( double maxAbs );
+
+    bool Binned() const { return binned_; }
+
+    // Accumulate a term into the 'numFolds' partial sums 'folds'
+    void Deposit( double alpha, double* folds ) const;
+    // Add the (fully accumulated) partial sums in a fixed order
+    double Collapse( const double* folds ) const;
+    // Convert the partial sums 'folds', which were binned relative to 'bins'
+    // (whose bound may not be larger than ours), into our folds
+    void Align( const SumBins& bins, double* folds ) const;
+
+    // A multiple of foldWidth/2 which is at least the exponent of 'maxAbs',
+    // so that the ratio of the squares of two such powers of two is a whole
+    // number of folds (see ReproducibleNorm)
+    static int NormExponent( double maxAbs );
+
+private:
+    bool binned_=false;
+    int level_=0;
+    int numActiveFolds_=0;
+    double extractors_[numFolds];
+};
+
+inline SumBins::SumBins( double maxAbs )
+{
+    typedef std::numeric_limits<double> Limits;
+    if( !(maxAbs > 0) || maxAbs > Limits::max() )
+        return;
+
+    // Choose the leading fold as the first one on the grid such that the sum
+    // of 2^logMaxTerms terms bounded by maxAbs < 2^exponent is a multiple of
+    // its unit roundoff which is less than 2^(foldExp+1)
+    int exponent;
+    std::frexp( maxAbs, &exponent );
+    const int minFoldExp = exponent + logMaxTerms + 1;
+    level_ = ( minFoldExp >= 0 ? (minFoldExp+foldWidth-1) / foldWidth
+                               : -((-minFoldExp) / foldWidth) );
+    int foldExp = level_*foldWidth;
+    if( foldExp > Limits::max_exponent-2 )
+        return;
+    binned_ = true;
+    for( int k=0; k<numFolds && foldExp >= Limits::min_exponent; ++k )
+    {
+        extractors_[k] = std::ldexp( 1.5, foldExp );
+        ++numActiveFolds_;
+        foldExp -= foldWidth;
+    }
+}
+
+inline void SumBins::Deposit( double alpha, double* folds ) const
+{
+    if( !binned_ )
+    {
+        folds[0] += alpha;
+        return;
+    }
+    for( int k=0; k<numActiveFolds_; ++k )
+    {
+        // The volatile prevents the extraction from being simplified away
+        volatile double shifted = extractors_[k] + alpha;
+        const double piece = shifted - extractors_[k];
+        folds[k] += piece;
+        alpha -= piece;
+    }
+}
+
+inline double SumBins::Collapse( const double* folds ) const
+{
+    double sum = folds[0];
+    for( int k=1; k<numActiveFolds_; ++k )
+        sum += folds[k];
+    return sum;
+}
+
+inline void SumBins::Align( const SumBins& bins, double* folds ) const
+{
+    if( !binned_ )
+    {
+        // Our terms are summed directly into the first fold
+        if( bins.binned_ )
+            folds[0] = bins.Collapse( folds );
+        for( int k=1; k<numFolds; ++k )
+            folds[k] = 0;
+        return;
+    }
+    // Unbinned partial sums with a smaller bound than ours are zero
+    const int shift = ( bins.binned_ ? level_-bins.level_ : numFolds );
+    for( int k=numFolds-1; k>=0; --k )
+        folds[k] = ( k >= shift ? folds[k-shift] : 0. );
+}
+
+inline int SumBins::NormExponent( double maxAbs )
+{
+    static_assert( foldWidth % 2 == 0, "The fold width must be even" );
+    const int halfWidth = foldWidth / 2;
+    int exponent;
+    std::frexp( maxAbs, &exponent );
+    return ( exponent >= 0 ? (exponent+halfWidth-1) / halfWidth
+                           : -((-exponent) / halfWidth) )*halfWidth;
+}
+
+// Whether sums of the given datatype should be binned
+template<typename T>
+bool UseReproducibleSum()
+{ return IsBlasScalar<T>::value && ReproducibleSums(); }
+
+// Reproducibly sum the terms term(k), for 0 <= k < numLocalTerms, of every
+// process of 'comm' (with the result on every process), where 'maxAbs' is an
+// upper bound on the magnitudes of the real and imaginary parts of all of the
+// terms which is the same on every process
+template<typename T,class TermFunc,typename=EnableIf<IsBlasScalar<T>>>
+T ReproducibleSum
+( Int numLocalTerms, TermFunc term, double maxAbs, mpi::Comm comm )
+{
+    DEBUG_CSE
+    const int numFolds = SumBins::numFolds;
+    const bool complex = IsComplex<T>::value;
+
+    const SumBins bins( maxAbs );
+    double folds[2*numFolds] = {};
+    for( Int k=0; k<numLocalTerms; ++k )
+    {
+        const T alpha = term(k);
+        bins.Deposit( double(RealPart(alpha)), folds );
+        if( complex )
+            bins.Deposit( double(ImagPart(alpha)), &folds[numFolds] );
+    }
+    mpi::AllReduceFolds( folds, (complex ? 2 : 1)*numFolds, comm );
+
+    T sum = Base<T>(bins.Collapse(folds));
+    if( complex )
+        SetImagPart( sum, Base<T>(bins.Collapse(&folds[numFolds])) );
+    return sum;
+}
+
+// As above, but with the bound computed from the terms (which requires an
+// additional reduction)
+template<typename T,class TermFunc,typename=EnableIf<IsBlasScalar<T>>>
+T ReproducibleSum( Int numLocalTerms, TermFunc term, mpi::Comm comm )
+{
+    DEBUG_CSE
+    double localMax = 0;
+    for( Int k=0; k<numLocalTerms; ++k )
+    {
+        const T alpha = term(k);
+        localMax = Max( localMax, double(Abs(RealPart(alpha))) );
+        localMax = Max( localMax, double(Abs(ImagPart(alpha))) );
+    }
+    const double maxAbs = mpi::AllReduce( localMax, mpi::MAX, comm );
+    return ReproducibleSum<T>( numLocalTerms, term, maxAbs, comm );
+}
+
+// Reproducibly compute the two-norm of the entries entry(k), for
+// 0 <= k < numLocalEntries, of every process of 'comm'. The entries are
+// scaled by a power of two near their maximum magnitude (see
+// SumBins::NormExponent) so that the squares neither overflow nor underflow
+// (relative to the largest of them).
+template<typename T,class EntryFunc,typename=EnableIf<IsBlasScalar<T>>>
+Base<T> ReproducibleNorm
+( Int numLocalEntries, EntryFunc entry, mpi::Comm comm )
+{
+    DEBUG_CSE
+    double localMax = 0;
+    for( Int k=0; k<numLocalEntries; ++k )
+        localMax = Max( localMax, double(Abs(entry(k))) );
+    const double maxAbs = mpi::AllReduce( localMax, mpi::MAX, comm );
+    if( !(maxAbs > 0) || maxAbs > std::numeric_limits<double>::max() )
+        return Base<T>(maxAbs);
+
+    const int exponent = SumBins::NormExponent( maxAbs );
+    auto scaledSquare = [&]( Int k )
+      {
+          const double alpha = std::ldexp( double(Abs(entry(k))), -exponent );
+          return alpha*alpha;
+      };
+    const double scaledMax = std::ldexp( maxAbs, -exponent );
+    const double scaledSum =
+      ReproducibleSum<double>
+      ( numLocalEntries, scaledSquare, scaledMax*scaledMax, comm );
+    return Base<T>(std::ldexp( std::sqrt(scaledSum), exponent ));
+}
+
+// UseReproducibleSum is false for the remaining datatypes
+template<typename T,class TermFunc,
+         typename=DisableIf<IsBlasScalar<T>>,typename=void>
+T ReproducibleSum
+( Int numLocalTerms, TermFunc term, double maxAbs, mpi::Comm comm )
+{
+    LogicError("Reproducible sums require single or double precision");
+    return T(0);
+}
+
+template<typename T,class TermFunc,
+         typename=DisableIf<IsBlasScalar<T>>,typename=void>
+T ReproducibleSum( Int numLocalTerms, TermFunc term, mpi::Comm comm )
+{
+    LogicError("Reproducible sums require single or double precision");
+    return T(0);
+}
+
+template<typename T,class EntryFunc,
+         typename=DisableIf<IsBlasScalar<T>>,typename=void>
+Base<T> ReproducibleNorm
+( Int numLocalEntries, EntryFunc entry, mpi::Comm comm )
+{
+    LogicError("Reproducible sums require single or double precision");
+    return Base<T>(0);
+}
+
+} // namespace El
+
+#endif // ifndef EL_BINNEDSUM_HPP
@@ -0,0 +1,402 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_DEFERREDREDUCTION_HPP
+#define EL_DEFERREDREDUCTION_HPP
+
+namespace El {
+
+// A queue of local partial results (sums, maxima, and the scaled sums of
+// squares used to form two-norms without overflow or underflow) which are
+// combined over a communicator with a single AllReduce rather than with one
+// latency-bound reduction per result.
+//
+// Each slot is a pair (scale,value), stored as a Complex<Real> so that the
+// existing user-defined reductions apply, and two slots are combined via
+//
+//   scale := max(scale0,scale1),
+//   value := value0 (scale0/scale)^2 + value1 (scale1/scale)^2,
+//
+// where terms with a zero scale or value are dropped. Sums are thus stored
+// with a unit scale, maxima as a scale with a zero value, and scaled squares
+// as themselves.
+//
+// Every process of the communicator must queue the same sequence of partial
+// results (using neutral values if it has no contribution) before flushing.
+//
+// Reproducible (binned) sums and norms are queued as the local folds of their
+// terms (see SumBins) along with a maximum slot holding the local bound.
+// Flushing then requires a second AllReduce, which sums the folds of all of
+// them after they were aligned to the global bounds.
+template<typename Real>
+class DeferredReduction
+{
+public:
+    DeferredReduction( mpi::Comm comm=mpi::COMM_WORLD );
+
+    mpi::Comm Comm() const;
+    Int NumSlots() const;
+    bool Flushed() const;
+
+    // Queue a local partial result and return the slot of the global result
+    Int QueueSum( Real localSum );
+    Int QueueSum( const Complex<Real>& localSum );
+    Int QueueMax( Real localMax );
+    Int QueueScaledSquare( Real localScale, Real localScaledSquare );
+
+    // Queue the local terms term(k), for 0 <= k < numLocalTerms, of a
+    // reproducible sum (see ReproducibleSum) or the local entries entry(k) of
+    // a reproducible two-norm (see ReproducibleNorm), where T must be a BLAS
+    // scalar. The results are retrieved via Sum (or ComplexSum) and Norm and
+    // are identical to those of the eager routines.
+    template<typename T,class TermFunc>
+    Int QueueBinnedSum( Int numLocalTerms, TermFunc term );
+    template<typename T,class EntryFunc>
+    Int QueueBinnedNorm( Int numLocalEntries, EntryFunc entry );
+
+    // Combine the queued partial results over the communicator
+    void Flush();
+
+    // Retrieve the global results (after flushing)
+    Real Sum( Int slot ) const;
+    Complex<Real> ComplexSum( Int slot ) const;
+    Real Max( Int slot ) const;
+    Real Norm( Int slot ) const;
+    // The sum of type F, which is either Real (see Sum) or Complex<Real>
+    // (see ComplexSum), for routines which are generic over the field
+    template<typename F,typename=EnableIf<IsReal<F>>>
+    F Sum( Int slot ) const;
+    template<typename F,typename=DisableIf<IsReal<F>>,typename=void>
+    F Sum( Int slot ) const;
+
+    // Discard the slots so that the queue may be reused
+    void Clear();
+
+private:
+    mpi::Comm comm_;
+    bool flushed_=false;
+    vector<Complex<Real>> slots_;
+
+    struct BinnedSlot
+    {
+        // The slot which holds the bound (and, after flushing, the result)
+        // and, for complex sums, the following slot
+        Int slot;
+        bool norm, complex;
+        // The local bound and, for norms, the exponent of the local scaling
+        double localMax;
+        int exponent;
+        double folds[2*SumBins::numFolds];
+    };
+    vector<BinnedSlot> binnedSlots_;
+
+    Int Queue( Real scale, Real value );
+    void AssertFlushed( Int slot, Int numSlots=1 ) const;
+};
+
+template<typename Real>
+DeferredReduction<Real>::DeferredReduction( mpi::Comm comm )
+: comm_(comm)
+{ }
+
+template<typename Real>
+mpi::Comm DeferredReduction<Real>::Comm() const { return comm_; }
+
+template<typename Real>
+Int DeferredReduction<Real>::NumSlots() const { return slots_.size(); }
+
+template<typename Real>
+bool DeferredReduction<Real>::Flushed() const { return flushed_; }
+
+template<typename Real>
+Int DeferredReduction<Real>::Queue( Real scale, Real value )
+{
+    DEBUG_ONLY(
+      if( flushed_ )
+          LogicError("Cannot queue into a flushed reduction");
+    )
+    slots_.push_back( Complex<Real>(scale,value) );
+    return slots_.size()-1;
+}
+
+template<typename Real>
+Int DeferredReduction<Real>::QueueSum( Real localSum )
+{ return Queue( Real(1), localSum ); }
+
+template<typename Real>
+Int DeferredReduction<Real>::QueueSum( const Complex<Real>& localSum )
+{
+    const Int slot = Queue( Real(1), localSum.real() );
+    Queue( Real(1), localSum.imag() );
+    return slot;
+}
+
+template<typename Real>
+Int DeferredReduction<Real>::QueueMax( Real localMax )
+{ return Queue( localMax, Real(0) ); }
+
+template<typename Real>
+Int DeferredReduction<Real>::QueueScaledSquare
+( Real localScale, Real localScaledSquare )
+{ return Queue( localScale, localScaledSquare ); }
+
+template<typename Real>
+template<typename T,class TermFunc>
+Int DeferredReduction<Real>::QueueBinnedSum( Int numLocalTerms, TermFunc term )
+{
+    const int numFolds = SumBins::numFolds;
+    BinnedSlot binned;
+    binned.norm = false;
+    binned.complex = IsComplex<T>::value;
+    binned.exponent = 0;
+    binned.localMax = 0;
+    for( Int k=0; k<numLocalTerms; ++k )
+    {
+        const T alpha = term(k);
+        binned.localMax =
+          El::Max( binned.localMax, double(Abs(RealPart(alpha))) );
+        binned.localMax =
+          El::Max( binned.localMax, double(Abs(ImagPart(alpha))) );
+    }
+    const SumBins bins( binned.localMax );
+    MemZero( binned.folds, 2*numFolds );
+    for( Int k=0; k<numLocalTerms; ++k )
+    {
+        const T alpha = term(k);
+        bins.Deposit( double(RealPart(alpha)), binned.folds );
+        if( binned.complex )
+            bins.Deposit( double(ImagPart(alpha)), &binned.folds[numFolds] );
+    }
+    binned.slot = QueueMax( Real(binned.localMax) );
+    if( binned.complex )
+        QueueMax( Real(0) );
+    binnedSlots_.push_back( binned );
+    return binned.slot;
+}
+
+template<typename Real>
+template<typename T,class EntryFunc>
+Int DeferredReduction<Real>::QueueBinnedNorm
+( Int numLocalEntries, EntryFunc entry )
+{
+    BinnedSlot binned;
+    binned.norm = true;
+    binned.complex = false;
+    binned.localMax = 0;
+    for( Int k=0; k<numLocalEntries; ++k )
+        binned.localMax = El::Max( binned.localMax, double(Abs(entry(k))) );
+    MemZero( binned.folds, 2*SumBins::numFolds );
+    binned.exponent = SumBins::NormExponent( binned.localMax );
+    if( binned.localMax > 0 &&
+        binned.localMax <= std::numeric_limits<double>::max() )
+    {
+        const double scaledMax =
+          std::ldexp( binned.localMax, -binned.exponent );
+        const SumBins bins( scaledMax*scaledMax );
+        for( Int k=0; k<numLocalEntries; ++k )
+        {
+            const double alpha =
+              std::ldexp( double(Abs(entry(k))), -binned.exponent );
+            bins.Deposit( alpha*alpha, binned.folds );
+        }
+    }
+    binned.slot = QueueMax( Real(binned.localMax) );
+    binnedSlots_.push_back( binned );
+    return binned.slot;
+}
+
+template<typename Real>
+void DeferredReduction<Real>::Flush()
+{
+    DEBUG_CSE
+    if( flushed_ )
+        LogicError("Reduction was already flushed");
+    flushed_ = true;
+    if( slots_.empty() )
+        return;
+
+    auto combine =
+      []( const Complex<Real>& alpha, const Complex<Real>& beta )
+      {
+          const Real scale = El::Max( alpha.real(), beta.real() );
+          Real value = 0;
+          if( alpha.real() != Real(0) && alpha.imag() != Real(0) )
+          {
+              const Real relScale = alpha.real()/scale;
+              value += alpha.imag()*relScale*relScale;
+          }
+          if( beta.real() != Real(0) && beta.imag() != Real(0) )
+          {
+              const Real relScale = beta.real()/scale;
+              value += beta.imag()*relScale*relScale;
+          }
+          return Complex<Real>(scale,value);
+      };
+    mpi::AllReduce( slots_.data(), slots_.size(), combine, true, comm_ );
+    if( binnedSlots_.empty() )
+        return;
+
+    // Align the local folds of the binned slots to their global bounds (which
+    // the maximum slots now hold) and sum them with a second reduction
+    const int numFolds = SumBins::numFolds;
+    const Int numBinned = binnedSlots_.size();
+    vector<double> folds( 2*numBinned*numFolds, 0. );
+    for( Int b=0; b<numBinned; ++b )
+    {
+        const BinnedSlot& binned = binnedSlots_[b];
+        const double maxAbs = double(slots_[binned.slot].real());
+        double* bFolds = &folds[2*b*numFolds];
+        if( !binned.norm )
+        {
+            const SumBins bins( maxAbs ), localBins( binned.localMax );
+            for( Int part=0; part<(binned.complex ? 2 : 1); ++part )
+            {
+                double* partFolds = &bFolds[part*numFolds];
+                MemCopy( partFolds, &binned.folds[part*numFolds], numFolds );
+                bins.Align( localBins, partFolds );
+            }
+        }
+        else if( binned.localMax > 0 &&
+                 maxAbs <= std::numeric_limits<double>::max() )
+        {
+            // Exactly rescale the squares to the global exponent
+            const int exponent = SumBins::NormExponent( maxAbs );
+            const int rescale = 2*(binned.exponent-exponent);
+            for( int k=0; k<numFolds; ++k )
+                bFolds[k] = std::ldexp( binned.folds[k], rescale );
+            const double scaledMax = std::ldexp( maxAbs, -exponent );
+            const double localScaledMax =
+              std::ldexp( binned.localMax, -exponent );
+            SumBins(scaledMax*scaledMax).Align
+            ( SumBins(localScaledMax*localScaledMax), bFolds );
+        }
+    }
+    mpi::AllReduceFolds( folds.data(), folds.size(), comm_ );
+
+    for( Int b=0; b<numBinned; ++b )
+    {
+        const BinnedSlot& binned = binnedSlots_[b];
+        const double maxAbs = double(slots_[binned.slot].real());
+        const double* bFolds = &folds[2*b*numFolds];
+        if( !binned.norm )
+        {
+            const SumBins bins( maxAbs );
+            slots_[binned.slot] =
+              Complex<Real>( Real(1), Real(bins.Collapse(bFolds)) );
+            if( binned.complex )
+                slots_[binned.slot+1] =
+                  Complex<Real>
+                  ( Real(1), Real(bins.Collapse(&bFolds[numFolds])) );
+        }
+        else if( maxAbs > 0 && maxAbs <= std::numeric_limits<double>::max() )
+        {
+            const int exponent = SumBins::NormExponent( maxAbs );
+            const double scaledMax = std::ldexp( maxAbs, -exponent );
+            const double scaledSum =
+              SumBins(scaledMax*scaledMax).Collapse( bFolds );
+            const double norm = std::ldexp( std::sqrt(scaledSum), exponent );
+            slots_[binned.slot] = Complex<Real>( Real(norm), Real(1) );
+        }
+        else
+        {
+            // The norm is zero, infinite, or NaN
+            slots_[binned.slot] = Complex<Real>( Real(maxAbs), Real(1) );
+        }
+    }
+}
+
+template<typename Real>
+void DeferredReduction<Real>::AssertFlushed( Int slot, Int numSlots ) const
+{
+    if( !flushed_ )
+        LogicError("Reduction has not been flushed");
+    if( slot < 0 || slot+numSlots > Int(slots_.size()) )
+        LogicError("Invalid reduction slot ",slot);
+}
+
+template<typename Real>
+Real DeferredReduction<Real>::Sum( Int slot ) const
+{
+    DEBUG_ONLY(AssertFlushed( slot ))
+    return slots_[slot].imag();
+}
+
+template<typename Real>
+Complex<Real> DeferredReduction<Real>::ComplexSum( Int slot ) const
+{
+    DEBUG_ONLY(AssertFlushed( slot, 2 ))
+    return Complex<Real>(slots_[slot].imag(),slots_[slot+1].imag());
+}
+
+template<typename Real>
+template<typename F,typename>
+F DeferredReduction<Real>::Sum( Int slot ) const
+{ return Sum( slot ); }
+
+template<typename Real>
+template<typename F,typename,typename>
+F DeferredReduction<Real>::Sum( Int slot ) const
+{ return ComplexSum( slot ); }
+
+template<typename Real>
+Real DeferredReduction<Real>::Max( Int slot ) const
+{
+    DEBUG_ONLY(AssertFlushed( slot ))
+    return slots_[slot].real();
+}
+
+template<typename Real>
+Real DeferredReduction<Real>::Norm( Int slot ) const
+{
+    DEBUG_ONLY(AssertFlushed( slot ))
+    return slots_[slot].real()*Sqrt(slots_[slot].imag());
+}
+
+template<typename Real>
+void DeferredReduction<Real>::Clear()
+{
+    flushed_ = false;
+    slots_.clear();
+    binnedSlots_.clear();
+}
+
+// Queue a reproducible sum or norm (see QueueBinnedSum and QueueBinnedNorm);
+// UseReproducibleSum is false for the datatypes which are not BLAS scalars
+template<typename T,class TermFunc,typename=EnableIf<IsBlasScalar<T>>>
+Int QueueReproducibleSum
+( Int numLocalTerms, TermFunc term, DeferredReduction<Base<T>>& reduction )
+{ return reduction.template QueueBinnedSum<T>( numLocalTerms, term ); }
+
+template<typename T,class EntryFunc,typename=EnableIf<IsBlasScalar<T>>>
+Int QueueReproducibleNorm
+( Int numLocalEntries, EntryFunc entry,
+  DeferredReduction<Base<T>>& reduction )
+{ return reduction.template QueueBinnedNorm<T>( numLocalEntries, entry ); }
+
+template<typename T,class TermFunc,
+         typename=DisableIf<IsBlasScalar<T>>,typename=void>
+Int QueueReproducibleSum
+( Int numLocalTerms, TermFunc term, DeferredReduction<Base<T>>& reduction )
+{
+    LogicError("Reproducible sums require single or double precision");
+    return 0;
+}
+
+template<typename T,class EntryFunc,
+         typename=DisableIf<IsBlasScalar<T>>,typename=void>
+Int QueueReproducibleNorm
+( Int numLocalEntries, EntryFunc entry,
+  DeferredReduction<Base<T>>& reduction )
+{
+    LogicError("Reproducible sums require single or double precision");
+    return 0;
+}
+
+} // namespace El
+
+#endif // ifndef EL_DEFERREDREDUCTION_HPP
@@ -80,6 +80,13 @@ public:
     Int  DiagonalLength( Int offset=0 ) const EL_NO_EXCEPT;
     bool Viewing()                      const EL_NO_EXCEPT;
     bool Locked()                       const EL_NO_EXCEPT;
+    // Whether the local data lives in a window shared by the processes on
+    // our node which hold the same entries (see SetSharedReplication); the
+    // first non-const access to the local data replaces it by a private copy
+    bool NodeShared()                   const EL_NO_EXCEPT;
+    // The node-shared window most recently attached (if any), which is kept
+    // (even after the data is made private) so that it can be reused
+    const std::shared_ptr<mpi::Window>& SharedWindow() const EL_NO_EXCEPT;
 
     // Local matrix information
     // ------------------------
@@ -95,7 +102,7 @@ public:
     const scalarType* LockedBuffer()                     const EL_NO_EXCEPT;
     const scalarType* LockedBuffer( Int iLoc, Int jLoc ) const EL_NO_EXCEPT;
 
-          El::Matrix<scalarType>& Matrix()             EL_NO_EXCEPT;
+          El::Matrix<scalarType>& Matrix();
     const El::Matrix<scalarType>& LockedMatrix() const EL_NO_EXCEPT;
 
     // Distribution information
@@ -321,6 +328,15 @@ protected:
 
     El::Matrix<scalarType> matrix_=El::Matrix<scalarType>(0,0,true);
 
+    // The node-shared window which matrix_ views (if nodeShared_) or most
+    // recently viewed, which is released (collectively over the node) along
+    // with the last reference to it
+    std::shared_ptr<mpi::Window> sharedWindow_;
+    bool nodeShared_=false;
+
+    // Replace node-shared local data by a private copy before it is modified
+    void MakeNodePrivate();
+
     // Remote updates
     // --------------
     // NOTE: Using ValueInt<Int> is somewhat of a hack; it would be nice to 
@@ -339,6 +355,10 @@ protected:
     virtual void SetColShift();
     virtual void SetRowShift();
 
+    // Empty the local data and exchange its buffer with 'memory'
+    // (this is used to borrow buffers from the workspace cache)
+    void SwapLocalMemory( Memory<scalarType>& memory );
+
 private:
     // Exchange metadata with another matrix
     // =====================================
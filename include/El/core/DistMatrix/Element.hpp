@@ -85,6 +85,13 @@ public:
     // (Immutable) view of a local matrix's buffer
     void Attach( const El::Grid& grid, El::Matrix<T>& A );
     void LockedAttach( const El::Grid& grid, const El::Matrix<T>& A );
+    // View of a buffer within a node-shared window, which is kept alive
+    // until the matrix is emptied, resized, or destroyed (the alignment
+    // constraints are left untouched)
+    void AttachShared
+    ( Int height, Int width, const El::Grid& grid,
+      int colAlign, int rowAlign, T* buffer, Int ldim,
+      std::shared_ptr<mpi::Window> window, int root=0 );
 
     // Operator overloading
     // ====================
@@ -18,6 +18,15 @@ public:
     explicit Grid
     ( mpi::Comm comm=mpi::COMM_WORLD, GridOrder order=COLUMN_MAJOR );
     explicit Grid( mpi::Comm comm, int height, GridOrder order=COLUMN_MAJOR );
+    // If the placement is NODE_AWARE, the processes are reordered so that
+    // each process column (i.e., each MC communicator) lies within a single
+    // node whenever the grid height divides the number of processes per node.
+    // A height of zero selects one automatically.
+    explicit Grid
+    ( mpi::Comm comm, GridPlacement placement, GridOrder order=COLUMN_MAJOR );
+    explicit Grid
+    ( mpi::Comm comm, int height, GridPlacement placement,
+      GridOrder order=COLUMN_MAJOR );
     ~Grid();
 
     // Simple interface (simpler version of distributed-based interface)
@@ -32,6 +41,10 @@ public:
     mpi::Comm RowComm() const EL_NO_EXCEPT; // MRComm()
     // VCComm (VRComm) if COLUMN_MAJOR (ROW_MAJOR)
     mpi::Comm Comm() const EL_NO_EXCEPT;
+    // A number which the viewing processes agree upon and which distinguishes
+    // the grid from the others constructed by them (e.g., in the names of
+    // its communicators within the traffic statistics)
+    int Id() const EL_NO_EXCEPT;
 
     // Distribution-based interface
     int MCRank() const EL_NO_RELEASE_EXCEPT;
@@ -55,6 +68,36 @@ public:
     mpi::Comm MDComm() const EL_NO_EXCEPT;
     mpi::Comm MDPerpComm() const EL_NO_EXCEPT;
 
+    // Node-local interface: the processes of the grid, of our process column,
+    // and of our process row which share our node
+    int NodeRank() const EL_NO_RELEASE_EXCEPT;
+    int NodeSize() const EL_NO_RELEASE_EXCEPT;
+    GridPlacement Placement() const EL_NO_EXCEPT;
+    mpi::Comm NodeComm() const EL_NO_EXCEPT;
+    mpi::Comm MCNodeComm() const EL_NO_EXCEPT;
+    mpi::Comm MRNodeComm() const EL_NO_EXCEPT;
+    // The first processes of each node within the grid, our process column,
+    // and our process row (the other processes hold the complementary
+    // communicators, which should not be used)
+    mpi::Comm NodeLeaderComm() const EL_NO_EXCEPT;
+    mpi::Comm MCNodeLeaderComm() const EL_NO_EXCEPT;
+    mpi::Comm MRNodeLeaderComm() const EL_NO_EXCEPT;
+    // A staging buffer of at least 'numBytes' which is shared by the
+    // processes of 'nodeComm' (one of the node-local communicators above or
+    // COMM_SELF). It is collectively reallocated over 'nodeComm' when it is
+    // too small and is otherwise reused, so its contents only survive until
+    // the next call with the same communicator.
+    void* NodeStaging
+    ( mpi::Comm nodeComm, size_t numBytes, mpi::Window& window ) const;
+
+    // The grid of the given one of 'numLayers' contiguous layers of the
+    // owning processes (as used by the 2.5D algorithms) and the communicator
+    // between the owning processes with the same position within each layer.
+    // The layers are collectively created over the viewing processes upon
+    // first use and are then cached along with this grid.
+    const Grid& LayerGrid( int numLayers, int layer ) const;
+    mpi::Comm LayerDepthComm( int numLayers ) const;
+
     // Advanced routines
     explicit Grid
     ( mpi::Comm viewers, mpi::Group owners, int height, 
@@ -93,9 +136,10 @@ public:
 
 private:
     bool haveViewers_;
-    int height_, size_, gcd_;
+    int id_, height_, size_, gcd_;
     bool inGrid_;
     GridOrder order_;
+    GridPlacement placement_;
 
     static Grid* defaultGrid;
 
@@ -110,15 +154,33 @@ private:
               cartComm_, 
               mcComm_, mrComm_,
               mdComm_, mdPerpComm_,
-              vcComm_, vrComm_;
+              vcComm_, vrComm_,
+              nodeComm_, mcNodeComm_, mrNodeComm_,
+              nodeLeaderComm_, mcNodeLeaderComm_, mrNodeLeaderComm_;
 
     int viewingRank_,
         owningRank_,
         mcRank_, mrRank_,
         mdRank_, mdPerpRank_,
-        vcRank_, vrRank_;
+        vcRank_, vrRank_,
+        nodeRank_, nodeSize_;
+
+    // The staging windows for NodeComm, MCNodeComm, MRNodeComm, and COMM_SELF
+    mutable mpi::Window nodeStaging_[4];
+
+    // The cached layers of the owning processes (see LayerGrid)
+    struct Layers
+    {
+        int numLayers;
+        vector<unique_ptr<Grid>> grids;
+        mpi::Comm depthComm;
+    };
+    mutable vector<Layers> layers_;
+
 
     void SetUpGrid();
+    const Layers& GetLayers( int numLayers ) const;
+    int PlaceOnNodes( int height );
 
     // Disable copying this class due to MPI_Comm/MPI_Group ownership issues
     // and potential performance loss from duplicating MPI communicators, e.g.,
@@ -11,6 +11,109 @@
 
 namespace El {
 
+// Strategies for obtaining the buffers underlying Memory<G> for packed types
+// (non-packed types use new[]/delete[], with the exception of the limb slabs
+// of Memory<BigFloat>, see mpfr::SetSlabStorage)
+namespace AllocatorTypeNS {
+enum AllocatorType {
+  SYSTEM_ALLOCATOR,  // one unaligned system allocation per request
+  ALIGNED_ALLOCATOR, // one aligned system allocation per request
+  POOLED_ALLOCATOR   // aligned blocks recycled through size-class pools
+};
+}
+using namespace AllocatorTypeNS;
+
+struct AllocatorCtrl
+{
+    AllocatorType type=SYSTEM_ALLOCATOR;
+
+    // The alignment (in bytes) of the aligned and pooled allocators; it must
+    // be a power of two and is typically the cache-line or page size
+    size_t alignment=64;
+
+    // Whether blocks of at least 2 MiB should be aligned to 2 MiB and
+    // advised to be backed by transparent huge pages (Linux only)
+    bool hugePages=false;
+
+    // Blocks larger than this are never cached by the pooled allocator
+    size_t maxPooledBytes=size_t(1)<<28;
+
+    // Upper bounds on the bytes cached by each thread and by the shared pool
+    size_t maxThreadCachedBytes=size_t(1)<<26;
+    size_t maxCachedBytes=size_t(1)<<30;
+};
+
+struct AllocatorStatistics
+{
+    // Allocation requests and how many were served from a cache
+    size_t numRequests=0;
+    size_t numHits=0;
+    // Blocks handed back to the system (rather than cached) on release
+    size_t numSystemFrees=0;
+
+    // Bytes currently handed out to Memory instances and currently cached
+    size_t liveBytes=0;
+    size_t cachedBytes=0;
+
+    // The maximum of liveBytes+cachedBytes since the last reset
+    size_t highWaterMark=0;
+
+    size_t HeldBytes() const { return liveBytes+cachedBytes; }
+    double HitRate() const
+    { return numRequests==0 ? 0. : double(numHits)/double(numRequests); }
+};
+
+void SetAllocatorCtrl( const AllocatorCtrl& ctrl );
+const AllocatorCtrl& GetAllocatorCtrl();
+
+// Parse '--allocator [system|aligned|pooled]', '--allocAlign <bytes>', and
+// '--hugePages [0|1]' from the command line (this is called by Initialize)
+void SetAllocatorCtrlFromArgs( int argc, char** argv );
+
+AllocatorStatistics GetAllocatorStatistics();
+void ResetAllocatorStatistics();
+void PrintAllocatorStatistics( ostream& os=cout );
+
+// Return all of the blocks cached by the shared pool and the calling thread
+// to the system; the caches of other threads are released lazily
+void TrimAllocator();
+
+// Memory tracking
+// ---------------
+// While tracking is enabled (e.g., via '--trackMemory 1'), every buffer of a
+// Memory<G> is attributed to its datatype and to the profile regions which
+// were open when it was allocated (see ProfileRegionPath), and the peak of the
+// tracked live bytes is recorded along with the region path and the per-type
+// breakdown at the moment of the peak. The library regions only exist if
+// EL_PROFILE is defined, but ProfileRegion may be used in any build. If
+// tracking is enabled when Elemental is finalized, a summary over all
+// processes is printed.
+void SetMemoryTracking( bool track );
+bool MemoryTracking();
+
+size_t TrackedLiveBytes();
+size_t TrackedHighWaterMark();
+// The region path at the moment of the high-water mark
+string TrackedHighWaterRegion();
+
+// Discard the statistics (but not the record of the live buffers, whose
+// release must still be accounted for)
+void ClearMemoryTracking();
+
+// Collectively write the high-water marks (and where they occurred) and the
+// usage of each datatype and region from the root of 'comm'
+void WriteMemoryTracking( ostream& os, mpi::Comm comm=mpi::COMM_WORLD );
+
+// To be used internally by Memory<G>; untracked pointers are ignored
+void TrackAllocation( const void* ptr, size_t numBytes, const string& type );
+void UntrackAllocation( const void* ptr );
+
+// The raw byte interface used by Memory<G>. AllocateBytes may round
+// 'numBytes' up to the capacity of the returned block, and FreeBytes must be
+// passed the (possibly rounded) capacity.
+void* AllocateBytes( size_t& numBytes );
+void FreeBytes( void* ptr, size_t numBytes );
+
 template<typename G>
 class Memory
 {
@@ -11,19 +11,60 @@ namespace El {
 
 namespace {
 
-template<typename G>
-static G* New( size_t size )
+// Packed types are drawn from the configurable allocator, which may round
+// the requested number of entries up to the capacity of the block
+template<typename G,typename=EnableIf<IsPacked<G>>>
+static G* New( size_t& size )
+{
+    size_t numBytes = size*sizeof(G);
+    G* ptr = static_cast<G*>(AllocateBytes( numBytes ));
+    size = numBytes / sizeof(G);
+    return ptr;
+}
+template<typename G,typename=DisableIf<IsPacked<G>>,typename=void>
+static G* New( size_t& size )
 {
     return new G[size];
 }
 
-template<typename G>
-static void Delete( G*& ptr )
+template<typename G,typename=EnableIf<IsPacked<G>>>
+static void Delete( G*& ptr, size_t size )
+{
+    if( ptr != nullptr )
+        FreeBytes( ptr, size*sizeof(G) );
+    ptr = nullptr;
+}
+template<typename G,typename=DisableIf<IsPacked<G>>,typename=void>
+static void Delete( G*& ptr, size_t )
 {
     delete[] ptr;
     ptr = nullptr;
 }
 
+#ifdef EL_HAVE_MPC
+// Unless disabled via mpfr::SetSlabStorage, the limbs of the entries of
+// Memory<BigFloat> are carved out of a single slab (drawn from the
+// configurable allocator) rather than allocated one entry at a time
+template<>
+inline BigFloat* New<BigFloat,void,void>( size_t& size )
+{
+    if( mpfr::SlabStorage() )
+        return mpfr::NewSlab( size );
+    return new BigFloat[size];
+}
+
+template<>
+inline void Delete<BigFloat,void,void>( BigFloat*& ptr, size_t size )
+{
+    // The storage mode may have changed since the allocation
+    if( ptr != nullptr && size > 0 && ptr[0].SlabBacked() )
+        mpfr::DeleteSlab( ptr, size );
+    else
+        delete[] ptr;
+    ptr = nullptr;
+}
+#endif
+
 } // anonymous namespace
 
 template<typename G>
@@ -38,7 +79,7 @@ Memory<G>::Memory( size_t size )
 
 template<typename G>
 Memory<G>::Memory( Memory<G>&& mem )
-: size_(mem.size_), rawBuffer_(nullptr), buffer_(nullptr)
+: size_(0), rawBuffer_(nullptr), buffer_(nullptr)
 { ShallowSwap(mem); }
 
 template<typename G>
@@ -56,7 +97,8 @@ void Memory<G>::ShallowSwap( Memory<G>& mem )
 template<typename G>
 Memory<G>::~Memory() 
 { 
-    Delete( rawBuffer_ );
+    UntrackAllocation( rawBuffer_ );
+    Delete( rawBuffer_, size_ );
 }
 
 template<typename G>
@@ -70,13 +112,17 @@ G* Memory<G>::Require( size_t size )
 {
     if( size > size_ )
     {
-        Delete( rawBuffer_ );
+        UntrackAllocation( rawBuffer_ );
+        Delete( rawBuffer_, size_ );
+        buffer_ = nullptr;
+        size_ = 0;
 
 #ifndef EL_RELEASE
         try {
 #endif
 
-            // TODO: Optionally overallocate to force alignment of buffer_
+            // NOTE: The alignment of buffer_ is determined by the allocator
+            //       (see SetAllocatorCtrl)
             rawBuffer_ = New<G>( size );
             buffer_ = rawBuffer_;
 
@@ -88,11 +134,17 @@ G* Memory<G>::Require( size_t size )
             size_ = 0;
             ostringstream os;
             os << "Failed to allocate " << size*sizeof(G) 
-               << " bytes on process " << mpi::Rank() << endl;
+               << " bytes on process " << mpi::Rank();
+            if( MemoryTracking() )
+                os << " (in region '" << ProfileRegionPath() << "' with "
+                   << TrackedLiveBytes() << " tracked bytes live)";
+            os << endl;
             cerr << os.str();
             throw e;
         }
 #endif
+        if( MemoryTracking() )
+            TrackAllocation( rawBuffer_, size_*sizeof(G), TypeName<G>() );
 #ifdef EL_ZERO_INIT
         MemZero( buffer_, size_ );
 #elif defined(EL_HAVE_VALGRIND)
@@ -110,7 +162,8 @@ void Memory<G>::Release()
 template<typename G>
 void Memory<G>::Empty()
 {
-    Delete( rawBuffer_ );
+    UntrackAllocation( rawBuffer_ );
+    Delete( rawBuffer_, size_ );
     buffer_ = nullptr;
     size_ = 0;
 }
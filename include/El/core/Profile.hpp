@@ -0,0 +1,132 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_PROFILE_HPP
+#define EL_PROFILE_HPP
+
+namespace El {
+
+// Hierarchical performance regions
+// ================================
+// Each process records a tree of the (nested) regions it enters, along with
+// the number of calls and the inclusive time of each. The exclusive time of a
+// region is its inclusive time minus the inclusive times of its children.
+//
+// Regions are only recorded outside of OpenMP parallel regions, and the
+// names must remain valid while the profile is in use (string literals are
+// intended).
+
+// Popping more regions than were pushed raises a LogicError
+void PushProfileRegion( const char* name );
+void PopProfileRegion();
+
+class ProfileRegion
+{
+public:
+    explicit ProfileRegion( const char* name ) { PushProfileRegion( name ); }
+    ~ProfileRegion() { PopProfileRegion(); }
+};
+
+// The '/'-separated names of the currently open regions, from the outermost
+// to the innermost (an empty string outside of every region)
+string ProfileRegionPath();
+
+// Discard all of the recorded regions (no regions may be open)
+void ClearProfile();
+
+enum ProfileFormat
+{
+    PROFILE_TABLE,
+    PROFILE_JSON
+};
+
+// Collectively reduce the minimum, average, and maximum (over the processes
+// which entered each region) of the call counts and the inclusive and
+// exclusive times of every region and write them from the root of 'comm'
+void WriteProfile
+( ostream& os, ProfileFormat format=PROFILE_TABLE,
+  mpi::Comm comm=mpi::COMM_WORLD );
+
+// Where the profile is written when Elemental is finalized (if EL_PROFILE is
+// defined); an empty filename (the default) corresponds to std::cout
+void SetProfileOutput
+( const string& filename, ProfileFormat format=PROFILE_TABLE );
+
+// To be used internally by Elemental
+void FinalizeProfile();
+
+// Event tracing
+// =============
+// While tracing is enabled, each process records a timeline of events: the
+// regions above (which only exist within the library if EL_PROFILE is
+// defined) and the MPI routines which communicate. The events of each process
+// can then be written to a separate file and the files merged into the Chrome
+// 'trace_event' JSON format (e.g., for chrome://tracing or Perfetto) in order
+// to inspect the overlap of computation and communication across processes.
+//
+// As with the regions, events are only recorded outside of OpenMP parallel
+// regions, and their names and categories must remain valid while tracing.
+
+// Collectively begin tracing; the processes of 'comm' synchronize so that their
+// timestamps share (approximately) the same origin
+void StartTracing( mpi::Comm comm=mpi::COMM_WORLD );
+void StopTracing();
+bool Tracing();
+
+// Record an event which ran from 'start' to 'end', where 'args' is a
+// (possibly empty) list of comma-separated JSON members, e.g., "\"bytes\": 8"
+void TraceEvent
+( const char* name, const char* category,
+  Clock::time_point start, Clock::time_point end, const string& args="" );
+
+class TraceRegion
+{
+public:
+    explicit TraceRegion( const char* name, const char* category="user" )
+    : active_(Tracing()), name_(name), category_(category)
+    {
+        if( active_ )
+            start_ = Clock::now();
+    }
+    ~TraceRegion()
+    {
+        if( active_ )
+            TraceEvent( name_, category_, start_, Clock::now() );
+    }
+private:
+    bool active_;
+    const char* name_;
+    const char* category_;
+    Clock::time_point start_;
+};
+
+// Discard all of the recorded events
+void ClearTrace();
+
+// Write the events of this process to the file "<basename>.<rank>.trace",
+// where 'rank' is the rank of this process within 'comm'
+void WriteTrace( const string& basename, mpi::Comm comm=mpi::COMM_WORLD );
+
+// Merge the files written by processes 0 through numProcesses-1 into a single
+// Chrome trace (with one trace process per rank)
+void MergeTraces
+( const string& basename, int numProcesses, const string& filename );
+
+} // namespace El
+
+// The regions used within the library only exist if EL_PROFILE is defined
+#ifdef EL_PROFILE
+# define EL_PROFILE_CONCAT_(a,b) a ## b
+# define EL_PROFILE_CONCAT(a,b) EL_PROFILE_CONCAT_(a,b)
+# define EL_PROFILE_REGION(name) \
+  El::ProfileRegion EL_PROFILE_CONCAT(profileRegion,__LINE__)(name);
+#else
+# define EL_PROFILE_REGION(name)
+#endif
+
+#endif // ifndef EL_PROFILE_HPP
@@ -0,0 +1,140 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_WORKSPACE_HPP
+#define EL_WORKSPACE_HPP
+
+namespace El {
+
+// A cache of the local buffers of distributed temporaries (e.g., the
+// [MC,* ] and [MR,* ] panels of SUMMA) which persists between calls so that
+// repeated calls with similar shapes do not repeatedly allocate and
+// first-touch their workspace.
+//
+// Entries are keyed on the grid, the distribution, and the datatype. The
+// alignments need not be part of the key since realigning a distributed
+// matrix retains its local buffer, and the buffer of an entry is simply the
+// largest shape it has been resized to.
+//
+// The cache is disabled by default so that idle buffers are only retained
+// by programs which opt in.
+
+void EnableWorkspaceCache();
+void DisableWorkspaceCache();
+bool WorkspaceCacheEnabled();
+
+// The maximum number of bytes held by idle entries of the cache; entries
+// which are returned beyond this limit are freed
+void SetWorkspaceCacheLimit( size_t maxBytes );
+size_t WorkspaceCacheLimit();
+
+// The number of bytes currently held by idle entries
+size_t WorkspaceCacheBytes();
+
+// Free idle entries (largest first) until at most 'maxBytes' are held
+void TrimWorkspaceCache( size_t maxBytes=0 );
+
+// Free all idle entries, or only those associated with the given grid
+void ReleaseWorkspaceCache();
+void ReleaseWorkspaceCache( const Grid& grid );
+
+namespace workspace {
+
+// Exchange 'memory' (which should be empty) with the smallest idle buffer for
+// the given grid and distribution which holds at least 'minSize' entries (or,
+// if none do, the largest), if one exists
+template<typename T>
+void Borrow
+( const Grid& grid, Dist colDist, Dist rowDist, size_t minSize,
+  Memory<T>& memory );
+
+// Hand 'memory' to the cache (the cache may immediately free it if its
+// limit would be exceeded)
+template<typename T>
+void Return
+( const Grid& grid, Dist colDist, Dist rowDist, Memory<T>& memory );
+
+} // namespace workspace
+
+// A distributed matrix whose local buffer is borrowed from the workspace
+// cache upon its first resize (once its local size is known) and returned
+// upon destruction
+template<typename T,Dist U,Dist V>
+class WorkspaceDistMatrix : public DistMatrix<T,U,V>
+{
+public:
+    WorkspaceDistMatrix( const El::Grid& g=Grid::Default(), int root=0 )
+    : DistMatrix<T,U,V>(g,root)
+    { }
+
+    void Resize( Int height, Int width ) override
+    {
+        const Int localHeight =
+          Length( height, this->ColShift(), this->ColStride() );
+        BorrowLocalMemory
+        ( Max(localHeight,Int(1)),
+          Length( width, this->RowShift(), this->RowStride() ) );
+        DistMatrix<T,U,V>::Resize( height, width );
+    }
+
+    void Resize( Int height, Int width, Int ldim ) override
+    {
+        BorrowLocalMemory
+        ( ldim, Length( width, this->RowShift(), this->RowStride() ) );
+        DistMatrix<T,U,V>::Resize( height, width, ldim );
+    }
+
+    ~WorkspaceDistMatrix()
+    {
+        if( WorkspaceCacheEnabled() )
+        {
+            Memory<T> memory;
+            this->SwapLocalMemory( memory );
+            workspace::Return( this->Grid(), U, V, memory );
+        }
+    }
+
+    using DistMatrix<T,U,V>::operator=;
+
+private:
+    bool borrowed_=false;
+
+    void BorrowLocalMemory( Int ldim, Int localWidth )
+    {
+        if( borrowed_ || !WorkspaceCacheEnabled() || !this->Participating() )
+            return;
+        borrowed_ = true;
+        Memory<T> memory;
+        workspace::Borrow( this->Grid(), U, V, ldim*localWidth, memory );
+        this->SwapLocalMemory( memory );
+    }
+};
+
+// Add 'numMatrices' idle entries to the cache which can each hold the local
+// portion of a 'height x width' matrix with the given distribution and any
+// alignment
+template<typename T,Dist U,Dist V>
+void ReserveWorkspace
+( const Grid& grid, Int height, Int width, Int numMatrices=1 )
+{
+    DEBUG_CSE
+    if( !WorkspaceCacheEnabled() )
+        return;
+    DistMatrix<T,U,V> A(grid);
+    const Int localHeight = MaxLength( height, A.ColStride() );
+    const Int localWidth = MaxLength( width, A.RowStride() );
+    for( Int k=0; k<numMatrices; ++k )
+    {
+        Memory<T> memory( localHeight*localWidth );
+        workspace::Return( grid, U, V, memory );
+    }
+}
+
+} // namespace El
+
+#endif // ifndef EL_WORKSPACE_HPP
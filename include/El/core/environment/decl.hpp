@@ -93,6 +93,59 @@ void PushBlocksizeStack( Int blocksize );
 void PopBlocksizeStack();
 void EmptyBlocksizeStack();
 
+// Tuned blocksizes
+// ----------------
+// Blocksizes (e.g., from TuneBlocksize) for a particular routine, datatype
+// (as named by TypeName), process grid shape, and problem size, where sizes
+// are bucketed by powers of two and a lookup uses the nearest bucket of the
+// routine, datatype, and grid shape. Sequential routines use a 0 x 0 grid.
+// Routines which support tuning use their tuned blocksize if there is one and
+// Blocksize() otherwise (see TunedBlocksize in environment/impl.hpp).
+//
+// Loading is collective over mpi::COMM_WORLD: the root reads the file and
+// broadcasts the table. If the environment variable EL_TUNING_FILE names a
+// file which the root can read, it is loaded during Initialize.
+
+// Returns zero if there is no tuned blocksize
+Int LookupTunedBlocksize
+( const string& routine, const string& type,
+  int gridHeight, int gridWidth, Int n );
+void SetTunedBlocksize
+( const string& routine, const string& type,
+  int gridHeight, int gridWidth, Int n, Int blocksize );
+void ClearTunedBlocksizes();
+void LoadTunedBlocksizes( const string& filename );
+void SaveTunedBlocksizes( const string& filename );
+
+// For threading local loops (which only occurs if EL_HYBRID is defined):
+// a loop over 'work' entries is split into at most one contiguous chunk per
+// thread with at least ParallelGrainSize() entries each, and it is executed
+// serially if that only yields one chunk or if it is already within a
+// parallel region. Threaded reductions keep one partial result per chunk and
+// accumulate them in chunk order, so that they do not depend upon the
+// scheduling of the threads.
+Int ParallelGrainSize();
+void SetParallelGrainSize( Int grainSize );
+Int NumParallelChunks( Int work );
+inline bool ParallelizeWork( Int work ) { return NumParallelChunks(work) > 1; }
+
+// The same for loops over entries of type T, which are only ever threaded for
+// packed types: the non-packed types (e.g., BigFloat) allocate their
+// temporaries using per-thread state, such as the default MPFR precision
+template<typename T>
+Int NumParallelChunks( Int work )
+{ return IsPacked<T>::value ? NumParallelChunks(work) : 1; }
+template<typename T>
+bool ParallelizeWork( Int work ) { return NumParallelChunks<T>(work) > 1; }
+
+// If enabled, the floating-point sums of mpi::Reduce, mpi::AllReduce, and
+// mpi::ReduceScatter are binned (see SumBins) so that they do not depend upon
+// the order in which the contributions are combined, and Dot, Dotu, Nrm2,
+// and the Frobenius norms of distributed matrices are binned over all of
+// their terms so that they do not depend upon the process grid
+bool ReproducibleSums();
+void SetReproducibleSums( bool reproducible );
+
 template<typename T,typename=EnableIf<IsScalar<T>>>
 inline const T& Max( const T& m, const T& n ) EL_NO_EXCEPT
 { return std::max(m,n); }
@@ -29,6 +29,24 @@ inline void
 PrintInputReport()
 { GetArgs().PrintReport(); }
 
+// The blocksize of a sequential routine for an n x n problem
+template<typename T>
+inline Int TunedBlocksize( const string& routine, Int n )
+{
+    const Int tuned = LookupTunedBlocksize( routine, TypeName<T>(), 0, 0, n );
+    return ( tuned > 0 ? tuned : Blocksize() );
+}
+
+// The blocksize of a distributed routine for an n x n problem over 'grid'
+template<typename T>
+inline Int TunedBlocksize( const string& routine, const Grid& grid, Int n )
+{
+    const Int tuned =
+      LookupTunedBlocksize
+      ( routine, TypeName<T>(), grid.Height(), grid.Width(), n );
+    return ( tuned > 0 ? tuned : Blocksize() );
+}
+
 template<typename T,typename>
 inline void 
 MemCopy
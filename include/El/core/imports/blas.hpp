@@ -81,6 +81,13 @@ void Axpy
   const dcomplex& alpha, 
   const dcomplex* x, BlasInt incx,
         dcomplex* y, BlasInt incy );
+#ifdef EL_HAVE_QD
+void Axpy
+( BlasInt n,
+  const DoubleDouble& alpha, 
+  const DoubleDouble* x, BlasInt incx,
+        DoubleDouble* y, BlasInt incy );
+#endif
 
 template<typename T>
 void Copy
@@ -114,6 +121,12 @@ double Dot
 ( BlasInt n,
   const double* x, BlasInt incx,
   const double* y, BlasInt incy );
+#ifdef EL_HAVE_QD
+DoubleDouble Dot
+( BlasInt n,
+  const DoubleDouble* x, BlasInt incx,
+  const DoubleDouble* y, BlasInt incy );
+#endif
 
 template<typename T>
 T Dotc
@@ -134,11 +147,20 @@ double Dotu
 ( BlasInt n,
   const double* x, BlasInt incx,
   const double* y, BlasInt incy );
+#ifdef EL_HAVE_QD
+DoubleDouble Dotu
+( BlasInt n,
+  const DoubleDouble* x, BlasInt incx,
+  const DoubleDouble* y, BlasInt incy );
+#endif
 
 template<typename F>
 Base<F> Nrm2( BlasInt n, const F* x, BlasInt incx );
 double Nrm2( BlasInt n, const double  * x, BlasInt incx );
 double Nrm2( BlasInt n, const dcomplex* x, BlasInt incx );
+#ifdef EL_HAVE_QD
+DoubleDouble Nrm2( BlasInt n, const DoubleDouble* x, BlasInt incx );
+#endif
 
 template<typename F>
 BlasInt MaxInd( BlasInt n, const F* x, BlasInt incx );
@@ -253,6 +275,15 @@ void Gemv
   const dcomplex* x, BlasInt incx,
   const dcomplex& beta,
         dcomplex* y, BlasInt incy );
+#ifdef EL_HAVE_QD
+void Gemv
+( char trans, BlasInt m, BlasInt n,
+  const DoubleDouble& alpha,
+  const DoubleDouble* A, BlasInt ALDim, 
+  const DoubleDouble* x, BlasInt incx,
+  const DoubleDouble& beta,
+        DoubleDouble* y, BlasInt incy );
+#endif
 
 template<typename T>
 void Ger
@@ -31,10 +31,22 @@ int NumIntBits();
 int NumIntLimbs();
 void SetMinIntBits( int minIntBits );
 
+// Whether the buffers of Memory<BigFloat> (and hence of Matrix<BigFloat>)
+// place the limbs of all of their entries in a single contiguous slab (using
+// the mpfr_custom_* interface) rather than allocating them one entry at a
+// time. Slab-backed entries have the precision which was in effect when the
+// buffer was allocated, and said precision cannot be changed, so slab
+// storage is disabled by default.
+bool SlabStorage();
+void SetSlabStorage( bool slabStorage );
+
 // NOTE: These should only be called internally
 void RegisterMPI();
 void FreeMPI();
 
+BigFloat* NewSlab( size_t size );
+void DeleteSlab( BigFloat* entries, size_t size );
+
 mpfr_rnd_t RoundingMode();
 
 } // namespace mpfr
@@ -321,10 +333,16 @@ class BigFloat {
 private:
     mpfr_t mpfrFloat_;
     size_t numLimbs_;
+    bool slabBacked_=false;
 
     void SetNumLimbs( mpfr_prec_t prec );
     void Init( mpfr_prec_t prec=mpfr::Precision() );
 
+    // Construct a zero whose limbs are owned by a slab (see mpfr::NewSlab)
+    struct SlabTag { };
+    BigFloat( mpfr_prec_t prec, void* limbs, SlabTag );
+    friend BigFloat* mpfr::NewSlab( size_t size );
+
 public:
     mpfr_ptr    Pointer();
     mpfr_srcptr LockedPointer() const;
@@ -333,6 +351,7 @@ public:
     mpfr_prec_t Precision() const;
     void        SetPrecision( mpfr_prec_t );
     size_t      NumLimbs() const;
+    bool        SlabBacked() const;
 
     // NOTE: The default constructor does not take an mpfr_prec_t as input
     //       due to the ambiguity is would cause with respect to the
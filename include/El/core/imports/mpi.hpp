@@ -20,6 +20,7 @@ namespace mpi {
 #if defined(EL_HAVE_MPI3_NONBLOCKING_COLLECTIVES) || \
     defined(EL_HAVE_MPIX_NONBLOCKING_COLLECTIVES)
 #define EL_HAVE_NONBLOCKING 1
+#define EL_HAVE_NONBLOCKING_COLLECTIVES
 #else
 #define EL_HAVE_NONBLOCKING 0
 #endif
@@ -64,6 +65,19 @@ inline bool operator==( const Group& a, const Group& b ) EL_NO_EXCEPT
 inline bool operator!=( const Group& a, const Group& b ) EL_NO_EXCEPT
 { return a.group != b.group; }
 
+// A window of memory allocated by the root of a communicator whose processes
+// share a node, so that they can all directly address it. The communicator is
+// recorded so that a window is only reused by the processes which share it.
+struct Window
+{
+#if MPI_VERSION >= 3
+    MPI_Win win=MPI_WIN_NULL;
+#endif
+    void* base=nullptr;
+    size_t numBytes=0;
+    Comm comm=MPI_COMM_NULL;
+};
+
 struct Op
 {
     MPI_Op op;
@@ -205,8 +219,15 @@ void Create
 ( Comm parentComm, Group subsetGroup, Comm& subsetComm ) EL_NO_RELEASE_EXCEPT;
 void Dup( Comm original, Comm& duplicate ) EL_NO_RELEASE_EXCEPT;
 void Split( Comm comm, int color, int key, Comm& newComm ) EL_NO_RELEASE_EXCEPT;
+// Split into the subcommunicators of processes which can share memory
+// (i.e., which live on the same node)
+void SplitShared( Comm comm, int key, Comm& newComm ) EL_NO_RELEASE_EXCEPT;
 void Free( Comm& comm ) EL_NO_RELEASE_EXCEPT;
 bool Congruent( Comm comm1, Comm comm2 ) EL_NO_RELEASE_EXCEPT;
+// The name of a communicator identifies it in the traffic statistics; the
+// name of an unnamed communicator is formed from its size
+void SetName( Comm comm, const std::string& name ) EL_NO_RELEASE_EXCEPT;
+std::string Name( Comm comm ) EL_NO_RELEASE_EXCEPT;
 void ErrorHandlerSet
 ( Comm comm, ErrorHandler errorHandler ) EL_NO_RELEASE_EXCEPT;
 
@@ -255,6 +276,54 @@ void Translate
 // Utilities
 void Barrier( Comm comm=COMM_WORLD ) EL_NO_RELEASE_EXCEPT;
 
+// Shared-memory windows
+// ---------------------
+// Allocate 'numBytes' bytes on the root of 'comm' (whose processes must share
+// a node) and return its address, which is valid on every process of 'comm'
+void* AllocateShared
+( size_t numBytes, Comm comm, Window& window ) EL_NO_RELEASE_EXCEPT;
+// Make the updates of each process to the window visible to the others
+// (this is collective over 'comm')
+void SyncShared( Window window, Comm comm ) EL_NO_RELEASE_EXCEPT;
+void Free( Window& window ) EL_NO_RELEASE_EXCEPT;
+
+// Traffic accounting
+// ------------------
+// If enabled, each process records the number of calls to every communicating
+// routine below, the number of bytes which it nominally sent and received in
+// them, and the time spent within MPI, per communicator name and operation.
+// The names of the communicators of a grid include its number (e.g., "MC#0"),
+// and unnamed communicators are numbered in the order of their first use.
+// Non-blocking routines are only charged for the time required to post them.
+struct TrafficStats
+{
+    Int numCalls=0;
+    long long bytesSent=0, bytesRecv=0;
+    double time=0;
+};
+
+struct TrafficEntry
+{
+    std::string commName;
+    std::string operation;
+    TrafficStats stats;
+};
+
+// Accounting is disabled by default
+void SetTrafficAccounting( bool enable );
+bool TrafficAccounting();
+
+// The statistics of the calling process, sorted by communicator name and
+// operation
+vector<TrafficEntry> TrafficSummary();
+void ClearTraffic();
+
+// Collectively write the sum (over the processes of 'comm') of the statistics
+// of each communicator name and operation, along with the average and maximum
+// times, from the root of 'comm' (this is also done by El::Finalize if
+// accounting is enabled)
+void WriteTraffic( std::ostream& os, Comm comm=COMM_WORLD );
+
 template<typename T>
 void Wait( Request<T>& request ) EL_NO_RELEASE_EXCEPT;
 
@@ -637,6 +706,24 @@ void AllGather
 ( const T* sbuf, int sc,
         T* rbuf, int rc, Comm comm ) EL_NO_RELEASE_EXCEPT;
 
+// Non-blocking AllGather
+// ----------------------
+template<typename Real,typename=EnableIf<IsPacked<Real>>>
+void IAllGather
+( const Real* sbuf, int sc,
+        Real* rbuf, int rc, Comm comm,
+  Request<Real>& request );
+template<typename Real,typename=EnableIf<IsPacked<Real>>>
+void IAllGather
+( const Complex<Real>* sbuf, int sc,
+        Complex<Real>* rbuf, int rc, Comm comm,
+  Request<Complex<Real>>& request );
+template<typename T,typename=DisableIf<IsPacked<T>>,typename=void>
+void IAllGather
+( const T* sbuf, int sc,
+        T* rbuf, int rc, Comm comm,
+  Request<T>& request );
+
 // AllGather with variable recv sizes
 // ----------------------------------
 template<typename Real,typename=EnableIf<IsPacked<Real>>>
@@ -704,6 +791,24 @@ void AllToAll
 ( const T* sbuf, int sc,
         T* rbuf, int rc, Comm comm ) EL_NO_RELEASE_EXCEPT;
 
+// Non-blocking AllToAll
+// ---------------------
+template<typename Real,typename=EnableIf<IsPacked<Real>>>
+void IAllToAll
+( const Real* sbuf, int sc,
+        Real* rbuf, int rc, Comm comm,
+  Request<Real>& request );
+template<typename Real,typename=EnableIf<IsPacked<Real>>>
+void IAllToAll
+( const Complex<Real>* sbuf, int sc,
+        Complex<Real>* rbuf, int rc, Comm comm,
+  Request<Complex<Real>>& request );
+template<typename T,typename=DisableIf<IsPacked<T>>,typename=void>
+void IAllToAll
+( const T* sbuf, int sc,
+        T* rbuf, int rc, Comm comm,
+  Request<T>& request );
+
 // AllToAll with non-uniform send/recv sizes
 // -----------------------------------------
 template<typename Real,typename=EnableIf<IsPacked<Real>>>
@@ -861,6 +966,12 @@ inline T AllReduce
 template<typename T>
 T AllReduce( T sb, Comm comm ) EL_NO_RELEASE_EXCEPT;
 
+// Sum the folds of binned sums (see SumBins) in place. Their partial sums are
+// exact, and so they are combined with an ordinary (unbinned) summation even
+// when reproducible sums are requested.
+void AllReduceFolds( double* folds, int count, Comm comm )
+EL_NO_RELEASE_EXCEPT;
+
 // Single-buffer AllReduce
 // -----------------------
 template<typename Real,typename=EnableIf<IsPacked<Real>>>
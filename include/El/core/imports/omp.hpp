@@ -9,9 +9,12 @@
 #ifndef EL_IMPORTS_OMP_HPP
 #define EL_IMPORTS_OMP_HPP
 
+#define EL_PRAGMA(x) _Pragma(#x)
+
 #ifdef EL_HYBRID
 # include <omp.h>
 # define EL_PARALLEL_FOR _Pragma("omp parallel for")
+# define EL_PARALLEL_FOR_IF(cond) EL_PRAGMA(omp parallel for if(cond))
 # ifdef EL_HAVE_OMP_COLLAPSE
 #  define EL_PARALLEL_FOR_COLLAPSE2 _Pragma("omp parallel for collapse(2)")
 # else
@@ -19,6 +22,7 @@
 # endif
 #else
 # define EL_PARALLEL_FOR 
+# define EL_PARALLEL_FOR_IF(cond)
 # define EL_PARALLEL_FOR_COLLAPSE2
 #endif
 
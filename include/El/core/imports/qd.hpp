@@ -779,6 +779,49 @@ inline QuadDouble operator/
 void InitializeQD();
 void FinalizeQD();
 
+namespace qd {
+
+// The instruction sets which the vectorized DoubleDouble kernels may use.
+// The most capable set supported by both the compiler and the running CPU
+// is selected by default.
+namespace SIMDNS {
+enum SIMD {
+  SIMD_NONE,
+  SIMD_AVX2,
+  SIMD_AVX512
+};
+}
+using namespace SIMDNS;
+
+SIMD DetectedSIMD();
+SIMD GetSIMD();
+// Requests for instruction sets beyond DetectedSIMD() are capped
+void SetSIMD( SIMD simd );
+
+// Vectorized kernels over contiguous DoubleDouble data, built from the
+// error-free transformations TwoSum and TwoProd (via FMA). Each returns false
+// (without touching its output) if no vectorized implementation is
+// available, in which case the caller should fall back to scalar code.
+// NOTE: The lanes are combined at the end of Dot and Nrm2, so the results
+//       may differ in the last bits from a sequential accumulation.
+
+// y := alpha x + y
+bool Axpy
+( Int n, const DoubleDouble& alpha, const DoubleDouble* x, DoubleDouble* y );
+// x^T y
+bool Dot
+( Int n, const DoubleDouble* x, const DoubleDouble* y, DoubleDouble& result );
+// || x ||_2 (with power-of-two scaling to avoid overflow and underflow)
+bool Nrm2( Int n, const DoubleDouble* x, DoubleDouble& result );
+// C := alpha A B + C, where the 8 x kc matrix A is stored in column-major
+// order and the kc x 4 matrix B is stored in row-major order
+bool GemmMicroKernel
+( Int kc, const DoubleDouble& alpha,
+  const DoubleDouble* A, const DoubleDouble* B,
+  DoubleDouble* C, Int CLDim );
+
+} // namespace qd
+
 } // namespace El
 #endif // ifdef EL_HAVE_QD
 
@@ -99,6 +99,57 @@ F SampleBall( const F& center=F(0), const Base<F>& radius=Base<F>(1) );
 template<typename Real,typename=EnableIf<IsReal<Real>>> 
 Real SampleBall( const Real& center=Real(0), const Real& radius=Real(1) );
 
+// Counter-based random number generation
+// =======================================
+// The Philox4x32-10 generator of Salmon et al., "Parallel random numbers: As
+// easy as 1, 2, 3", maps a 128-bit counter and a 64-bit key to 128 random
+// bits without any state, so that the samples of entry (i,j) of a random
+// matrix can be computed directly from (seed,stream,i,j) by any process (or
+// thread) in any order.
+typedef std::array<std::uint32_t,4> PhiloxCounter;
+typedef std::array<std::uint32_t,2> PhiloxKey;
+PhiloxCounter Philox4x32( PhiloxCounter counter, PhiloxKey key );
+
+// A stream of samples indexed by the global indices of matrix entries, where
+// each entry has two independent samples from the uniform distribution over
+// [0,1) from which its other samples are computed
+class RandomStream
+{
+public:
+    RandomStream( unsigned long long seed, unsigned long long stream );
+
+    void Uniforms( Int i, Int j, double& u0, double& u1 ) const;
+    double Uniform( Int i, Int j ) const;
+
+    // Analogues of SampleBall and SampleNormal
+    template<typename T>
+    T Ball( Int i, Int j, const T& center, const Base<T>& radius ) const;
+    template<typename T>
+    T Normal( Int i, Int j, const T& mean, const Base<T>& stddev ) const;
+
+private:
+    PhiloxKey key_;
+};
+
+// If enabled (the default), the random distributed matrices are generated
+// from a new RandomStream for each call, so that they do not depend upon the
+// process grid. The streams are numbered in the order in which they are
+// requested, and, since processes outside of a matrix's communicator do not
+// request its stream, the processes of 'comm' agree upon the largest of their
+// next stream numbers (which requires a small reduction).
+bool CounterBasedRandom();
+void SetCounterBasedRandom( bool counterBased );
+RandomStream NewRandomStream( mpi::Comm comm );
+// Restart the numbering of the streams from zero with the given seed (which
+// must agree on every process), e.g., to reproduce a sequence of random
+// matrices. The seed is initially determined by Initialize.
+unsigned long long RandomStreamSeed();
+void SetRandomStreamSeed( unsigned long long seed );
+
+template<typename T>
+bool UseRandomStream()
+{ return IsBlasScalar<T>::value && CounterBasedRandom(); }
+
 // To be used internally by Elemental
 void InitializeRandom( bool deterministic=true );
 void FinalizeRandom();
@@ -223,6 +223,100 @@ template<typename Real,typename>
 Real SampleBall( const Real& center, const Real& radius )
 { return SampleUniform(center-radius,center+radius); }
 
+inline PhiloxCounter Philox4x32( PhiloxCounter counter, PhiloxKey key )
+{
+    const std::uint32_t multipliers[2] = { 0xD2511F53, 0xCD9E8D57 };
+    const std::uint32_t weyl[2] = { 0x9E3779B9, 0xBB67AE85 };
+    const Int numRounds = 10;
+    for( Int round=0; round<numRounds; ++round )
+    {
+        if( round > 0 )
+        {
+            key[0] += weyl[0];
+            key[1] += weyl[1];
+        }
+        const std::uint64_t prod0 = std::uint64_t(multipliers[0])*counter[0];
+        const std::uint64_t prod1 = std::uint64_t(multipliers[1])*counter[2];
+        counter =
+          { std::uint32_t(prod1>>32) ^ counter[1] ^ key[0],
+            std::uint32_t(prod1),
+            std::uint32_t(prod0>>32) ^ counter[3] ^ key[1],
+            std::uint32_t(prod0) };
+    }
+    return counter;
+}
+
+inline RandomStream::RandomStream
+( unsigned long long seed, unsigned long long stream )
+: key_{{ std::uint32_t(seed) ^ std::uint32_t(seed>>32),
+         std::uint32_t(stream) ^ std::uint32_t(stream>>32) }}
+{ }
+
+inline void RandomStream::Uniforms
+( Int i, Int j, double& u0, double& u1 ) const
+{
+    const std::uint64_t iBits = i;
+    const std::uint64_t jBits = j;
+    const PhiloxCounter bits = Philox4x32
+      ( {{ std::uint32_t(iBits), std::uint32_t(iBits>>32),
+           std::uint32_t(jBits), std::uint32_t(jBits>>32) }}, key_ );
+
+    // Use the leading 53 bits of each 64-bit half
+    const double unitRoundoff = std::ldexp( 1., -53 );
+    u0 = double(((std::uint64_t(bits[0])<<32) | bits[1]) >> 11)*unitRoundoff;
+    u1 = double(((std::uint64_t(bits[2])<<32) | bits[3]) >> 11)*unitRoundoff;
+}
+
+inline double RandomStream::Uniform( Int i, Int j ) const
+{
+    double u0, u1;
+    Uniforms( i, j, u0, u1 );
+    return u0;
+}
+
+template<typename T>
+T RandomStream::Ball
+( Int i, Int j, const T& center, const Base<T>& radius ) const
+{
+    typedef Base<T> Real;
+    double u0, u1;
+    Uniforms( i, j, u0, u1 );
+    T sample = center;
+    if( IsComplex<T>::value )
+    {
+        const Real r = radius*Real(u0);
+        const double angle = 2*Pi<double>()*u1;
+        UpdateRealPart( sample, r*Real(std::cos(angle)) );
+        UpdateImagPart( sample, r*Real(std::sin(angle)) );
+    }
+    else
+        UpdateRealPart( sample, radius*Real(2*u0-1) );
+    return sample;
+}
+
+template<typename T>
+T RandomStream::Normal
+( Int i, Int j, const T& mean, const Base<T>& stddev ) const
+{
+    typedef Base<T> Real;
+    double u0, u1;
+    Uniforms( i, j, u0, u1 );
+
+    // Use the Box-Muller transform (with 1-u0 in (0,1])
+    const double radius = std::sqrt(-2*std::log1p(-u0));
+    const double angle = 2*Pi<double>()*u1;
+    T sample = mean;
+    if( IsComplex<T>::value )
+    {
+        const Real stddevAdj = stddev/Sqrt(Real(2));
+        UpdateRealPart( sample, stddevAdj*Real(radius*std::cos(angle)) );
+        UpdateImagPart( sample, stddevAdj*Real(radius*std::sin(angle)) );
+    }
+    else
+        UpdateRealPart( sample, stddev*Real(radius*std::cos(angle)) );
+    return sample;
+}
+
 } // namespace El
 
 #endif // ifndef EL_RANDOM_IMPL_HPP
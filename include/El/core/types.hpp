@@ -401,6 +401,18 @@ enum GridOrder
 }
 using namespace GridOrderNS;
 
+// How the processes of a communicator are placed within a process grid:
+// either directly by their rank or so that the processes which share a node
+// are (as much as possible) in the same process columns
+namespace GridPlacementNS {
+enum GridPlacement
+{
+    RANK_ORDERED,
+    NODE_AWARE
+};
+}
+using namespace GridPlacementNS;
+
 namespace LeftOrRightNS {
 enum LeftOrRight
 {
@@ -197,6 +197,16 @@ Base<F> FrobeniusNorm( const DistSparseMatrix<F>& A );
 template<typename F>
 Base<F> FrobeniusNorm( const DistMultiVec<F>& A );
 
+// Queue the local contributions to the Frobenius norm of A into a deferred
+// reduction over a communicator containing every process of the grid (or
+// communicator) of A and return the slot of the result
+template<typename F>
+Int QueueFrobeniusNorm
+( const AbstractDistMatrix<F>& A, DeferredReduction<Base<F>>& reduction );
+template<typename F>
+Int QueueFrobeniusNorm
+( const DistMultiVec<F>& A, DeferredReduction<Base<F>>& reduction );
+
 template<typename F>
 Base<F> HermitianFrobeniusNorm
 ( UpperOrLower uplo, const Matrix<F>& A );
@@ -307,6 +317,15 @@ Base<T> MaxNorm( const DistSparseMatrix<T>& A );
 template<typename T>
 Base<T> MaxNorm( const DistMultiVec<T>& A );
 
+// Queue the local contributions to the max norm of A into a deferred
+// reduction (see QueueFrobeniusNorm)
+template<typename F>
+Int QueueMaxNorm
+( const AbstractDistMatrix<F>& A, DeferredReduction<Base<F>>& reduction );
+template<typename F>
+Int QueueMaxNorm
+( const DistMultiVec<F>& A, DeferredReduction<Base<F>>& reduction );
+
 template<typename T>
 Base<T> HermitianMaxNorm( UpperOrLower uplo, const Matrix<T>& A );
 template<typename T>
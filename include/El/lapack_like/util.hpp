@@ -127,6 +127,28 @@ void MergeSortingPermutation
 ( Int n0, Int n1, const Matrix<Real>& x, Permutation& sortPerm,
   SortType sort=ASCENDING );
 
+// Blocksize tuning
+// ================
+// Time each candidate blocksize on a random n x n problem (keeping the best of
+// 'numReps' runs) and record the fastest as the tuned blocksize of the routine
+// (see SetTunedBlocksize), which is also returned. The supported routines are
+// "LU" and "Cholesky" and, for process grids, "HermitianTridiag", "LocalTrrk"
+// (timed via Herk), and "LocalSymv" (timed via Symv). The local blocksizes are
+// independent of the grid and problem size and only take effect if they were
+// not explicitly set (e.g., via SetLocalTrrkBlocksize).
+//
+// Each run is timed by the slowest process so that every process records the
+// same blocksize, and so the sequential version is collective over
+// mpi::COMM_WORLD (and the distributed version over the grid's viewers).
+template<typename F>
+Int TuneBlocksize
+( const string& routine, Int n,
+  const vector<Int>& candidates={32,48,64,96,128,192,256}, Int numReps=3 );
+template<typename F>
+Int TuneBlocksize
+( const string& routine, const Grid& grid, Int n,
+  const vector<Int>& candidates={32,48,64,96,128,192,256}, Int numReps=3 );
+
 } // namespace El
 
 #endif // ifndef EL_UTIL_HPP
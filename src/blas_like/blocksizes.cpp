@@ -8,22 +8,72 @@
 */
 #include <El-lite.hpp>
 #include <El/blas_like.hpp>
+#include <map>
 #include <stack>
+#include <tuple>
 
 namespace {
 using namespace El;
 
 std::stack<Int> blocksizeStack;
 
+// The tuned blocksizes of each (routine,datatype,gridHeight,gridWidth),
+// indexed by the size bucket
+typedef std::tuple<string,string,int,int> TuningKey;
+std::map<TuningKey,std::map<Int,Int>> tunedBlocksizes;
+// Incremented whenever the tuned blocksizes change
+Int tuningVersion = 0;
+
+Int SizeBucket( Int n )
+{
+    Int bucket = 0;
+    while( (Int(2) << bucket) <= n )
+        ++bucket;
+    return bucket;
+}
+
+// A value of zero for the local Symv and Trrk blocksizes means that they were
+// not explicitly set, so the tuned value (or 64) is used
 template<typename T>
 struct LocalSymvBlocksizeHelper { static Int value; };
 template<typename T>
-Int LocalSymvBlocksizeHelper<T>::value = 64;
+Int LocalSymvBlocksizeHelper<T>::value = 0;
 
 template<typename T>
 struct LocalTrrkBlocksizeHelper { static Int value; };
 template<typename T>
-Int LocalTrrkBlocksizeHelper<T>::value = 64;
+Int LocalTrrkBlocksizeHelper<T>::value = 0;
+
+// The tuned local Symv and Trrk blocksizes of each datatype (zero if there are
+// none), which are only looked up again after the tuned blocksizes change
+template<typename T>
+struct LocalTunedBlocksizes
+{
+    static Int version, symv, trrk;
+
+    static void Update()
+    {
+        if( version == ::tuningVersion )
+            return;
+        const string type = TypeName<T>();
+        symv = El::LookupTunedBlocksize( "LocalSymv", type, 0, 0, 0 );
+        trrk = El::LookupTunedBlocksize( "LocalTrrk", type, 0, 0, 0 );
+        version = ::tuningVersion;
+    }
+};
+template<typename T>
+Int LocalTunedBlocksizes<T>::version = -1;
+template<typename T>
+Int LocalTunedBlocksizes<T>::symv = 0;
+template<typename T>
+Int LocalTunedBlocksizes<T>::trrk = 0;
+
+Int LocalBlocksize( Int value, Int tuned )
+{
+    if( value > 0 )
+        return value;
+    return ( tuned > 0 ? tuned : 64 );
+}
 
 template<typename T>
 struct LocalTrr2kBlocksizeHelper { static Int value; };
@@ -70,13 +120,117 @@ void EmptyBlocksizeStack()
         ::blocksizeStack.pop();
 }
 
+Int LookupTunedBlocksize
+( const string& routine, const string& type,
+  int gridHeight, int gridWidth, Int n )
+{
+    auto it =
+      ::tunedBlocksizes.find( TuningKey(routine,type,gridHeight,gridWidth) );
+    if( it == ::tunedBlocksizes.end() || it->second.empty() )
+        return 0;
+
+    // Use the nearest size bucket
+    const auto& buckets = it->second;
+    const Int bucket = ::SizeBucket( n );
+    auto above = buckets.lower_bound( bucket );
+    if( above == buckets.end() )
+        return std::prev(above)->second;
+    if( above == buckets.begin() || above->first == bucket )
+        return above->second;
+    auto below = std::prev(above);
+    return ( bucket-below->first <= above->first-bucket ? below->second
+                                                         : above->second );
+}
+
+void SetTunedBlocksize
+( const string& routine, const string& type,
+  int gridHeight, int gridWidth, Int n, Int blocksize )
+{
+    if( blocksize <= 0 )
+        LogicError("Tuned blocksizes must be positive");
+    ::tunedBlocksizes[TuningKey(routine,type,gridHeight,gridWidth)]
+      [::SizeBucket(n)] = blocksize;
+    ++::tuningVersion;
+}
+
+void ClearTunedBlocksizes()
+{
+    ::tunedBlocksizes.clear();
+    ++::tuningVersion;
+}
+
+void LoadTunedBlocksizes( const string& filename )
+{
+    DEBUG_CSE
+    // Read the file on the root and broadcast its contents so that every
+    // process loads the same table
+    const mpi::Comm comm = mpi::COMM_WORLD;
+    const int root = 0;
+    string contents;
+    int size = -1;
+    if( mpi::Rank(comm) == root )
+    {
+        std::ifstream file( filename.c_str() );
+        if( file.is_open() )
+        {
+            std::ostringstream stream;
+            stream << file.rdbuf();
+            contents = stream.str();
+            size = contents.size();
+        }
+    }
+    mpi::Broadcast( size, root, comm );
+    if( size < 0 )
+        RuntimeError("Could not open ",filename);
+    contents.resize( size );
+    mpi::Broadcast( reinterpret_cast<byte*>(&contents[0]), size, root, comm );
+
+    std::istringstream file( contents );
+    string line;
+    while( std::getline( file, line ) )
+    {
+        if( line.empty() || line[0] == '#' )
+            continue;
+        std::istringstream lineStream( line );
+        string routine, type;
+        int gridHeight, gridWidth;
+        Int bucket, blocksize;
+        if( !(lineStream >> routine >> type >> gridHeight >> gridWidth
+                         >> bucket >> blocksize) || blocksize <= 0 )
+            RuntimeError("Invalid tuning entry: ",line);
+        ::tunedBlocksizes[TuningKey(routine,type,gridHeight,gridWidth)]
+          [bucket] = blocksize;
+    }
+    ++::tuningVersion;
+}
+
+void SaveTunedBlocksizes( const string& filename )
+{
+    DEBUG_CSE
+    std::ofstream file( filename.c_str() );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    file << "# routine type gridHeight gridWidth sizeBucket blocksize\n";
+    for( const auto& entry : ::tunedBlocksizes )
+        for( const auto& bucket : entry.second )
+            file << std::get<0>(entry.first) << " "
+                 << std::get<1>(entry.first) << " "
+                 << std::get<2>(entry.first) << " "
+                 << std::get<3>(entry.first) << " "
+                 << bucket.first << " " << bucket.second << "\n";
+}
+
 template<typename T>
 void SetLocalSymvBlocksize( Int blocksize )
 { LocalSymvBlocksizeHelper<T>::value = blocksize; }
 
 template<typename T>
 Int LocalSymvBlocksize()
-{ return LocalSymvBlocksizeHelper<T>::value; }
+{
+    ::LocalTunedBlocksizes<T>::Update();
+    return ::LocalBlocksize
+    ( LocalSymvBlocksizeHelper<T>::value, ::LocalTunedBlocksizes<T>::symv );
+}
 
 template<typename T>
 void SetLocalTrrkBlocksize( Int blocksize )
@@ -84,7 +238,11 @@ void SetLocalTrrkBlocksize( Int blocksize )
 
 template<typename T>
 Int LocalTrrkBlocksize()
-{ return LocalTrrkBlocksizeHelper<T>::value; }
+{
+    ::LocalTunedBlocksizes<T>::Update();
+    return ::LocalBlocksize
+    ( LocalTrrkBlocksizeHelper<T>::value, ::LocalTunedBlocksizes<T>::trrk );
+}
 
 template<typename T>
 void SetLocalTrr2kBlocksize( Int blocksize )
@@ -9,8 +9,31 @@
 #include <El-lite.hpp>
 #include <El/blas_like/level1.hpp>
 
+namespace {
+
+// The number of bytes per process that the general-purpose redistributions
+// may use for their buffers (zero for no limit)
+size_t redistMemoryLimit = 0;
+
+// Whether replicated all-gathers are backed by node-shared windows
+bool sharedReplication = false;
+
+} // anonymous namespace
+
 namespace El {
 
+void SetRedistMemoryLimit( size_t numBytes )
+{ ::redistMemoryLimit = numBytes; }
+
+size_t RedistMemoryLimit()
+{ return ::redistMemoryLimit; }
+
+void SetSharedReplication( bool shared )
+{ ::sharedReplication = shared; }
+
+bool SharedReplication()
+{ return ::sharedReplication; }
+
 void Copy( const Graph& A, Graph& B )
 {
     DEBUG_CSE
@@ -26,15 +26,48 @@ T HilbertSchmidt( const Matrix<T>& A, const Matrix<T>& B )
     const T* BBuf = B.LockedBuffer();
     const Int ALDim = A.LDim();
     const Int BLDim = B.LDim();
+    if( UseReproducibleSum<T>() )
+    {
+        auto term = [&]( Int k )
+          {
+              const Int i = k % height;
+              const Int j = k / height;
+              return Conj(ABuf[i+j*ALDim])*BBuf[i+j*BLDim];
+          };
+        return ReproducibleSum<T>( height*width, term, mpi::COMM_SELF );
+    }
     if( height == ALDim && height == BLDim )
     {
-        innerProd += blas::Dot( height*width, ABuf, 1, BBuf, 1 );
+        const Int size = height*width;
+        const Int numChunks = NumParallelChunks<T>( size );
+        vector<T> partials( numChunks );
+        EL_PARALLEL_FOR_IF(numChunks > 1)
+        for( Int chunk=0; chunk<numChunks; ++chunk )
+        {
+            const Int start = (chunk*size) / numChunks;
+            const Int end = ((chunk+1)*size) / numChunks;
+            partials[chunk] =
+              blas::Dot( end-start, &ABuf[start], 1, &BBuf[start], 1 );
+        }
+        for( Int chunk=0; chunk<numChunks; ++chunk )
+            innerProd += partials[chunk];
     }
     else
     {
-        for( Int j=0; j<width; ++j )
-            for( Int i=0; i<height; ++i )
-                innerProd += Conj(ABuf[i+j*ALDim])*BBuf[i+j*BLDim];
+        const Int numChunks = Min( NumParallelChunks<T>(height*width), width );
+        vector<T> partials( numChunks, T(0) );
+        EL_PARALLEL_FOR_IF(numChunks > 1)
+        for( Int chunk=0; chunk<numChunks; ++chunk )
+        {
+            const Int jStart = (chunk*width) / numChunks;
+            const Int jEnd = ((chunk+1)*width) / numChunks;
+            for( Int j=jStart; j<jEnd; ++j )
+                for( Int i=0; i<height; ++i )
+                    partials[chunk] +=
+                      Conj(ABuf[i+j*ALDim])*BBuf[i+j*BLDim];
+        }
+        for( Int chunk=0; chunk<numChunks; ++chunk )
+            innerProd += partials[chunk];
     }
     return innerProd;
 }
@@ -57,26 +90,40 @@ T HilbertSchmidt
     T innerProd;
     if( A.Participating() )
     {
-        T localInnerProd(0);
         const Int localHeight = A.LocalHeight();
         const Int localWidth = A.LocalWidth();
         const T* ABuf = A.LockedBuffer();
         const T* BBuf = B.LockedBuffer();
         const Int ALDim = A.LDim();
         const Int BLDim = B.LDim();
-        if( localHeight == ALDim && localHeight == BLDim )
+        if( UseReproducibleSum<T>() )
         {
-            localInnerProd += 
-              blas::Dot( localHeight*localWidth, ABuf, 1, BBuf, 1 );
+            auto term = [&]( Int k )
+              {
+                  const Int iLoc = k % localHeight;
+                  const Int jLoc = k / localHeight;
+                  return Conj(ABuf[iLoc+jLoc*ALDim])*BBuf[iLoc+jLoc*BLDim];
+              };
+            innerProd = ReproducibleSum<T>
+              ( localHeight*localWidth, term, A.DistComm() );
         }
         else
         {
-            for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-                for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-                    localInnerProd += Conj(ABuf[iLoc+jLoc*ALDim])*
-                                           BBuf[iLoc+jLoc*BLDim];
+            T localInnerProd(0);
+            if( localHeight == ALDim && localHeight == BLDim )
+            {
+                localInnerProd += 
+                  blas::Dot( localHeight*localWidth, ABuf, 1, BBuf, 1 );
+            }
+            else
+            {
+                for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+                    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                        localInnerProd += Conj(ABuf[iLoc+jLoc*ALDim])*
+                                               BBuf[iLoc+jLoc*BLDim];
+            }
+            innerProd = mpi::AllReduce( localInnerProd, A.DistComm() );
         }
-        innerProd = mpi::AllReduce( localInnerProd, A.DistComm() );
     }
     mpi::Broadcast( innerProd, A.Root(), A.CrossComm() );
     return innerProd;
@@ -102,6 +149,16 @@ T HilbertSchmidt( const DistMultiVec<T>& A, const DistMultiVec<T>& B )
     const T* BBuf = B.LockedMatrix().LockedBuffer();
     const Int ALDim = A.LockedMatrix().LDim();
     const Int BLDim = B.LockedMatrix().LDim();
+    if( UseReproducibleSum<T>() )
+    {
+        auto term = [&]( Int k )
+          {
+              const Int iLoc = k % localHeight;
+              const Int j = k / localHeight;
+              return Conj(ABuf[iLoc+j*ALDim])*BBuf[iLoc+j*BLDim];
+          };
+        return ReproducibleSum<T>( localHeight*width, term, A.Comm() );
+    }
     for( Int j=0; j<width; ++j )
         for( Int iLoc=0; iLoc<localHeight; ++iLoc )
             localInnerProd += Conj(ABuf[iLoc+j*ALDim])*BBuf[iLoc+j*BLDim];
@@ -9,19 +9,59 @@
 #include <El-lite.hpp>
 #include <El/blas_like/level3.hpp>
 
+#include "./Gemm/Pipelined.hpp"
+#include "./Gemm/Cannon.hpp"
 #include "./Gemm/NN.hpp"
 #include "./Gemm/NT.hpp"
 #include "./Gemm/TN.hpp"
 #include "./Gemm/TT.hpp"
+#include "./Gemm/Ozaki.hpp"
+#include "./Gemm/25D.hpp"
+
+namespace {
+
+// The engine for the local products of the distributed Gemm in progress
+El::GemmEngine localEngine = El::GEMM_ENGINE_DEFAULT;
+
+struct LocalEngineScope
+{
+    El::GemmEngine oldEngine;
+
+    LocalEngineScope( El::GemmEngine engine )
+    : oldEngine(::localEngine)
+    {
+        if( engine != El::GEMM_ENGINE_DEFAULT )
+            ::localEngine = engine;
+    }
+    ~LocalEngineScope() { ::localEngine = oldEngine; }
+};
+
+El::Int gemm25DDepth = 0;
+size_t gemm25DMemoryLimit = 0;
+
+} // anonymous namespace
 
 namespace El {
 
+void SetGemm25DDepth( Int depth )
+{ ::gemm25DDepth = depth; }
+
+Int Gemm25DDepth()
+{ return ::gemm25DDepth; }
+
+void SetGemm25DMemoryLimit( size_t numBytes )
+{ ::gemm25DMemoryLimit = numBytes; }
+
+size_t Gemm25DMemoryLimit()
+{ return ::gemm25DMemoryLimit; }
+
 template<typename T>
 void Gemm
 ( Orientation orientA, Orientation orientB,
   T alpha, const Matrix<T>& A,
            const Matrix<T>& B, 
-  T beta,        Matrix<T>& C )
+  T beta,        Matrix<T>& C,
+  GemmEngine engine )
 {
     DEBUG_CSE
     if( orientA == NORMAL && orientB == NORMAL )
@@ -57,6 +97,11 @@ void Gemm
     const Int m = C.Height();
     const Int n = C.Width();
     const Int k = ( orientA == NORMAL ? A.Width() : A.Height() );
+    if( engine == GEMM_ENGINE_DEFAULT )
+        engine = ::localEngine;
+    if( engine == GEMM_OZAKI &&
+        gemm::Ozaki( orientA, orientB, alpha, A, B, beta, C ) )
+        return;
     if( k != 0 )
     {
         blas::Gemm
@@ -76,14 +121,15 @@ void Gemm
 ( Orientation orientA, Orientation orientB,
   T alpha, const Matrix<T>& A,
            const Matrix<T>& B, 
-                 Matrix<T>& C )
+                 Matrix<T>& C,
+  GemmEngine engine )
 {
     DEBUG_CSE
     const Int m = ( orientA==NORMAL ? A.Height() : A.Width() );
     const Int n = ( orientB==NORMAL ? B.Width() : B.Height() );
     C.Resize( m, n );
     Zero( C );
-    Gemm( orientA, orientB, alpha, A, B, T(0), C );
+    Gemm( orientA, orientB, alpha, A, B, T(0), C, engine );
 }
 
 template<typename T>
@@ -92,16 +138,27 @@ void Gemm
   T alpha, const AbstractDistMatrix<T>& A,
            const AbstractDistMatrix<T>& B,
   T beta,        AbstractDistMatrix<T>& C, 
-  GemmAlgorithm alg )
+  GemmAlgorithm alg, GemmEngine engine )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("Gemm")
+    LocalEngineScope scope( engine );
+    if( alg == GEMM_DEFAULT && HavePerfModel() )
+        alg = ModeledGemmAlgorithm( orientA, orientB, A, B, C, GetPerfModel() );
     C *= beta;
-    if( orientA == NORMAL && orientB == NORMAL )
+    if( alg == GEMM_25D )
+    {
+        gemm::Gemm25D
+        ( orientA, orientB, alpha, A, B, C,
+          ::gemm25DDepth, ::gemm25DMemoryLimit );
+    }
+    else if( alg == GEMM_CANNON )
+    {
+        gemm::Cannon( orientA, orientB, alpha, A, B, C );
+    }
+    else if( orientA == NORMAL && orientB == NORMAL )
     {
-        if( alg == GEMM_CANNON )
-            gemm::Cannon_NN( alpha, A, B, C );
-        else 
-            gemm::SUMMA_NN( alpha, A, B, C, alg );
+        gemm::SUMMA_NN( alpha, A, B, C, alg );
     }
     else if( orientA == NORMAL )
     {
@@ -122,14 +179,15 @@ void Gemm
 ( Orientation orientA, Orientation orientB,
   T alpha, const AbstractDistMatrix<T>& A,
            const AbstractDistMatrix<T>& B,
-                 AbstractDistMatrix<T>& C, GemmAlgorithm alg )
+                 AbstractDistMatrix<T>& C,
+  GemmAlgorithm alg, GemmEngine engine )
 {
     DEBUG_CSE
     const Int m = ( orientA==NORMAL ? A.Height() : A.Width() );
     const Int n = ( orientB==NORMAL ? B.Width() : B.Height() );
     C.Resize( m, n );
     Zero( C );
-    Gemm( orientA, orientB, alpha, A, B, T(0), C, alg );
+    Gemm( orientA, orientB, alpha, A, B, T(0), C, alg, engine );
 }
 
 template<typename T>
@@ -140,6 +198,7 @@ void LocalGemm
   T beta,        AbstractDistMatrix<T>& C )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("LocalGemm")
     DEBUG_ONLY(
       if( orientA == NORMAL && orientB == NORMAL )
       {
@@ -263,22 +322,24 @@ void LocalGemm
   ( Orientation orientA, Orientation orientB, \
     T alpha, const Matrix<T>& A, \
              const Matrix<T>& B, \
-    T beta,        Matrix<T>& C ); \
+    T beta,        Matrix<T>& C, GemmEngine engine ); \
   template void Gemm \
   ( Orientation orientA, Orientation orientB, \
     T alpha, const Matrix<T>& A, \
              const Matrix<T>& B, \
-                   Matrix<T>& C ); \
+                   Matrix<T>& C, GemmEngine engine ); \
   template void Gemm \
   ( Orientation orientA, Orientation orientB, \
     T alpha, const AbstractDistMatrix<T>& A, \
              const AbstractDistMatrix<T>& B, \
-    T beta,        AbstractDistMatrix<T>& C, GemmAlgorithm alg ); \
+    T beta,        AbstractDistMatrix<T>& C, \
+    GemmAlgorithm alg, GemmEngine engine ); \
   template void Gemm \
   ( Orientation orientA, Orientation orientB, \
     T alpha, const AbstractDistMatrix<T>& A, \
              const AbstractDistMatrix<T>& B, \
-                   AbstractDistMatrix<T>& C, GemmAlgorithm alg ); \
+                   AbstractDistMatrix<T>& C, \
+    GemmAlgorithm alg, GemmEngine engine ); \
   template void LocalGemm \
   ( Orientation orientA, Orientation orientB, \
     T alpha, const AbstractDistMatrix<T>& A, \
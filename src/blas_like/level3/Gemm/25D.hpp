@@ -0,0 +1,201 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <map>
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+namespace El {
+namespace gemm {
+
+// The number of bytes of memory that are available to each process: the
+// currently-available physical memory of the node is split evenly between the
+// viewing processes of the grid which share it. Since this requires splitting
+// the viewing communicator, the result is computed once per grid.
+inline size_t AvailableMemoryPerProcess( const Grid& g )
+{
+    DEBUG_CSE
+#if !defined(_WIN32) && defined(_SC_AVPHYS_PAGES)
+    static std::map<int,size_t> cache;
+    auto it = cache.find( g.Id() );
+    if( it != cache.end() )
+        return it->second;
+    mpi::Comm comm = g.ViewingComm();
+    const long numPages = sysconf( _SC_AVPHYS_PAGES );
+    const long pageSize = sysconf( _SC_PAGESIZE );
+    mpi::Comm nodeComm;
+    mpi::SplitShared( comm, mpi::Rank(comm), nodeComm );
+    const int nodeSize = mpi::Size( nodeComm );
+    mpi::Free( nodeComm );
+    const size_t localBytes =
+      ( numPages <= 0 || pageSize <= 0 ? 0 :
+        size_t(numPages)*size_t(pageSize) / nodeSize );
+    const size_t bytes = mpi::AllReduce( localBytes, mpi::MIN, comm );
+    cache[g.Id()] = bytes;
+    return bytes;
+#else
+    return 0;
+#endif
+}
+
+// The number of bytes per process required by the 2.5D algorithm with
+// replication depth c: each of the c layers of p/c processes holds a 1/c
+// slice of op(A) and op(B) (so that they are not replicated) and a full copy
+// of C, and the sum of the layers is redistributed into one more copy of C.
+template<typename T>
+double Gemm25DBytes( Int m, Int n, Int k, Int p, Int c )
+{
+    return sizeof(T)*(double(c+1)*m*n + double(m)*k + double(k)*n) / p;
+}
+
+// The replication depth to use for a p-process 2.5D algorithm: the largest
+// divisor of p which is at most 'depth' (if it is positive) or, otherwise,
+// the largest divisor of p which is at most the cube root of p (beyond which
+// the 3D algorithm no longer decreases the communication volume) and whose
+// memory requirements fit within 'memoryLimit'.
+template<typename T>
+Int Gemm25DDepth
+( Int m, Int n, Int k, Int p, Int depth, size_t memoryLimit )
+{
+    DEBUG_CSE
+    Int maxDepth = depth;
+    if( maxDepth <= 0 )
+    {
+        maxDepth = 1;
+        while( (maxDepth+1)*(maxDepth+1)*(maxDepth+1) <= p )
+            ++maxDepth;
+    }
+    maxDepth = Min( maxDepth, Min(p,Max(k,Int(1))) );
+    for( Int c=maxDepth; c>1; --c )
+    {
+        if( p % c != 0 )
+            continue;
+        if( depth <= 0 && memoryLimit > 0 &&
+            Gemm25DBytes<T>(m,n,k,p,c) > double(memoryLimit) )
+            continue;
+        return c;
+    }
+    return 1;
+}
+
+// C[MC,MR] += alpha op(A) op(B) via a 2.5D algorithm: the p processes are
+// split into c layers of p/c processes, each with its own (roughly square)
+// grid, the summation dimension is split into c contiguous slices, and the
+// l'th layer computes the product of the l'th slices of op(A) and op(B) with
+// the standard algorithms on its own grid. The layers' contributions are then
+// summed over the c processes with the same position within their layers.
+//
+// Since each layer only communicates within its own p/c processes, the
+// bandwidth cost of the layer products decreases by a factor of roughly
+// sqrt(c) relative to SUMMA on p processes at the expense of c copies of C.
+template<typename T>
+void Gemm25D
+( Orientation orientA, Orientation orientB,
+  T alpha,
+  const AbstractDistMatrix<T>& APre,
+  const AbstractDistMatrix<T>& BPre,
+        AbstractDistMatrix<T>& C,
+  Int depth, size_t memoryLimit )
+{
+    DEBUG_CSE
+    EL_PROFILE_REGION("Gemm25D")
+    const Grid& g = C.Grid();
+    const Int m = C.Height();
+    const Int n = C.Width();
+    const Int k = ( orientA == NORMAL ? APre.Width() : APre.Height() );
+    const Int p = g.Size();
+    if( depth <= 0 && memoryLimit == 0 )
+        memoryLimit = AvailableMemoryPerProcess( g );
+    const Int c = Gemm25DDepth<T>( m, n, k, p, depth, memoryLimit );
+    if( c == 1 )
+    {
+        Gemm( orientA, orientB, alpha, APre, BPre, T(1), C );
+        return;
+    }
+
+    DistMatrixReadProxy<T,T,MC,MR> AProx( APre ), BProx( BPre );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.GetLocked();
+
+    // The (owning) processes are split into c contiguous layers, each with
+    // its own grid, and the processes in the same position of each layer have
+    // identical local portions of their layer's copy of C. Processes which
+    // only view the grid belong to none of the layers, so they merely take
+    // part in the redistributions (and hold the first layer's matrices).
+    const bool inGrid = g.InGrid();
+    const Int layerSize = p / c;
+    const int layer = ( inGrid ? g.OwningRank()/layerSize : 0 );
+    const Grid& myLayerGrid = g.LayerGrid( c, layer );
+    mpi::Comm depthComm = g.LayerDepthComm( c );
+
+    // Hand the l'th slices of op(A) and op(B) to the l'th layer. Every process
+    // takes part in each of the redistributions since it may own pieces of
+    // every slice.
+    DistMatrix<T> ALayer(myLayerGrid),
+                  BLayer(myLayerGrid),
+                  CLayer(myLayerGrid);
+    for( Int l=0; l<c; ++l )
+    {
+        const Grid& layerGrid = g.LayerGrid( c, l );
+        const Range<Int> sliceInd( (l*k)/c, ((l+1)*k)/c );
+        DistMatrix<T> A1(g), B1(g);
+        if( orientA == NORMAL )
+            LockedView( A1, A, ALL, sliceInd );
+        else
+            LockedView( A1, A, sliceInd, ALL );
+        if( orientB == NORMAL )
+            LockedView( B1, B, sliceInd, ALL );
+        else
+            LockedView( B1, B, ALL, sliceInd );
+        DistMatrix<T> A1Layer(layerGrid), B1Layer(layerGrid);
+        A1Layer = A1;
+        B1Layer = B1;
+        if( l == layer )
+        {
+            ALayer = std::move( A1Layer );
+            BLayer = std::move( B1Layer );
+        }
+    }
+
+    // Form each layer's contribution and sum them into the first layer
+    CLayer.Resize( m, n );
+    if( inGrid )
+    {
+        Zero( CLayer );
+        Gemm( orientA, orientB, alpha, ALayer, BLayer, T(0), CLayer );
+        Matrix<T>& CLoc = CLayer.Matrix();
+        if( CLoc.Height() == CLoc.LDim() )
+        {
+            mpi::Reduce
+            ( CLoc.Buffer(), CLoc.Height()*CLoc.Width(), 0, depthComm );
+        }
+        else
+        {
+            for( Int jLoc=0; jLoc<CLoc.Width(); ++jLoc )
+                mpi::Reduce
+                ( CLoc.Buffer(0,jLoc), CLoc.Height(), 0, depthComm );
+        }
+    }
+    ALayer.Empty();
+    BLayer.Empty();
+
+    // Return the sum to the original grid
+    DistMatrix<T> CFirst(g.LayerGrid(c,0));
+    CFirst.Resize( m, n );
+    if( inGrid && layer == 0 )
+        CFirst = std::move( CLayer );
+    CLayer.Empty();
+    DistMatrix<T> CSum(g);
+    CSum = CFirst;
+    CFirst.Empty();
+    Axpy( T(1), CSum, C );
+}
+
+} // namespace gemm
+} // namespace El
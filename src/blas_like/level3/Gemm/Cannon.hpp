@@ -0,0 +1,225 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace El {
+namespace gemm {
+
+// C[MC,MR] += alpha op(A) op(B) via Cannon's algorithm on a q x q grid,
+// where A is [MC,MR] (or [MR,MC] if it is to be (conjugate-)transposed) with
+// its op(A) rows aligned with C, and similarly for B.
+//
+// Each process's local portion of A holds its rows of op(A) for the
+// summation indices congruent to some t modulo q (which only depends upon the
+// process column), and likewise its local portion of B holds its columns of
+// op(B) for the summation indices congruent to some t (which only depends upon
+// the process row). After an initial skew, process (r,c) holds the "packages"
+// of op(A) and op(B) for t = r+c+s (mod q) at step s, and the packages are
+// then circularly shifted to the left and upwards. Since the number of
+// summation indices congruent to t varies with t when q does not divide the
+// summation dimension, the packages are ragged and each process computes the
+// size of the next packages from their residue.
+//
+// The shifts for step s+1 are posted as nonblocking exchanges (into the other
+// of two buffers) before the local update for step s.
+template<typename T,Dist UA,Dist VA,Dist UB,Dist VB>
+void CannonImpl
+( Orientation orientA, Orientation orientB,
+  T alpha,
+  const DistMatrix<T,UA,VA>& A,
+  const DistMatrix<T,UB,VB>& B,
+        DistMatrix<T,MC,MR>& C )
+{
+    DEBUG_CSE
+    const Grid& g = C.Grid();
+    const bool normalA = ( orientA == NORMAL );
+    const bool normalB = ( orientB == NORMAL );
+    const Int k = ( normalA ? A.Width() : A.Height() );
+    const Int q = g.Height();
+    const Int row = g.Row();
+    const Int col = g.Col();
+    mpi::Comm rowComm = g.RowComm();
+    mpi::Comm colComm = g.ColComm();
+    const Int localHeight = C.LocalHeight();
+    const Int localWidth = C.LocalWidth();
+
+    // The alignments of the summation dimension of A (over process columns)
+    // and of B (over process rows)
+    const Int alignSumA = ( normalA ? A.RowAlign() : A.ColAlign() );
+    const Int alignSumB = ( normalB ? B.ColAlign() : B.RowAlign() );
+
+    // Package buffers large enough for any residue
+    const Int maxPkgLength = MaxLength( k, q );
+    vector<T> pkgA[2], pkgB[2];
+    for( Int buffer=0; buffer<2; ++buffer )
+    {
+        FastResize( pkgA[buffer], localHeight*maxPkgLength );
+        FastResize( pkgB[buffer], maxPkgLength*localWidth );
+    }
+
+    // Send our local portions directly (unless they are not contiguous) for
+    // the initial skew
+    const T* ownA = A.LockedBuffer();
+    const T* ownB = B.LockedBuffer();
+    vector<T> ownAPacked, ownBPacked;
+    if( A.LocalHeight() != A.LDim() )
+    {
+        FastResize( ownAPacked, A.LocalHeight()*A.LocalWidth() );
+        lapack::Copy
+        ( 'F', A.LocalHeight(), A.LocalWidth(), A.LockedBuffer(), A.LDim(),
+          ownAPacked.data(), Max(A.LocalHeight(),1) );
+        ownA = ownAPacked.data();
+    }
+    if( B.LocalHeight() != B.LDim() )
+    {
+        FastResize( ownBPacked, B.LocalHeight()*B.LocalWidth() );
+        lapack::Copy
+        ( 'F', B.LocalHeight(), B.LocalWidth(), B.LockedBuffer(), B.LDim(),
+          ownBPacked.data(), Max(B.LocalHeight(),1) );
+        ownB = ownBPacked.data();
+    }
+
+    // Perform the initial skew so that process (r,c) holds the packages for
+    // residue r+c
+    const Int ownResidueA = Mod( col-alignSumA, q );
+    const Int ownResidueB = Mod( row-alignSumB, q );
+    const Int firstResidue = Mod( row+col, q );
+    const Int firstLength = Length( k, firstResidue, q );
+    mpi::SendRecv
+    ( ownA, A.LocalHeight()*A.LocalWidth(), Mod(ownResidueA-row,q),
+      pkgA[0].data(), localHeight*firstLength, Mod(firstResidue+alignSumA,q),
+      rowComm );
+    mpi::SendRecv
+    ( ownB, B.LocalHeight()*B.LocalWidth(), Mod(ownResidueB-col,q),
+      pkgB[0].data(), firstLength*localWidth, Mod(firstResidue+alignSumB,q),
+      colComm );
+    ownAPacked.clear();
+    ownBPacked.clear();
+
+    const Int aboveRow = Mod(row-1,q);
+    const Int belowRow = Mod(row+1,q);
+    const Int leftCol  = Mod(col-1,q);
+    const Int rightCol = Mod(col+1,q);
+    Matrix<T> APkg, BPkg;
+    for( Int s=0; s<q; ++s )
+    {
+        const Int buffer = s % 2;
+        const Int length = Length( k, Mod(row+col+s,q), q );
+
+        // Start shifting the packages for the next step
+        mpi::Request<T> requests[4];
+        if( s != q-1 )
+        {
+            const Int nextLength = Length( k, Mod(row+col+s+1,q), q );
+            mpi::IRecv
+            ( pkgA[1-buffer].data(), localHeight*nextLength, rightCol, rowComm,
+              requests[0] );
+            mpi::IRecv
+            ( pkgB[1-buffer].data(), nextLength*localWidth, belowRow, colComm,
+              requests[1] );
+            mpi::ISend
+            ( pkgA[buffer].data(), localHeight*length, leftCol, rowComm,
+              requests[2] );
+            mpi::ISend
+            ( pkgB[buffer].data(), length*localWidth, aboveRow, colComm,
+              requests[3] );
+        }
+
+        // C[MC,MR] += alpha op(A)[MC,t] op(B)[t,MR]
+        if( normalA )
+            APkg.LockedAttach
+            ( localHeight, length, pkgA[buffer].data(), Max(localHeight,1) );
+        else
+            APkg.LockedAttach
+            ( length, localHeight, pkgA[buffer].data(), Max(length,Int(1)) );
+        if( normalB )
+            BPkg.LockedAttach
+            ( length, localWidth, pkgB[buffer].data(), Max(length,Int(1)) );
+        else
+            BPkg.LockedAttach
+            ( localWidth, length, pkgB[buffer].data(), Max(localWidth,1) );
+        Gemm( orientA, orientB, alpha, APkg, BPkg, T(1), C.Matrix() );
+
+        if( s != q-1 )
+            mpi::WaitAll( 4, requests );
+    }
+}
+
+// Cannon's algorithm for any orientations and shapes (on square grids)
+template<typename T>
+void Cannon
+( Orientation orientA, Orientation orientB,
+  T alpha,
+  const AbstractDistMatrix<T>& APre,
+  const AbstractDistMatrix<T>& BPre,
+        AbstractDistMatrix<T>& CPre )
+{
+    DEBUG_CSE
+    EL_PROFILE_REGION("Cannon")
+    const Grid& g = APre.Grid();
+    if( g.Height() != g.Width() )
+        LogicError("Process grid must be square for Cannon's");
+
+    DistMatrixReadWriteProxy<T,T,MC,MR> CProx( CPre );
+    auto& C = CProx.Get();
+
+    // Align the rows of op(A) and the columns of op(B) with C
+    ElementalProxyCtrl ctrlA, ctrlB;
+    if( orientA == NORMAL )
+    {
+        ctrlA.colConstrain = true;
+        ctrlA.colAlign = C.ColAlign();
+    }
+    else
+    {
+        ctrlA.rowConstrain = true;
+        ctrlA.rowAlign = C.ColAlign();
+    }
+    if( orientB == NORMAL )
+    {
+        ctrlB.rowConstrain = true;
+        ctrlB.rowAlign = C.RowAlign();
+    }
+    else
+    {
+        ctrlB.colConstrain = true;
+        ctrlB.colAlign = C.RowAlign();
+    }
+
+    if( orientA == NORMAL && orientB == NORMAL )
+    {
+        DistMatrixReadProxy<T,T,MC,MR> AProx( APre, ctrlA );
+        DistMatrixReadProxy<T,T,MC,MR> BProx( BPre, ctrlB );
+        CannonImpl
+        ( orientA, orientB, alpha, AProx.GetLocked(), BProx.GetLocked(), C );
+    }
+    else if( orientA == NORMAL )
+    {
+        DistMatrixReadProxy<T,T,MC,MR> AProx( APre, ctrlA );
+        DistMatrixReadProxy<T,T,MR,MC> BProx( BPre, ctrlB );
+        CannonImpl
+        ( orientA, orientB, alpha, AProx.GetLocked(), BProx.GetLocked(), C );
+    }
+    else if( orientB == NORMAL )
+    {
+        DistMatrixReadProxy<T,T,MR,MC> AProx( APre, ctrlA );
+        DistMatrixReadProxy<T,T,MC,MR> BProx( BPre, ctrlB );
+        CannonImpl
+        ( orientA, orientB, alpha, AProx.GetLocked(), BProx.GetLocked(), C );
+    }
+    else
+    {
+        DistMatrixReadProxy<T,T,MR,MC> AProx( APre, ctrlA );
+        DistMatrixReadProxy<T,T,MR,MC> BProx( BPre, ctrlB );
+        CannonImpl
+        ( orientA, orientB, alpha, AProx.GetLocked(), BProx.GetLocked(), C );
+    }
+}
+
+} // namespace gemm
+} // namespace El
@@ -10,84 +10,6 @@
 namespace El {
 namespace gemm {
 
-// Cannon's algorithm
-template<typename T>
-void Cannon_NN
-( T alpha,
-  const AbstractDistMatrix<T>& APre,
-  const AbstractDistMatrix<T>& BPre,
-        AbstractDistMatrix<T>& CPre )
-{
-    DEBUG_CSE
-    const Grid& g = APre.Grid();
-    if( g.Height() != g.Width() )
-        LogicError("Process grid must be square for Cannon's");
-
-    // Force A, B, and C to be in [MC,MR] distributions aligned with C
-    DistMatrixReadWriteProxy<T,T,MC,MR> CProx( CPre );
-    auto& C = CProx.Get();
-
-    ElementalProxyCtrl ctrlA, ctrlB;
-    ctrlA.colConstrain = true; ctrlA.colAlign = C.ColAlign();
-    ctrlB.rowConstrain = true; ctrlB.rowAlign = C.RowAlign();
-    
-    DistMatrixReadProxy<T,T,MC,MR> AProx( APre, ctrlA );
-    DistMatrixReadProxy<T,T,MC,MR> BProx( BPre, ctrlB );
-    auto& A = AProx.GetLocked();
-    auto& B = BProx.GetLocked();
-
-    const Int row = g.Row();
-    const Int col = g.Col();
-    const Int pSqrt = g.Height();
-    mpi::Comm rowComm = g.RowComm();
-    mpi::Comm colComm = g.ColComm(); 
-    if( A.Width() % pSqrt != 0 )
-        LogicError("For now, width(A) must be integer multiple of sqrt(p)");
-
-    // Load the initial A and B packages (may want to transpose B...)
-    const Int localHeightA = A.LocalHeight();
-    const Int localHeightB = B.LocalHeight();
-    const Int localWidthA = A.LocalWidth();
-    const Int localWidthB = B.LocalWidth();
-    Matrix<T> pkgA(localHeightA,localWidthA,localHeightA), 
-              pkgB(localHeightB,localWidthB,localHeightB);
-    for( Int jLoc=0; jLoc<localWidthA; ++jLoc )
-        MemCopy
-        ( pkgA.Buffer(0,jLoc), A.LockedBuffer(0,jLoc), localHeightA );
-    for( Int jLoc=0; jLoc<localWidthB; ++jLoc )
-        MemCopy
-        ( pkgB.Buffer(0,jLoc), B.LockedBuffer(0,jLoc), localHeightB );
-
-    // Perform the initial circular shifts so that our A and B packages align
-    const Int rowShiftA = A.RowShift();
-    const Int colShiftB = B.ColShift();
-    const Int leftInitA  = Mod(col-colShiftB,pSqrt);
-    const Int rightInitA = Mod(col+colShiftB,pSqrt);
-    const Int aboveInitB = Mod(row-rowShiftA,pSqrt);
-    const Int belowInitB = Mod(row+rowShiftA,pSqrt);
-    const Int pkgSizeA = localHeightA*localWidthA;
-    const Int pkgSizeB = localHeightB*localWidthB;
-    mpi::SendRecv( pkgA.Buffer(), pkgSizeA, leftInitA, rightInitA, rowComm );
-    mpi::SendRecv( pkgB.Buffer(), pkgSizeB, aboveInitB, belowInitB, colComm );
-
-    // Now begin the data flow
-    const Int aboveRow = Mod(row-1,pSqrt);
-    const Int belowRow = Mod(row+1,pSqrt);
-    const Int leftCol  = Mod(col-1,pSqrt);
-    const Int rightCol = Mod(col+1,pSqrt);
-    for( Int q=0; q<pSqrt; ++q )
-    {
-        Gemm( NORMAL, NORMAL, alpha, pkgA, pkgB, T(1), C.Matrix() );
-        if( q != pSqrt-1 )
-        {
-            mpi::SendRecv
-            ( pkgA.Buffer(), pkgSizeA, leftCol, rightCol, rowComm );
-            mpi::SendRecv
-            ( pkgB.Buffer(), pkgSizeB, aboveRow, belowRow, colComm );
-        }
-    }
-}
-
 // Normal Normal Gemm that avoids communicating the matrix A
 template<typename T>
 void SUMMA_NNA
@@ -97,6 +19,7 @@ void SUMMA_NNA
         AbstractDistMatrix<T>& CPre )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("SUMMA_NNA")
     const Int n = CPre.Width();
     const Int bsize = Blocksize();
     const Grid& g = APre.Grid();
@@ -109,9 +32,9 @@ void SUMMA_NNA
     auto& C = CProx.Get();
 
     // Temporary distributions
-    DistMatrix<T,VR,STAR> B1_VR_STAR(g);
-    DistMatrix<T,STAR,MR> B1Trans_STAR_MR(g);
-    DistMatrix<T,MC,STAR> D1_MC_STAR(g);
+    WorkspaceDistMatrix<T,VR,STAR> B1_VR_STAR(g);
+    WorkspaceDistMatrix<T,STAR,MR> B1Trans_STAR_MR(g);
+    WorkspaceDistMatrix<T,MC,STAR> D1_MC_STAR(g);
 
     B1_VR_STAR.AlignWith( A );
     B1Trans_STAR_MR.AlignWith( A );
@@ -142,6 +65,7 @@ void SUMMA_NNB
         AbstractDistMatrix<T>& CPre )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("SUMMA_NNB")
     const Int m = CPre.Height();
     const Int bsize = Blocksize();
     const Grid& g = APre.Grid();
@@ -154,8 +78,8 @@ void SUMMA_NNB
     auto& C = CProx.Get();
 
     // Temporary distributions
-    DistMatrix<T,STAR,MC> A1_STAR_MC(g);
-    DistMatrix<T,MR,STAR> D1Trans_MR_STAR(g);
+    WorkspaceDistMatrix<T,STAR,MC> A1_STAR_MC(g);
+    WorkspaceDistMatrix<T,MR,STAR> D1Trans_MR_STAR(g);
 
     A1_STAR_MC.AlignWith( B );
     D1Trans_MR_STAR.AlignWith( B );
@@ -184,6 +108,7 @@ void SUMMA_NNC
         AbstractDistMatrix<T>& CPre )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("SUMMA_NNC")
     const Int sumDim = APre.Width();
     const Int bsize = Blocksize();
     const Grid& g = APre.Grid();
@@ -196,8 +121,8 @@ void SUMMA_NNC
     auto& C = CProx.Get();
 
     // Temporary distributions
-    DistMatrix<T,MC,STAR> A1_MC_STAR(g);
-    DistMatrix<T,MR,STAR> B1Trans_MR_STAR(g); 
+    WorkspaceDistMatrix<T,MC,STAR> A1_MC_STAR(g);
+    WorkspaceDistMatrix<T,MR,STAR> B1Trans_MR_STAR(g); 
 
     A1_MC_STAR.AlignWith( C );
     B1Trans_MR_STAR.AlignWith( C );
@@ -231,6 +156,7 @@ void SUMMA_NNDot
   Int blockSize=2000 )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("SUMMA_NNDot")
     const Int m = CPre.Height();
     const Int n = CPre.Width();
     const Grid& g = APre.Grid();
@@ -247,7 +173,7 @@ void SUMMA_NNDot
     DistMatrixReadWriteProxy<T,T,MC,MR> CProx( CPre );
     auto& C = CProx.Get();
 
-    DistMatrix<T,STAR,STAR> C11_STAR_STAR(g);
+    WorkspaceDistMatrix<T,STAR,STAR> C11_STAR_STAR(g);
     for( Int kOuter=0; kOuter<m; kOuter+=blockSize )
     {
         const Int nbOuter = Min(blockSize,m-kOuter);
@@ -315,6 +241,9 @@ void SUMMA_NN
     case GEMM_SUMMA_B:   SUMMA_NNB( alpha, A, B, C ); break;
     case GEMM_SUMMA_C:   SUMMA_NNC( alpha, A, B, C ); break;
     case GEMM_SUMMA_DOT: SUMMA_NNDot( alpha, A, B, C, blockSizeDot ); break;
+    case GEMM_SUMMA_C_PIPELINED:
+        SUMMA_Pipelined( NORMAL, NORMAL, alpha, A, B, C );
+        break;
     default: LogicError("Unsupported Gemm option");
     }
 }
@@ -20,6 +20,7 @@ void SUMMA_NTA
         AbstractDistMatrix<T>& CPre )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("SUMMA_NTA")
     const Int n = CPre.Width();
     const Int bsize = Blocksize();
     const Grid& g = APre.Grid();
@@ -33,8 +34,8 @@ void SUMMA_NTA
     auto& C = CProx.Get();
 
     // Temporary distributions
-    DistMatrix<T,MR,STAR> B1Trans_MR_STAR(g);
-    DistMatrix<T,MC,STAR> D1_MC_STAR(g);
+    WorkspaceDistMatrix<T,MR,STAR> B1Trans_MR_STAR(g);
+    WorkspaceDistMatrix<T,MC,STAR> D1_MC_STAR(g);
 
     B1Trans_MR_STAR.AlignWith( A );
     D1_MC_STAR.AlignWith( A );
@@ -64,6 +65,7 @@ void SUMMA_NTB
         AbstractDistMatrix<T>& CPre )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("SUMMA_NTB")
     const Int m = CPre.Height();
     const Int bsize = Blocksize();
     const Grid& g = APre.Grid();
@@ -76,9 +78,9 @@ void SUMMA_NTB
     auto& C = CProx.Get();
 
     // Temporary distributions
-    DistMatrix<T,MR,STAR> A1Trans_MR_STAR(g);
-    DistMatrix<T,STAR,MC> D1_STAR_MC(g);
-    DistMatrix<T,MR,MC> D1_MR_MC(g);
+    WorkspaceDistMatrix<T,MR,STAR> A1Trans_MR_STAR(g);
+    WorkspaceDistMatrix<T,STAR,MC> D1_STAR_MC(g);
+    WorkspaceDistMatrix<T,MR,MC> D1_MR_MC(g);
 
     A1Trans_MR_STAR.AlignWith( B );
     D1_STAR_MC.AlignWith( B );
@@ -110,6 +112,7 @@ void SUMMA_NTC
         AbstractDistMatrix<T>& CPre )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("SUMMA_NTC")
     const Int sumDim = APre.Width();
     const Int bsize = Blocksize();
     const Grid& g = APre.Grid();
@@ -123,9 +126,9 @@ void SUMMA_NTC
     auto& C = CProx.Get();
 
     // Temporary distributions
-    DistMatrix<T,MC,STAR> A1_MC_STAR(g);
-    DistMatrix<T,VR,STAR> B1_VR_STAR(g);
-    DistMatrix<T,STAR,MR> B1Trans_STAR_MR(g);
+    WorkspaceDistMatrix<T,MC,STAR> A1_MC_STAR(g);
+    WorkspaceDistMatrix<T,VR,STAR> B1_VR_STAR(g);
+    WorkspaceDistMatrix<T,STAR,MR> B1Trans_STAR_MR(g);
 
     A1_MC_STAR.AlignWith( C );
     B1_VR_STAR.AlignWith( C );
@@ -162,6 +165,7 @@ void SUMMA_NTDot
   Int blockSize=2000 )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("SUMMA_NTDot")
     const Int m = CPre.Height();
     const Int n = CPre.Width();
     const Grid& g = APre.Grid();
@@ -178,7 +182,7 @@ void SUMMA_NTDot
     DistMatrixReadWriteProxy<T,T,MC,MR> CProx( CPre );
     auto& C = CProx.Get();
 
-    DistMatrix<T,STAR,STAR> C11_STAR_STAR(g);
+    WorkspaceDistMatrix<T,STAR,STAR> C11_STAR_STAR(g);
     for( Int kOuter=0; kOuter<m; kOuter+=blockSize )
     {
         const Int nbOuter = Min(blockSize,m-kOuter);
@@ -249,6 +253,9 @@ void SUMMA_NT
     case GEMM_SUMMA_B: SUMMA_NTB( orientB, alpha, A, B, C ); break;
     case GEMM_SUMMA_C: SUMMA_NTC( orientB, alpha, A, B, C ); break;
     case GEMM_SUMMA_DOT: SUMMA_NTDot( orientB, alpha, A, B, C ); break;
+    case GEMM_SUMMA_C_PIPELINED:
+        SUMMA_Pipelined( NORMAL, orientB, alpha, A, B, C );
+        break;
     default: LogicError("Unsupported Gemm option");
     }
 }
@@ -0,0 +1,200 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace El {
+namespace gemm {
+
+// The Ozaki scheme applies to the real types whose precision exceeds that
+// of double (i.e., DoubleDouble, QuadDouble, Quad, and BigFloat)
+template<typename T>
+struct OzakiApplies
+{
+    static const bool value =
+      IsField<T>::value && !IsComplex<T>::value && !IsBlasScalar<T>::value;
+};
+
+// Split op(X) into 'numSlices' double-precision matrices such that
+//
+//   op(X)(i,j) ~= 2^exponent sum_p 2^(-(p+1) sliceBits) slices[p](i,j),
+//
+// where 'exponent' is shared by each row (if 'scaleRows') or each column of
+// op(X) and is chosen so that the entries of the row/column are less than
+// 2^exponent in magnitude. Each slice entry is then an integer of magnitude
+// at most 2^sliceBits. False is returned if an exponent is outside of the range
+// of double precision.
+template<typename Real>
+bool OzakiSplit
+( Orientation orient, const Matrix<Real>& X, bool scaleRows,
+  Int sliceBits, Int numSlices,
+  vector<Matrix<double>>& slices, vector<int>& exponents )
+{
+    DEBUG_CSE
+    const bool normal = ( orient == NORMAL );
+    const Int height = ( normal ? X.Height() : X.Width() );
+    const Int width = ( normal ? X.Width() : X.Height() );
+    const Real* XBuf = X.LockedBuffer();
+    const Int XLDim = X.LDim();
+    auto entry = [&]( Int i, Int j ) -> const Real&
+      { return normal ? XBuf[i+j*XLDim] : XBuf[j+i*XLDim]; };
+
+    const Int numScales = ( scaleRows ? height : width );
+    vector<Real> maxAbs( numScales, Real(0) );
+    for( Int j=0; j<width; ++j )
+    {
+        for( Int i=0; i<height; ++i )
+        {
+            Real& maxAbsScale = maxAbs[scaleRows ? i : j];
+            maxAbsScale = Max( maxAbsScale, Abs(entry(i,j)) );
+        }
+    }
+    exponents.resize( numScales );
+    vector<Real> invScales( numScales );
+    for( Int s=0; s<numScales; ++s )
+    {
+        exponents[s] = 0;
+        if( maxAbs[s] != Real(0) )
+        {
+            const double maxAbsDouble = double(maxAbs[s]);
+            if( maxAbsDouble == 0. || !std::isfinite(maxAbsDouble) )
+                return false;
+            std::frexp( maxAbsDouble, &exponents[s] );
+        }
+        invScales[s] = std::ldexp( 1., -exponents[s] );
+    }
+
+    const Real twoToSliceBits = std::ldexp( 1., sliceBits );
+    slices.resize( numSlices );
+    for( Int p=0; p<numSlices; ++p )
+        slices[p].Resize( height, width );
+    Real remainder, rounded;
+    for( Int j=0; j<width; ++j )
+    {
+        for( Int i=0; i<height; ++i )
+        {
+            // Peel off sliceBits bits at a time from the scaled entry, which lies
+            // in (-1,1); each step is exact
+            remainder = entry(i,j);
+            remainder *= invScales[scaleRows ? i : j];
+            for( Int p=0; p<numSlices; ++p )
+            {
+                remainder *= twoToSliceBits;
+                rounded = Round( remainder );
+                slices[p].Buffer()[i+j*slices[p].LDim()] = double(rounded);
+                remainder -= rounded;
+            }
+        }
+    }
+    return true;
+}
+
+// C := alpha op(A) op(B) + beta C via the Ozaki scheme: op(A) and op(B) are
+// split into double-precision slices whose pairwise products are formed
+// exactly by the native dgemm (the entries of the slices are integers which
+// are small enough that no rounding occurs) and then accumulated in the
+// extended precision. Products of slices whose contributions would lie
+// below the working precision are skipped.
+//
+// False is returned (without modifying C) if the scheme does not apply.
+template<typename Real,typename=EnableIf<OzakiApplies<Real>>>
+bool Ozaki
+( Orientation orientA, Orientation orientB,
+  const Real& alpha, const Matrix<Real>& A, const Matrix<Real>& B,
+  const Real& beta,        Matrix<Real>& C )
+{
+    DEBUG_CSE
+    const Int m = C.Height();
+    const Int n = C.Width();
+    const Int k = ( orientA == NORMAL ? A.Width() : A.Height() );
+    if( k == 0 )
+        return false;
+
+    // The k-term inner products of slices with entries bounded by
+    // 2^sliceBits are exact in double precision if
+    // 2 sliceBits + log2(k) <= 53
+    const Int logK = Int(std::ceil(std::log2(double(k))));
+    const Int sliceBits = (53-logK) / 2;
+    if( sliceBits < 1 )
+        return false;
+    const Int precision =
+      Int(std::ceil(double(-Log2(limits::Epsilon<Real>()))));
+    const Int numSlices = (precision+sliceBits-1)/sliceBits + 1;
+
+    vector<Matrix<double>> ASlices, BSlices;
+    vector<int> AExponents, BExponents;
+    if( !OzakiSplit
+         ( orientA, A, true, sliceBits, numSlices, ASlices, AExponents ) ||
+        !OzakiSplit
+         ( orientB, B, false, sliceBits, numSlices, BSlices, BExponents ) )
+        return false;
+
+    C *= beta;
+    if( alpha == Real(0) )
+        return true;
+
+    vector<Real> colScales( n ), rowScales( m );
+    for( Int j=0; j<n; ++j )
+        colScales[j] = std::ldexp( 1., BExponents[j] );
+
+    // The product of the p'th slice of op(A) and the q'th slice of op(B) is
+    // scaled by 2^(-(p+q+2) sliceBits), so only the slices with p+q < numSlices
+    // contribute at the working precision
+    Matrix<double> D( m, n );
+    const Real twoToMinusSliceBits = std::ldexp( 1., -sliceBits );
+    Real diagScale = twoToMinusSliceBits;
+    Real gamma;
+    for( Int d=0; d<numSlices; ++d )
+    {
+        diagScale *= twoToMinusSliceBits;
+        for( Int i=0; i<m; ++i )
+        {
+            rowScales[i] = std::ldexp( 1., AExponents[i] );
+            rowScales[i] *= diagScale;
+            rowScales[i] *= alpha;
+        }
+        for( Int p=0; p<=d; ++p )
+        {
+            const Matrix<double>& AS = ASlices[p];
+            const Matrix<double>& BS = BSlices[d-p];
+            blas::Gemm
+            ( 'N', 'N', m, n, k,
+              1., AS.LockedBuffer(), AS.LDim(),
+                  BS.LockedBuffer(), BS.LDim(),
+              0., D.Buffer(),        D.LDim() );
+            const double* DBuf = D.LockedBuffer();
+            Real* CBuf = C.Buffer();
+            const Int DLDim = D.LDim();
+            const Int CLDim = C.LDim();
+            for( Int j=0; j<n; ++j )
+            {
+                for( Int i=0; i<m; ++i )
+                {
+                    const double delta = DBuf[i+j*DLDim];
+                    if( delta != 0. )
+                    {
+                        gamma = delta;
+                        gamma *= colScales[j];
+                        gamma *= rowScales[i];
+                        CBuf[i+j*CLDim] += gamma;
+                    }
+                }
+            }
+        }
+    }
+    return true;
+}
+
+template<typename T,typename=DisableIf<OzakiApplies<T>>,typename=void>
+bool Ozaki
+( Orientation orientA, Orientation orientB,
+  const T& alpha, const Matrix<T>& A, const Matrix<T>& B,
+  const T& beta,        Matrix<T>& C )
+{ return false; }
+
+} // namespace gemm
+} // namespace El
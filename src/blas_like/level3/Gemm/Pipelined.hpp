@@ -0,0 +1,278 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace El {
+namespace gemm {
+
+// Begin broadcasting a panel. Types which are not packed are broadcast
+// immediately since their (serialized) nonblocking broadcasts are not
+// overlapped with anything useful.
+template<typename T,typename=EnableIf<IsPacked<T>>>
+void StartPanelBroadcast
+( T* buf, Int size, int root, mpi::Comm comm, mpi::Request<T>& request,
+  bool& pending )
+{
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    mpi::IBroadcast( buf, size, root, comm, request );
+    pending = true;
+#else
+    mpi::Broadcast( buf, size, root, comm );
+    pending = false;
+#endif
+}
+
+template<typename T,typename=DisableIf<IsPacked<T>>,typename=void>
+void StartPanelBroadcast
+( T* buf, Int size, int root, mpi::Comm comm, mpi::Request<T>& request,
+  bool& pending )
+{
+    mpi::Broadcast( buf, size, root, comm );
+    pending = false;
+}
+
+template<typename T>
+void FinishPanelBroadcast( mpi::Request<T>& request, bool& pending )
+{
+    if( pending )
+    {
+        mpi::Wait( request );
+        pending = false;
+    }
+}
+
+// The summation indices of a pipelined SUMMA panel. The summation dimension
+// is split into superblocks of lcm(r,c) panels, where the t'th panel of a
+// superblock holds the indices congruent to t modulo lcm(r,c), so that its
+// columns of op(A) are owned by a single process column and its rows of
+// op(B) are owned by a single process row.
+struct PipelinedPanel
+{
+    Int first, stride, size;
+};
+
+inline vector<PipelinedPanel>
+PipelinedPanels( Int sumDim, Int bsize, Int lcm )
+{
+    vector<PipelinedPanel> panels;
+    const Int superblockSize = bsize*lcm;
+    for( Int base=0; base<sumDim; base+=superblockSize )
+    {
+        const Int end = Min( base+superblockSize, sumDim );
+        for( Int t=0; t<lcm && base+t<end; ++t )
+        {
+            PipelinedPanel panel;
+            panel.first = base+t;
+            panel.stride = lcm;
+            panel.size = (end-panel.first+lcm-1) / lcm;
+            panels.push_back( panel );
+        }
+    }
+    return panels;
+}
+
+// C[MC,MR] += alpha op(A) op(B), where A is [MC,MR] (or [MR,MC] if it is
+// to be (conjugate-)transposed) with its op(A) rows aligned with C, and
+// similarly for B.
+//
+// Each panel of op(A) is broadcast within process rows from the process
+// column which owns it (and each panel of op(B) within process columns) so
+// that every process receives its [MC,* ] portion of the op(A) panel and
+// its [* ,MR] portion of the op(B) panel. The panels are double-buffered so
+// that the broadcasts of the next panels are in flight while the local
+// update with the current panels is computed.
+template<typename T,Dist UA,Dist VA,Dist UB,Dist VB>
+void SUMMA_PipelinedImpl
+( Orientation orientA, Orientation orientB,
+  T alpha,
+  const DistMatrix<T,UA,VA>& A,
+  const DistMatrix<T,UB,VB>& B,
+        DistMatrix<T,MC,MR>& C )
+{
+    DEBUG_CSE
+    const Grid& g = C.Grid();
+    const bool normalA = ( orientA == NORMAL );
+    const bool normalB = ( orientB == NORMAL );
+    const bool conjA = ( orientA == ADJOINT );
+    const bool conjB = ( orientB == ADJOINT );
+    const Int sumDim = ( normalA ? A.Width() : A.Height() );
+    const Int localHeight = C.LocalHeight();
+    const Int localWidth = C.LocalWidth();
+    mpi::Comm commA = ( normalA ? A.RowComm() : A.ColComm() );
+    mpi::Comm commB = ( normalB ? B.ColComm() : B.RowComm() );
+    const int rankA = mpi::Rank( commA );
+    const int rankB = mpi::Rank( commB );
+
+    const vector<PipelinedPanel> panels =
+      PipelinedPanels( sumDim, Blocksize(), g.LCM() );
+    const Int numPanels = panels.size();
+
+    Matrix<T> APanel[2], BPanel[2];
+    mpi::Request<T> requestA[2], requestB[2];
+    bool pendingA[2]={false,false}, pendingB[2]={false,false};
+
+    const T* ABuf = A.LockedBuffer();
+    const T* BBuf = B.LockedBuffer();
+    const Int ALDim = A.LDim();
+    const Int BLDim = B.LDim();
+    auto startPanel = [&]( Int q )
+    {
+        const PipelinedPanel& panel = panels[q];
+        const Int buffer = q % 2;
+        Matrix<T>& AP = APanel[buffer];
+        Matrix<T>& BP = BPanel[buffer];
+        AP.Resize( localHeight, panel.size, Max(localHeight,1) );
+        BP.Resize( panel.size, localWidth, Max(panel.size,Int(1)) );
+
+        // Pack the panel of op(A) if we own it
+        const int rootA =
+          ( normalA ? A.ColOwner(panel.first) : A.RowOwner(panel.first) );
+        if( rankA == rootA )
+        {
+            T* APBuf = AP.Buffer();
+            for( Int s=0; s<panel.size; ++s )
+            {
+                const Int j = panel.first + s*panel.stride;
+                if( normalA )
+                {
+                    MemCopy
+                    ( &APBuf[s*localHeight], &ABuf[A.LocalCol(j)*ALDim],
+                      localHeight );
+                }
+                else
+                {
+                    const Int jLoc = A.LocalRow(j);
+                    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                        APBuf[iLoc+s*localHeight] =
+                          ( conjA ? Conj(ABuf[jLoc+iLoc*ALDim])
+                                  : ABuf[jLoc+iLoc*ALDim] );
+                }
+            }
+        }
+
+        // Pack the panel of op(B) if we own it
+        const int rootB =
+          ( normalB ? B.RowOwner(panel.first) : B.ColOwner(panel.first) );
+        if( rankB == rootB )
+        {
+            T* BPBuf = BP.Buffer();
+            for( Int s=0; s<panel.size; ++s )
+            {
+                const Int j = panel.first + s*panel.stride;
+                if( normalB )
+                {
+                    const Int jLoc = B.LocalRow(j);
+                    for( Int kLoc=0; kLoc<localWidth; ++kLoc )
+                        BPBuf[s+kLoc*panel.size] = BBuf[jLoc+kLoc*BLDim];
+                }
+                else
+                {
+                    const Int jLoc = B.LocalCol(j);
+                    for( Int kLoc=0; kLoc<localWidth; ++kLoc )
+                        BPBuf[s+kLoc*panel.size] =
+                          ( conjB ? Conj(BBuf[kLoc+jLoc*BLDim])
+                                  : BBuf[kLoc+jLoc*BLDim] );
+                }
+            }
+        }
+
+        StartPanelBroadcast
+        ( AP.Buffer(), localHeight*panel.size, rootA, commA,
+          requestA[buffer], pendingA[buffer] );
+        StartPanelBroadcast
+        ( BP.Buffer(), panel.size*localWidth, rootB, commB,
+          requestB[buffer], pendingB[buffer] );
+    };
+
+    if( numPanels > 0 )
+        startPanel( 0 );
+    for( Int q=0; q<numPanels; ++q )
+    {
+        const Int buffer = q % 2;
+        FinishPanelBroadcast( requestA[buffer], pendingA[buffer] );
+        FinishPanelBroadcast( requestB[buffer], pendingB[buffer] );
+        if( q+1 < numPanels )
+            startPanel( q+1 );
+
+        // C[MC,MR] += alpha op(A)1[MC,* ] op(B)1[* ,MR]
+        Gemm
+        ( NORMAL, NORMAL,
+          alpha, APanel[buffer], BPanel[buffer], T(1), C.Matrix() );
+    }
+}
+
+// Stationary C Gemm which overlaps the panel broadcasts with the local
+// updates
+template<typename T>
+void SUMMA_Pipelined
+( Orientation orientA, Orientation orientB,
+  T alpha,
+  const AbstractDistMatrix<T>& APre,
+  const AbstractDistMatrix<T>& BPre,
+        AbstractDistMatrix<T>& CPre )
+{
+    DEBUG_CSE
+    EL_PROFILE_REGION("SUMMA_Pipelined")
+    DistMatrixReadWriteProxy<T,T,MC,MR> CProx( CPre );
+    auto& C = CProx.Get();
+
+    // Align the rows of op(A) and the columns of op(B) with C
+    ElementalProxyCtrl ctrlA, ctrlB;
+    if( orientA == NORMAL )
+    {
+        ctrlA.colConstrain = true;
+        ctrlA.colAlign = C.ColAlign();
+    }
+    else
+    {
+        ctrlA.rowConstrain = true;
+        ctrlA.rowAlign = C.ColAlign();
+    }
+    if( orientB == NORMAL )
+    {
+        ctrlB.rowConstrain = true;
+        ctrlB.rowAlign = C.RowAlign();
+    }
+    else
+    {
+        ctrlB.colConstrain = true;
+        ctrlB.colAlign = C.RowAlign();
+    }
+
+    if( orientA == NORMAL && orientB == NORMAL )
+    {
+        DistMatrixReadProxy<T,T,MC,MR> AProx( APre, ctrlA );
+        DistMatrixReadProxy<T,T,MC,MR> BProx( BPre, ctrlB );
+        SUMMA_PipelinedImpl
+        ( orientA, orientB, alpha, AProx.GetLocked(), BProx.GetLocked(), C );
+    }
+    else if( orientA == NORMAL )
+    {
+        DistMatrixReadProxy<T,T,MC,MR> AProx( APre, ctrlA );
+        DistMatrixReadProxy<T,T,MR,MC> BProx( BPre, ctrlB );
+        SUMMA_PipelinedImpl
+        ( orientA, orientB, alpha, AProx.GetLocked(), BProx.GetLocked(), C );
+    }
+    else if( orientB == NORMAL )
+    {
+        DistMatrixReadProxy<T,T,MR,MC> AProx( APre, ctrlA );
+        DistMatrixReadProxy<T,T,MC,MR> BProx( BPre, ctrlB );
+        SUMMA_PipelinedImpl
+        ( orientA, orientB, alpha, AProx.GetLocked(), BProx.GetLocked(), C );
+    }
+    else
+    {
+        DistMatrixReadProxy<T,T,MR,MC> AProx( APre, ctrlA );
+        DistMatrixReadProxy<T,T,MR,MC> BProx( BPre, ctrlB );
+        SUMMA_PipelinedImpl
+        ( orientA, orientB, alpha, AProx.GetLocked(), BProx.GetLocked(), C );
+    }
+}
+
+} // namespace gemm
+} // namespace El
@@ -20,6 +20,7 @@ void SUMMA_TNA
         AbstractDistMatrix<T>& CPre )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("SUMMA_TNA")
     const Int n = CPre.Width();
     const Int bsize = Blocksize();
     const Grid& g = APre.Grid();
@@ -32,9 +33,9 @@ void SUMMA_TNA
     auto& C = CProx.Get();
 
     // Temporary distributions
-    DistMatrix<T,MC,STAR> B1_MC_STAR(g);
-    DistMatrix<T,MR,STAR> D1_MR_STAR(g);
-    DistMatrix<T,MR,MC  > D1_MR_MC(g);
+    WorkspaceDistMatrix<T,MC,STAR> B1_MC_STAR(g);
+    WorkspaceDistMatrix<T,MR,STAR> D1_MR_STAR(g);
+    WorkspaceDistMatrix<T,MR,MC  > D1_MR_MC(g);
 
     B1_MC_STAR.AlignWith( A );
     D1_MR_STAR.AlignWith( A );
@@ -66,6 +67,7 @@ void SUMMA_TNB
         AbstractDistMatrix<T>& CPre )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("SUMMA_TNB")
     const Int m = CPre.Height();
     const Int bsize = Blocksize();
     const Grid& g = APre.Grid();
@@ -79,8 +81,8 @@ void SUMMA_TNB
     auto& C = CProx.Get();
 
     // Temporary distributions
-    DistMatrix<T,MC,STAR> A1_MC_STAR(g);
-    DistMatrix<T,MR,STAR> D1Trans_MR_STAR(g);
+    WorkspaceDistMatrix<T,MC,STAR> A1_MC_STAR(g);
+    WorkspaceDistMatrix<T,MR,STAR> D1Trans_MR_STAR(g);
 
     A1_MC_STAR.AlignWith( B );
     D1Trans_MR_STAR.AlignWith( B );
@@ -109,6 +111,7 @@ void SUMMA_TNC
         AbstractDistMatrix<T>& CPre )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("SUMMA_TNC")
     const Int sumDim = BPre.Height();
     const Int bsize = Blocksize();
     const Grid& g = APre.Grid();
@@ -121,8 +124,8 @@ void SUMMA_TNC
     auto& C = CProx.Get();
 
     // Temporary distributions
-    DistMatrix<T,STAR,MC> A1_STAR_MC(g);
-    DistMatrix<T,MR,STAR> B1Trans_MR_STAR(g);
+    WorkspaceDistMatrix<T,STAR,MC> A1_STAR_MC(g);
+    WorkspaceDistMatrix<T,MR,STAR> B1Trans_MR_STAR(g);
 
     A1_STAR_MC.AlignWith( C );
     B1Trans_MR_STAR.AlignWith( C );
@@ -157,6 +160,7 @@ void SUMMA_TNDot
   Int blockSize=2000 )
 {
     DEBUG_CSE 
+    EL_PROFILE_REGION("SUMMA_TNDot")
     const Int m = CPre.Height();
     const Int n = CPre.Width();
     const Grid& g = APre.Grid();
@@ -173,7 +177,7 @@ void SUMMA_TNDot
     DistMatrixReadWriteProxy<T,T,MC,MR> CProx( CPre );
     auto& C = CProx.Get();
 
-    DistMatrix<T,STAR,STAR> C11_STAR_STAR(g);
+    WorkspaceDistMatrix<T,STAR,STAR> C11_STAR_STAR(g);
     for( Int kOuter=0; kOuter<m; kOuter+=blockSize )
     {
         const Int nbOuter = Min(blockSize,m-kOuter);
@@ -244,6 +248,9 @@ void SUMMA_TN
     case GEMM_SUMMA_B: SUMMA_TNB( orientA, alpha, A, B, C ); break;
     case GEMM_SUMMA_C: SUMMA_TNC( orientA, alpha, A, B, C ); break;
     case GEMM_SUMMA_DOT: SUMMA_TNDot( orientA, alpha, A, B, C ); break;
+    case GEMM_SUMMA_C_PIPELINED:
+        SUMMA_Pipelined( orientA, NORMAL, alpha, A, B, C );
+        break;
     default: LogicError("Unsupported Gemm option");
     }
 }
@@ -21,6 +21,7 @@ void SUMMA_TTA
         AbstractDistMatrix<T>& CPre )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("SUMMA_TTA")
     const Int n = CPre.Width();
     const Int bsize = Blocksize();
     const Grid& g = APre.Grid();
@@ -33,9 +34,9 @@ void SUMMA_TTA
     auto& C = CProx.Get();
 
     // Temporary distributions
-    DistMatrix<T,STAR,MC  > B1_STAR_MC(g);
-    DistMatrix<T,MR,  MC  > D1_MR_MC(g);
-    DistMatrix<T,MR,  STAR> D1_MR_STAR(g);
+    WorkspaceDistMatrix<T,STAR,MC  > B1_STAR_MC(g);
+    WorkspaceDistMatrix<T,MR,  MC  > D1_MR_MC(g);
+    WorkspaceDistMatrix<T,MR,  STAR> D1_MR_STAR(g);
 
     B1_STAR_MC.AlignWith( A ); 
     D1_MR_STAR.AlignWith( A );  
@@ -69,6 +70,7 @@ void SUMMA_TTB
         AbstractDistMatrix<T>& CPre )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("SUMMA_TTB")
     const Int m = CPre.Height();
     const Int bsize = Blocksize();
     const Grid& g = APre.Grid();
@@ -82,10 +84,10 @@ void SUMMA_TTB
     auto& C = CProx.Get();
 
     // Temporary distributions
-    DistMatrix<T,VR,  STAR> A1_VR_STAR(g);
-    DistMatrix<T,STAR,MR  > A1Trans_STAR_MR(g);
-    DistMatrix<T,STAR,MC  > D1_STAR_MC(g);
-    DistMatrix<T,MR,  MC  > D1_MR_MC(g);
+    WorkspaceDistMatrix<T,VR,  STAR> A1_VR_STAR(g);
+    WorkspaceDistMatrix<T,STAR,MR  > A1Trans_STAR_MR(g);
+    WorkspaceDistMatrix<T,STAR,MC  > D1_STAR_MC(g);
+    WorkspaceDistMatrix<T,MR,  MC  > D1_MR_MC(g);
 
     A1_VR_STAR.AlignWith( B );
     A1Trans_STAR_MR.AlignWith( B );
@@ -120,6 +122,7 @@ void SUMMA_TTC
         AbstractDistMatrix<T>& CPre )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("SUMMA_TTC")
     const Int sumDim = APre.Height();
     const Int bsize = Blocksize();
     const Grid& g = APre.Grid();
@@ -133,9 +136,9 @@ void SUMMA_TTC
     auto& C = CProx.Get();
 
     // Temporary distributions
-    DistMatrix<T,STAR,MC  > A1_STAR_MC(g);
-    DistMatrix<T,VR,  STAR> B1_VR_STAR(g);
-    DistMatrix<T,STAR,MR  > B1Trans_STAR_MR(g);
+    WorkspaceDistMatrix<T,STAR,MC  > A1_STAR_MC(g);
+    WorkspaceDistMatrix<T,VR,  STAR> B1_VR_STAR(g);
+    WorkspaceDistMatrix<T,STAR,MR  > B1Trans_STAR_MR(g);
 
     A1_STAR_MC.AlignWith( C );
     B1_VR_STAR.AlignWith( C );
@@ -174,6 +177,7 @@ void SUMMA_TTDot
   Int blockSize=2000 )
 {
     DEBUG_CSE 
+    EL_PROFILE_REGION("SUMMA_TTDot")
     const Int m = CPre.Height();
     const Int n = CPre.Width();
     const Grid& g = APre.Grid();
@@ -190,7 +194,7 @@ void SUMMA_TTDot
     DistMatrixReadWriteProxy<T,T,MC,MR> CProx( CPre );
     auto& C = CProx.Get();
 
-    DistMatrix<T,STAR,STAR> C11_STAR_STAR(g);
+    WorkspaceDistMatrix<T,STAR,STAR> C11_STAR_STAR(g);
     for( Int kOuter=0; kOuter<m; kOuter+=blockSize )
     {
         const Int nbOuter = Min(blockSize,m-kOuter);
@@ -269,6 +273,9 @@ void SUMMA_TT
     case GEMM_SUMMA_DOT:
         SUMMA_TTDot( orientA, orientB, alpha, A, B, C );
         break;
+    case GEMM_SUMMA_C_PIPELINED:
+        SUMMA_Pipelined( orientA, orientB, alpha, A, B, C );
+        break;
     default: LogicError("Unsupported Gemm option");
     }
 }
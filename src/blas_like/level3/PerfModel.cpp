@@ -0,0 +1,469 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <El/blas_like/level3.hpp>
+
+namespace {
+using namespace El;
+
+bool havePerfModel = false;
+PerfModel perfModel;
+
+// Measure the latency and inverse bandwidth of the messages between the
+// first two processes of 'comm' via ping-pongs
+void CalibrateMessages
+( mpi::Comm comm, double& latency, double& invBandwidth )
+{
+    DEBUG_CSE
+    latency = invBandwidth = 0;
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+    if( commSize == 1 )
+        return;
+
+    const Int numReps = 20;
+    const Int largeSize = Int(1) << 17;
+    vector<double> buffer( largeSize, 0. );
+    auto pingPong = [&]( Int size )
+    {
+        mpi::Barrier( comm );
+        const double startTime = mpi::Time();
+        for( Int rep=0; rep<numReps; ++rep )
+        {
+            if( commRank == 0 )
+            {
+                mpi::Send( buffer.data(), size, 1, comm );
+                mpi::Recv( buffer.data(), size, 1, comm );
+            }
+            else if( commRank == 1 )
+            {
+                mpi::Recv( buffer.data(), size, 0, comm );
+                mpi::Send( buffer.data(), size, 0, comm );
+            }
+        }
+        return (mpi::Time()-startTime) / (2*numReps);
+    };
+    pingPong( 1 );
+    const double smallTime = pingPong( 1 );
+    const double largeTime = pingPong( largeSize );
+    if( commRank <= 1 )
+    {
+        latency = smallTime;
+        invBandwidth =
+          Max( largeTime-smallTime, 0. ) / (largeSize*sizeof(double));
+    }
+}
+
+Int CeilLog2( Int n )
+{
+    Int log2 = 0;
+    while( (Int(1) << log2) < n )
+        ++log2;
+    return log2;
+}
+
+// The cost of a collective over 'commSize' processes (assuming recursive
+// doubling or a ring) where each process ends up with (or starts with)
+// 'numBytes' bytes in total
+double AllGatherTime
+( Int commSize, double numBytes, double latency, double invBandwidth )
+{
+    if( commSize == 1 )
+        return 0;
+    return CeilLog2(commSize)*latency +
+      (double(commSize-1)/commSize)*numBytes*invBandwidth;
+}
+
+double ReduceScatterTime
+( Int commSize, double numBytes, double latency, double invBandwidth )
+{ return AllGatherTime( commSize, numBytes, latency, invBandwidth ); }
+
+double AllToAllTime
+( Int commSize, double numBytes, double latency, double invBandwidth )
+{
+    if( commSize == 1 )
+        return 0;
+    return (commSize-1)*latency +
+      (double(commSize-1)/commSize)*numBytes*invBandwidth;
+}
+
+// Messages over the entire grid are assumed to be as slow as the slower of
+// the column and row communicators
+double GridLatency( const PerfModel& model )
+{ return Max( model.colLatency, model.rowLatency ); }
+double GridInvBandwidth( const PerfModel& model )
+{ return Max( model.colInvBandwidth, model.rowInvBandwidth ); }
+
+// The cost of redistributing a height x width matrix into 'dist' over the
+// entire grid (if it is not already distributed as such)
+template<typename T>
+double ProxyTime
+( const AbstractDistMatrix<T>& A, Dist colDist, Dist rowDist,
+  const PerfModel& model )
+{
+    if( A.ColDist() == colDist && A.RowDist() == rowDist )
+        return 0;
+    const Int p = A.Grid().Size();
+    const double numBytes = double(A.Height())*A.Width()*sizeof(T) / p;
+    return AllToAllTime
+      ( p, numBytes, GridLatency(model), GridInvBandwidth(model) );
+}
+
+template<typename T>
+double FlopScale()
+{ return IsComplex<T>::value ? 4 : 1; }
+
+} // anonymous namespace
+
+namespace El {
+
+PerfModel CalibratePerfModel( const Grid& grid )
+{
+    DEBUG_CSE
+    PerfModel model;
+
+    // Time a moderately-sized local double-precision Gemm
+    const Int n = 256;
+    const Int numReps = 3;
+    vector<double> A( n*n, 1. ), B( n*n, 1. ), C( n*n, 0. );
+    blas::Gemm
+    ( 'N', 'N', n, n, n,
+      1., A.data(), n, B.data(), n, 0., C.data(), n );
+    const double startTime = mpi::Time();
+    for( Int rep=0; rep<numReps; ++rep )
+        blas::Gemm
+        ( 'N', 'N', n, n, n,
+          1., A.data(), n, B.data(), n, 0., C.data(), n );
+    const double gemmTime = (mpi::Time()-startTime) / numReps;
+    model.flopTime = gemmTime / (2.*n*n*n);
+
+    CalibrateMessages
+    ( grid.ColComm(), model.colLatency, model.colInvBandwidth );
+    CalibrateMessages
+    ( grid.RowComm(), model.rowLatency, model.rowInvBandwidth );
+
+    // Be pessimistic about the slowest process of the grid
+    double params[5] =
+      { model.flopTime,
+        model.colLatency, model.colInvBandwidth,
+        model.rowLatency, model.rowInvBandwidth };
+    mpi::AllReduce( params, 5, mpi::MAX, grid.Comm() );
+    model.flopTime = params[0];
+    model.colLatency = params[1];
+    model.colInvBandwidth = params[2];
+    model.rowLatency = params[3];
+    model.rowInvBandwidth = params[4];
+    return model;
+}
+
+void SetPerfModel( const PerfModel& model )
+{
+    ::perfModel = model;
+    ::havePerfModel = true;
+}
+
+void ClearPerfModel()
+{ ::havePerfModel = false; }
+
+bool HavePerfModel()
+{ return ::havePerfModel; }
+
+const PerfModel& GetPerfModel()
+{ return ::perfModel; }
+
+void WritePerfModel( const PerfModel& model, const string& filename )
+{
+    DEBUG_CSE
+    ofstream file( filename.c_str() );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    file.precision( 17 );
+    file << "flopTime " << model.flopTime << "\n"
+         << "colLatency " << model.colLatency << "\n"
+         << "colInvBandwidth " << model.colInvBandwidth << "\n"
+         << "rowLatency " << model.rowLatency << "\n"
+         << "rowInvBandwidth " << model.rowInvBandwidth << "\n";
+}
+
+PerfModel ReadPerfModel( const string& filename )
+{
+    DEBUG_CSE
+    ifstream file( filename.c_str() );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    PerfModel model;
+    string name;
+    double value;
+    while( file >> name >> value )
+    {
+        if( name == "flopTime" )
+            model.flopTime = value;
+        else if( name == "colLatency" )
+            model.colLatency = value;
+        else if( name == "colInvBandwidth" )
+            model.colInvBandwidth = value;
+        else if( name == "rowLatency" )
+            model.rowLatency = value;
+        else if( name == "rowInvBandwidth" )
+            model.rowInvBandwidth = value;
+        else
+            RuntimeError("Unknown performance model parameter ",name);
+    }
+    return model;
+}
+
+template<typename T>
+double ModeledGemmTime
+( GemmAlgorithm alg, Orientation orientA, Orientation orientB,
+  const AbstractDistMatrix<T>& A,
+  const AbstractDistMatrix<T>& B,
+  const AbstractDistMatrix<T>& C,
+  const PerfModel& model )
+{
+    DEBUG_CSE
+    const Grid& g = C.Grid();
+    const double r = g.Height();
+    const double c = g.Width();
+    const double p = g.Size();
+    const double m = C.Height();
+    const double n = C.Width();
+    const double k = ( orientA == NORMAL ? A.Width() : A.Height() );
+    const double w = sizeof(T);
+    const double nb = Blocksize();
+    const double alphaCol = model.colLatency;
+    const double betaCol = model.colInvBandwidth;
+    const double alphaRow = model.rowLatency;
+    const double betaRow = model.rowInvBandwidth;
+    const double flopTime =
+      FlopScale<T>()*model.flopTime*(2.*m*n*k/p);
+
+    double commTime = 0;
+    switch( alg )
+    {
+    case GEMM_SUMMA_A:
+    {
+        // Gather panels of B within process columns and reduce-scatter
+        // panels of C within process rows
+        const double numPanels = std::ceil( n/nb );
+        commTime = numPanels*
+          ( AllGatherTime( r, k*nb*w/c, alphaCol, betaCol ) +
+            ReduceScatterTime( c, m*nb*w/r, alphaRow, betaRow ) );
+        break;
+    }
+    case GEMM_SUMMA_B:
+    {
+        // Gather panels of A within process rows and reduce-scatter
+        // panels of C within process columns
+        const double numPanels = std::ceil( m/nb );
+        commTime = numPanels*
+          ( AllGatherTime( c, nb*k*w/r, alphaRow, betaRow ) +
+            ReduceScatterTime( r, nb*n*w/c, alphaCol, betaCol ) );
+        break;
+    }
+    case GEMM_SUMMA_C:
+    case GEMM_SUMMA_C_PIPELINED:
+    {
+        // Gather panels of A within process rows and panels of B within
+        // process columns
+        const double numPanels = std::ceil( k/nb );
+        commTime = numPanels*
+          ( AllGatherTime( c, m*nb*w/r, alphaRow, betaRow ) +
+            AllGatherTime( r, nb*n*w/c, alphaCol, betaCol ) );
+        break;
+    }
+    case GEMM_SUMMA_DOT:
+    {
+        // Redistribute block rows of A and block columns of B over the
+        // entire grid for each block of C and then sum each block of C
+        const double blockSize = 2000;
+        const double numBlockRows = std::ceil( m/blockSize );
+        const double numBlockCols = std::ceil( n/blockSize );
+        const double alphaGrid = GridLatency( model );
+        const double betaGrid = GridInvBandwidth( model );
+        commTime =
+          numBlockCols*AllToAllTime( p, m*k*w/p, alphaGrid, betaGrid ) +
+          numBlockRows*AllToAllTime( p, k*n*w/p, alphaGrid, betaGrid ) +
+          numBlockRows*numBlockCols*
+          ReduceScatterTime
+          ( p, Min(m,blockSize)*Min(n,blockSize)*w, alphaGrid, betaGrid );
+        break;
+    }
+    case GEMM_CANNON:
+    {
+        if( r != c )
+            return limits::Infinity<double>();
+        // The initial skew and q-1 shifts of the local blocks of A within
+        // process rows and of B within process columns
+        commTime = r*
+          ( alphaRow + m*k*w/p*betaRow + alphaCol + k*n*w/p*betaCol );
+        const Dist colDistA = ( orientA == NORMAL ? MC : MR );
+        const Dist rowDistA = ( orientA == NORMAL ? MR : MC );
+        const Dist colDistB = ( orientB == NORMAL ? MC : MR );
+        const Dist rowDistB = ( orientB == NORMAL ? MR : MC );
+        return flopTime + commTime +
+          ProxyTime( A, colDistA, rowDistA, model ) +
+          ProxyTime( B, colDistB, rowDistB, model ) +
+          ProxyTime( C, MC, MR, model );
+    }
+    default:
+        LogicError("Gemm algorithm ",Int(alg)," is not modeled");
+    }
+    return flopTime + commTime +
+      ProxyTime( A, MC, MR, model ) +
+      ProxyTime( B, MC, MR, model ) +
+      ProxyTime( C, MC, MR, model );
+}
+
+template<typename T>
+GemmAlgorithm ModeledGemmAlgorithm
+( Orientation orientA, Orientation orientB,
+  const AbstractDistMatrix<T>& A,
+  const AbstractDistMatrix<T>& B,
+  const AbstractDistMatrix<T>& C,
+  const PerfModel& model )
+{
+    DEBUG_CSE
+    const GemmAlgorithm algs[5] =
+      { GEMM_SUMMA_C, GEMM_SUMMA_A, GEMM_SUMMA_B, GEMM_SUMMA_DOT,
+        GEMM_CANNON };
+    GemmAlgorithm bestAlg = algs[0];
+    double bestTime = limits::Infinity<double>();
+    for( GemmAlgorithm alg : algs )
+    {
+        const double time =
+          ModeledGemmTime( alg, orientA, orientB, A, B, C, model );
+        if( time < bestTime )
+        {
+            bestTime = time;
+            bestAlg = alg;
+        }
+    }
+    return bestAlg;
+}
+
+template<typename F>
+double ModeledTrsmTime
+( TrsmAlgorithm alg,
+  const AbstractDistMatrix<F>& A,
+  const AbstractDistMatrix<F>& B,
+  const PerfModel& model )
+{
+    DEBUG_CSE
+    const Grid& g = B.Grid();
+    const double r = g.Height();
+    const double c = g.Width();
+    const double p = g.Size();
+    const double m = B.Height();
+    const double n = B.Width();
+    const double w = sizeof(F);
+    const double nb = Min( double(Blocksize()), Max(m,1.) );
+    const double alphaCol = model.colLatency;
+    const double betaCol = model.colInvBandwidth;
+    const double alphaRow = model.rowLatency;
+    const double betaRow = model.rowInvBandwidth;
+    const double alphaGrid = GridLatency( model );
+    const double betaGrid = GridInvBandwidth( model );
+    const double flopTime = FlopScale<F>()*model.flopTime;
+
+    // Each of the numPanels iterations solves against an nb x nb diagonal
+    // block and then updates the (on average) trailingHeight rows below it
+    const double numPanels = std::ceil( m/nb );
+    const double trailingHeight = Max( m-nb, 0. ) / 2;
+    const double updateTime =
+      numPanels*flopTime*(2.*trailingHeight*nb*n/p);
+    const double diagTime =
+      numPanels*AllGatherTime( p, nb*nb*w, alphaGrid, betaGrid );
+    switch( alg )
+    {
+    case TRSM_LARGE:
+        // The solves are split over the entire grid, which requires a
+        // redistribution of each block row of B within process columns on
+        // the way in and on the way out
+        return updateTime + diagTime + ProxyTime( A, MC, MR, model ) +
+          ProxyTime( B, MC, MR, model ) +
+          numPanels*
+          ( flopTime*nb*nb*n/p +
+            AllToAllTime( r, nb*n*w/c, alphaCol, betaCol ) +
+            AllGatherTime( r, nb*n*w/c, alphaCol, betaCol ) +
+            AllGatherTime( c, trailingHeight*nb*w/r, alphaRow, betaRow ) );
+    case TRSM_MEDIUM:
+        // The solves are redundantly performed within process columns
+        return updateTime + diagTime + ProxyTime( A, MC, MR, model ) +
+          ProxyTime( B, MC, MR, model ) +
+          numPanels*
+          ( flopTime*nb*nb*n/c +
+            AllGatherTime( r, nb*n*w/c, alphaCol, betaCol ) +
+            AllGatherTime( c, trailingHeight*nb*w/r, alphaRow, betaRow ) );
+    case TRSM_SMALL:
+        // A and B are redistributed into [VC,* ] and each block row of B is
+        // gathered onto (and redundantly solved by) every process
+        return updateTime + diagTime + ProxyTime( A, VC, STAR, model ) +
+          2*ProxyTime( B, VC, STAR, model ) +
+          numPanels*
+          ( flopTime*nb*nb*n +
+            AllGatherTime( p, nb*n*w, alphaGrid, betaGrid ) );
+    default:
+        LogicError("Trsm algorithm ",Int(alg)," is not modeled");
+    }
+    return 0;
+}
+
+template<typename F>
+TrsmAlgorithm ModeledTrsmAlgorithm
+( const AbstractDistMatrix<F>& A,
+  const AbstractDistMatrix<F>& B,
+  const PerfModel& model )
+{
+    DEBUG_CSE
+    const TrsmAlgorithm algs[3] = { TRSM_LARGE, TRSM_MEDIUM, TRSM_SMALL };
+    TrsmAlgorithm bestAlg = algs[0];
+    double bestTime = limits::Infinity<double>();
+    for( TrsmAlgorithm alg : algs )
+    {
+        const double time = ModeledTrsmTime( alg, A, B, model );
+        if( time < bestTime )
+        {
+            bestTime = time;
+            bestAlg = alg;
+        }
+    }
+    return bestAlg;
+}
+
+#define PROTO(T) \
+  template double ModeledGemmTime \
+  ( GemmAlgorithm alg, Orientation orientA, Orientation orientB, \
+    const AbstractDistMatrix<T>& A, \
+    const AbstractDistMatrix<T>& B, \
+    const AbstractDistMatrix<T>& C, \
+    const PerfModel& model ); \
+  template GemmAlgorithm ModeledGemmAlgorithm \
+  ( Orientation orientA, Orientation orientB, \
+    const AbstractDistMatrix<T>& A, \
+    const AbstractDistMatrix<T>& B, \
+    const AbstractDistMatrix<T>& C, \
+    const PerfModel& model ); \
+  template double ModeledTrsmTime \
+  ( TrsmAlgorithm alg, \
+    const AbstractDistMatrix<T>& A, \
+    const AbstractDistMatrix<T>& B, \
+    const PerfModel& model ); \
+  template TrsmAlgorithm ModeledTrsmAlgorithm \
+  ( const AbstractDistMatrix<T>& A, \
+    const AbstractDistMatrix<T>& B, \
+    const PerfModel& model );
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
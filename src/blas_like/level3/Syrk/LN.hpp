@@ -28,9 +28,9 @@ void LN_C
     auto& C = CProx.Get();
 
     // Temporary distributions
-    DistMatrix<T,MC,  STAR> A1_MC_STAR(g);
-    DistMatrix<T,VR,  STAR> A1_VR_STAR(g);
-    DistMatrix<T,STAR,MR  > A1Trans_STAR_MR(g);
+    WorkspaceDistMatrix<T,MC,  STAR> A1_MC_STAR(g);
+    WorkspaceDistMatrix<T,VR,  STAR> A1_VR_STAR(g);
+    WorkspaceDistMatrix<T,STAR,MR  > A1Trans_STAR_MR(g);
 
     A1_MC_STAR.AlignWith( C );
     A1_VR_STAR.AlignWith( C );
@@ -65,9 +65,9 @@ void LNDot
     auto& C = CProx.Get();
 
     // Temporary distributions
-    DistMatrix<T,MC,  STAR> A1_MC_STAR(g);
-    DistMatrix<T,VR,  STAR> A1_VR_STAR(g);
-    DistMatrix<T,STAR,MR  > A1Trans_STAR_MR(g);
+    WorkspaceDistMatrix<T,MC,  STAR> A1_MC_STAR(g);
+    WorkspaceDistMatrix<T,VR,  STAR> A1_VR_STAR(g);
+    WorkspaceDistMatrix<T,STAR,MR  > A1Trans_STAR_MR(g);
 
     A1_MC_STAR.AlignWith( C );
     A1_VR_STAR.AlignWith( C );
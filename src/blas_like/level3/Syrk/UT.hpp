@@ -29,9 +29,9 @@ void UT_C
     auto& C = CProx.Get();
 
     // Temporary distributions
-    DistMatrix<T,MR,  STAR> A1Trans_MR_STAR(g);
-    DistMatrix<T,STAR,VR  > A1_STAR_VR(g);
-    DistMatrix<T,STAR,MC  > A1_STAR_MC(g);
+    WorkspaceDistMatrix<T,MR,  STAR> A1Trans_MR_STAR(g);
+    WorkspaceDistMatrix<T,STAR,VR  > A1_STAR_VR(g);
+    WorkspaceDistMatrix<T,STAR,MC  > A1_STAR_MC(g);
 
     A1Trans_MR_STAR.AlignWith( C );
     A1_STAR_MC.AlignWith( C );
@@ -89,9 +89,9 @@ void LLNA
     auto& L = LProx.GetLocked();
     auto& X = XProx.Get();
 
-    DistMatrix<T,VR,  STAR> X1_VR_STAR(g);
-    DistMatrix<T,STAR,MR  > X1Trans_STAR_MR(g);
-    DistMatrix<T,MC,  STAR> Z1_MC_STAR(g);
+    WorkspaceDistMatrix<T,VR,  STAR> X1_VR_STAR(g);
+    WorkspaceDistMatrix<T,STAR,MR  > X1Trans_STAR_MR(g);
+    WorkspaceDistMatrix<T,MC,  STAR> Z1_MC_STAR(g);
 
     X1_VR_STAR.AlignWith( L );
     X1Trans_STAR_MR.AlignWith( L );
@@ -136,12 +136,12 @@ void LLNCOld
     auto& L = LProx.GetLocked();
     auto& X = XProx.Get();
 
-    DistMatrix<T,STAR,MC  > L10_STAR_MC(g);
-    DistMatrix<T,STAR,STAR> L11_STAR_STAR(g);
-    DistMatrix<T,STAR,VR  > X1_STAR_VR(g);
-    DistMatrix<T,MR,  STAR> D1Trans_MR_STAR(g);
-    DistMatrix<T,MR,  MC  > D1Trans_MR_MC(g);
-    DistMatrix<T,MC,  MR  > D1(g);
+    WorkspaceDistMatrix<T,STAR,MC  > L10_STAR_MC(g);
+    WorkspaceDistMatrix<T,STAR,STAR> L11_STAR_STAR(g);
+    WorkspaceDistMatrix<T,STAR,VR  > X1_STAR_VR(g);
+    WorkspaceDistMatrix<T,MR,  STAR> D1Trans_MR_STAR(g);
+    WorkspaceDistMatrix<T,MR,  MC  > D1Trans_MR_MC(g);
+    WorkspaceDistMatrix<T,MC,  MR  > D1(g);
 
     const Int kLast = LastOffset( m, bsize );
     for( Int k=kLast; k>=0; k-=bsize )
@@ -196,10 +196,10 @@ void LLNC
     auto& L = LProx.GetLocked();
     auto& X = XProx.Get();
 
-    DistMatrix<T,MC,  STAR> L21_MC_STAR(g);
-    DistMatrix<T,STAR,STAR> L11_STAR_STAR(g);
-    DistMatrix<T,STAR,VR  > X1_STAR_VR(g);
-    DistMatrix<T,MR,  STAR> X1Trans_MR_STAR(g);
+    WorkspaceDistMatrix<T,MC,  STAR> L21_MC_STAR(g);
+    WorkspaceDistMatrix<T,STAR,STAR> L11_STAR_STAR(g);
+    WorkspaceDistMatrix<T,STAR,VR  > X1_STAR_VR(g);
+    WorkspaceDistMatrix<T,MR,  STAR> X1Trans_MR_STAR(g);
 
     const Int kLast = LastOffset( m, bsize );
     for( Int k=kLast; k>=0; k-=bsize )
@@ -90,9 +90,9 @@ void LLTA
     auto& L = LProx.GetLocked();
     auto& X = XProx.Get();
 
-    DistMatrix<T,MC,STAR> X1_MC_STAR(g);
-    DistMatrix<T,MR,STAR> Z1_MR_STAR(g);
-    DistMatrix<T,MR,MC  > Z1_MR_MC(g);
+    WorkspaceDistMatrix<T,MC,STAR> X1_MC_STAR(g);
+    WorkspaceDistMatrix<T,MR,STAR> Z1_MR_STAR(g);
+    WorkspaceDistMatrix<T,MR,MC  > Z1_MR_MC(g);
 
     X1_MC_STAR.AlignWith( L );
     Z1_MR_STAR.AlignWith( L );
@@ -141,12 +141,12 @@ void LLTCOld
     auto& L = LProx.GetLocked();
     auto& X = XProx.Get();
 
-    DistMatrix<T,STAR,STAR> L11_STAR_STAR(g);
-    DistMatrix<T,MC,  STAR> L21_MC_STAR(g);
-    DistMatrix<T,STAR,VR  > X1_STAR_VR(g);
-    DistMatrix<T,MR,  STAR> D1Trans_MR_STAR(g);
-    DistMatrix<T,MR,  MC  > D1Trans_MR_MC(g);
-    DistMatrix<T,MC,  MR  > D1(g);
+    WorkspaceDistMatrix<T,STAR,STAR> L11_STAR_STAR(g);
+    WorkspaceDistMatrix<T,MC,  STAR> L21_MC_STAR(g);
+    WorkspaceDistMatrix<T,STAR,VR  > X1_STAR_VR(g);
+    WorkspaceDistMatrix<T,MR,  STAR> D1Trans_MR_STAR(g);
+    WorkspaceDistMatrix<T,MR,  MC  > D1Trans_MR_MC(g);
+    WorkspaceDistMatrix<T,MC,  MR  > D1(g);
 
     for( Int k=0; k<m; k+=bsize )
     {
@@ -204,10 +204,10 @@ void LLTC
     auto& L = LProx.GetLocked();
     auto& X = XProx.Get();
 
-    DistMatrix<T,STAR,STAR> L11_STAR_STAR(g);
-    DistMatrix<T,STAR,MC  > L10_STAR_MC(g);
-    DistMatrix<T,STAR,VR  > X1_STAR_VR(g);
-    DistMatrix<T,MR,  STAR> X1Trans_MR_STAR(g);
+    WorkspaceDistMatrix<T,STAR,STAR> L11_STAR_STAR(g);
+    WorkspaceDistMatrix<T,STAR,MC  > L10_STAR_MC(g);
+    WorkspaceDistMatrix<T,STAR,VR  > X1_STAR_VR(g);
+    WorkspaceDistMatrix<T,MR,  STAR> X1Trans_MR_STAR(g);
 
     for( Int k=0; k<m; k+=bsize )
     {
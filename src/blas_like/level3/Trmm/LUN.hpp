@@ -92,9 +92,9 @@ void LUNA
     auto& U = UProx.GetLocked();
     auto& X = XProx.Get();
 
-    DistMatrix<T,VR,  STAR> X1_VR_STAR(g);
-    DistMatrix<T,STAR,MR  > X1Trans_STAR_MR(g);
-    DistMatrix<T,MC,  STAR> Z1_MC_STAR(g);
+    WorkspaceDistMatrix<T,VR,  STAR> X1_VR_STAR(g);
+    WorkspaceDistMatrix<T,STAR,MR  > X1Trans_STAR_MR(g);
+    WorkspaceDistMatrix<T,MC,  STAR> Z1_MC_STAR(g);
 
     X1_VR_STAR.AlignWith( U );
     X1Trans_STAR_MR.AlignWith( U );
@@ -140,12 +140,12 @@ void LUNCOld
     auto& U = UProx.GetLocked();
     auto& X = XProx.Get();
 
-    DistMatrix<T,STAR,STAR> U11_STAR_STAR(g);
-    DistMatrix<T,STAR,MC  > U12_STAR_MC(g);
-    DistMatrix<T,STAR,VR  > X1_STAR_VR(g);
-    DistMatrix<T,MR,  STAR> D1Trans_MR_STAR(g);
-    DistMatrix<T,MR,  MC  > D1Trans_MR_MC(g);
-    DistMatrix<T,MC,  MR  > D1(g);
+    WorkspaceDistMatrix<T,STAR,STAR> U11_STAR_STAR(g);
+    WorkspaceDistMatrix<T,STAR,MC  > U12_STAR_MC(g);
+    WorkspaceDistMatrix<T,STAR,VR  > X1_STAR_VR(g);
+    WorkspaceDistMatrix<T,MR,  STAR> D1Trans_MR_STAR(g);
+    WorkspaceDistMatrix<T,MR,  MC  > D1Trans_MR_MC(g);
+    WorkspaceDistMatrix<T,MC,  MR  > D1(g);
 
     for( Int k=0; k<m; k+=bsize )
     {
@@ -200,10 +200,10 @@ void LUNC
     auto& U = UProx.GetLocked();
     auto& X = XProx.Get();
 
-    DistMatrix<T,STAR,STAR> U11_STAR_STAR(g);
-    DistMatrix<T,MC,  STAR> U01_MC_STAR(g);
-    DistMatrix<T,STAR,VR  > X1_STAR_VR(g);
-    DistMatrix<T,MR,  STAR> X1Trans_MR_STAR(g);
+    WorkspaceDistMatrix<T,STAR,STAR> U11_STAR_STAR(g);
+    WorkspaceDistMatrix<T,MC,  STAR> U01_MC_STAR(g);
+    WorkspaceDistMatrix<T,STAR,VR  > X1_STAR_VR(g);
+    WorkspaceDistMatrix<T,MR,  STAR> X1Trans_MR_STAR(g);
 
     for( Int k=0; k<m; k+=bsize )
     {
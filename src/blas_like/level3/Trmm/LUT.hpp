@@ -91,9 +91,9 @@ void LUTA
     auto& U = UProx.GetLocked();
     auto& X = XProx.Get();
 
-    DistMatrix<T,MC,STAR> X1_MC_STAR(g);
-    DistMatrix<T,MR,STAR> Z1_MR_STAR(g);
-    DistMatrix<T,MR,MC  > Z1_MR_MC(g);
+    WorkspaceDistMatrix<T,MC,STAR> X1_MC_STAR(g);
+    WorkspaceDistMatrix<T,MR,STAR> Z1_MR_STAR(g);
+    WorkspaceDistMatrix<T,MR,MC  > Z1_MR_MC(g);
 
     X1_MC_STAR.AlignWith( U );
     Z1_MR_STAR.AlignWith( U );
@@ -142,12 +142,12 @@ void LUTCOld
     auto& U = UProx.GetLocked();
     auto& X = XProx.Get();
 
-    DistMatrix<T,MC,  STAR> U01_MC_STAR(g);
-    DistMatrix<T,STAR,STAR> U11_STAR_STAR(g); 
-    DistMatrix<T,STAR,VR  > X1_STAR_VR(g);
-    DistMatrix<T,MR,  STAR> D1Trans_MR_STAR(g);
-    DistMatrix<T,MR,  MC  > D1Trans_MR_MC(g);
-    DistMatrix<T,MC,  MR  > D1(g);
+    WorkspaceDistMatrix<T,MC,  STAR> U01_MC_STAR(g);
+    WorkspaceDistMatrix<T,STAR,STAR> U11_STAR_STAR(g); 
+    WorkspaceDistMatrix<T,STAR,VR  > X1_STAR_VR(g);
+    WorkspaceDistMatrix<T,MR,  STAR> D1Trans_MR_STAR(g);
+    WorkspaceDistMatrix<T,MR,  MC  > D1Trans_MR_MC(g);
+    WorkspaceDistMatrix<T,MC,  MR  > D1(g);
 
     const Int kLast = LastOffset( m, bsize );
     for( Int k=kLast; k>=0; k-=bsize )
@@ -206,10 +206,10 @@ void LUTC
     auto& U = UProx.GetLocked();
     auto& X = XProx.Get();
 
-    DistMatrix<T,STAR,MC  > U12_STAR_MC(g);
-    DistMatrix<T,STAR,STAR> U11_STAR_STAR(g);
-    DistMatrix<T,STAR,VR  > X1_STAR_VR(g);
-    DistMatrix<T,MR,  STAR> X1Trans_MR_STAR(g);
+    WorkspaceDistMatrix<T,STAR,MC  > U12_STAR_MC(g);
+    WorkspaceDistMatrix<T,STAR,STAR> U11_STAR_STAR(g);
+    WorkspaceDistMatrix<T,STAR,VR  > X1_STAR_VR(g);
+    WorkspaceDistMatrix<T,MR,  STAR> X1Trans_MR_STAR(g);
 
     const Int kLast = LastOffset( m, bsize );
     for( Int k=kLast; k>=0; k-=bsize )
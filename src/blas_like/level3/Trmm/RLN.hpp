@@ -89,10 +89,10 @@ void RLNA
     auto& L = LProx.GetLocked();
     auto& X = XProx.Get();
 
-    DistMatrix<T,STAR,VC  > X1_STAR_VC(g);
-    DistMatrix<T,STAR,MC  > X1_STAR_MC(g);
-    DistMatrix<T,MR,  STAR> Z1Trans_MR_STAR(g);
-    DistMatrix<T,MR,  MC  > Z1Trans_MR_MC(g);
+    WorkspaceDistMatrix<T,STAR,VC  > X1_STAR_VC(g);
+    WorkspaceDistMatrix<T,STAR,MC  > X1_STAR_MC(g);
+    WorkspaceDistMatrix<T,MR,  STAR> Z1Trans_MR_STAR(g);
+    WorkspaceDistMatrix<T,MR,  MC  > Z1Trans_MR_MC(g);
 
     X1_STAR_VC.AlignWith( L );
     X1_STAR_MC.AlignWith( L );
@@ -140,10 +140,10 @@ void RLNCOld
     auto& L = LProx.GetLocked();
     auto& X = XProx.Get();
 
-    DistMatrix<T,STAR,STAR> L11_STAR_STAR(g);
-    DistMatrix<T,MR,  STAR> L21_MR_STAR(g);
-    DistMatrix<T,VC,  STAR> X1_VC_STAR(g);
-    DistMatrix<T,MC,  STAR> D1_MC_STAR(g);
+    WorkspaceDistMatrix<T,STAR,STAR> L11_STAR_STAR(g);
+    WorkspaceDistMatrix<T,MR,  STAR> L21_MR_STAR(g);
+    WorkspaceDistMatrix<T,VC,  STAR> X1_VC_STAR(g);
+    WorkspaceDistMatrix<T,MC,  STAR> D1_MC_STAR(g);
 
     for( Int k=0; k<n; k+=bsize )
     {
@@ -191,10 +191,10 @@ void RLNC
     auto& L = LProx.GetLocked();
     auto& X = XProx.Get();
 
-    DistMatrix<T,STAR,STAR> L11_STAR_STAR(g);
-    DistMatrix<T,MR,  STAR> L10Trans_MR_STAR(g);
-    DistMatrix<T,VC,  STAR> X1_VC_STAR(g);
-    DistMatrix<T,MC,  STAR> X1_MC_STAR(g);
+    WorkspaceDistMatrix<T,STAR,STAR> L11_STAR_STAR(g);
+    WorkspaceDistMatrix<T,MR,  STAR> L10Trans_MR_STAR(g);
+    WorkspaceDistMatrix<T,VC,  STAR> X1_VC_STAR(g);
+    WorkspaceDistMatrix<T,MC,  STAR> X1_MC_STAR(g);
 
     for( Int k=0; k<n; k+=bsize )
     {
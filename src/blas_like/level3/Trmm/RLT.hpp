@@ -89,10 +89,10 @@ void RLTA
     auto& L = LProx.GetLocked();
     auto& X = XProx.Get();
 
-    DistMatrix<T,MR,  STAR> X1Trans_MR_STAR(g);
-    DistMatrix<T,MC,  STAR> Z1Trans_MC_STAR(g);
-    DistMatrix<T,MC,  MR  > Z1Trans(g);
-    DistMatrix<T,MR,  MC  > Z1Trans_MR_MC(g);
+    WorkspaceDistMatrix<T,MR,  STAR> X1Trans_MR_STAR(g);
+    WorkspaceDistMatrix<T,MC,  STAR> Z1Trans_MC_STAR(g);
+    WorkspaceDistMatrix<T,MC,  MR  > Z1Trans(g);
+    WorkspaceDistMatrix<T,MR,  MC  > Z1Trans_MR_MC(g);
 
     X1Trans_MR_STAR.AlignWith( L );
     Z1Trans_MC_STAR.AlignWith( L );
@@ -142,10 +142,10 @@ void RLTC
     auto& L = LProx.GetLocked();
     auto& X = XProx.Get();
 
-    DistMatrix<T,MR,  STAR> L10Trans_MR_STAR(g);
-    DistMatrix<T,STAR,STAR> L11_STAR_STAR(g);
-    DistMatrix<T,VC,  STAR> X1_VC_STAR(g);
-    DistMatrix<T,MC,  STAR> D1_MC_STAR(g);
+    WorkspaceDistMatrix<T,MR,  STAR> L10Trans_MR_STAR(g);
+    WorkspaceDistMatrix<T,STAR,STAR> L11_STAR_STAR(g);
+    WorkspaceDistMatrix<T,VC,  STAR> X1_VC_STAR(g);
+    WorkspaceDistMatrix<T,MC,  STAR> D1_MC_STAR(g);
 
     const Int kLast = LastOffset( n, bsize );
     for( Int k=kLast; k>=0; k-=bsize )
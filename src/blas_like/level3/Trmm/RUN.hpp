@@ -83,10 +83,10 @@ void RUNA
     auto& U = UProx.GetLocked();
     auto& X = XProx.Get();
 
-    DistMatrix<T,STAR,VC  > X1_STAR_VC(g);
-    DistMatrix<T,STAR,MC  > X1_STAR_MC(g);
-    DistMatrix<T,MR,  STAR> Z1Trans_MR_STAR(g);
-    DistMatrix<T,MR,  MC  > Z1Trans_MR_MC(g);
+    WorkspaceDistMatrix<T,STAR,VC  > X1_STAR_VC(g);
+    WorkspaceDistMatrix<T,STAR,MC  > X1_STAR_MC(g);
+    WorkspaceDistMatrix<T,MR,  STAR> Z1Trans_MR_STAR(g);
+    WorkspaceDistMatrix<T,MR,  MC  > Z1Trans_MR_MC(g);
 
     X1_STAR_VC.AlignWith( U );
     X1_STAR_MC.AlignWith( U );
@@ -133,10 +133,10 @@ void RUNCOld
     auto& U = UProx.GetLocked();
     auto& X = XProx.Get();
 
-    DistMatrix<T,MR,  STAR> U01_MR_STAR(g);
-    DistMatrix<T,STAR,STAR> U11_STAR_STAR(g); 
-    DistMatrix<T,VC,  STAR> X1_VC_STAR(g);    
-    DistMatrix<T,MC,  STAR> D1_MC_STAR(g);
+    WorkspaceDistMatrix<T,MR,  STAR> U01_MR_STAR(g);
+    WorkspaceDistMatrix<T,STAR,STAR> U11_STAR_STAR(g); 
+    WorkspaceDistMatrix<T,VC,  STAR> X1_VC_STAR(g);    
+    WorkspaceDistMatrix<T,MC,  STAR> D1_MC_STAR(g);
     
     const Int kLast = LastOffset( n, bsize );
     for( Int k=kLast; k>=0; k-=bsize )
@@ -185,10 +185,10 @@ void RUNC
     auto& U = UProx.GetLocked();
     auto& X = XProx.Get();
 
-    DistMatrix<T,MR,  STAR> U12Trans_MR_STAR(g);
-    DistMatrix<T,STAR,STAR> U11_STAR_STAR(g);
-    DistMatrix<T,VC,  STAR> X1_VC_STAR(g);
-    DistMatrix<T,MC,  STAR> X1_MC_STAR(g);
+    WorkspaceDistMatrix<T,MR,  STAR> U12Trans_MR_STAR(g);
+    WorkspaceDistMatrix<T,STAR,STAR> U11_STAR_STAR(g);
+    WorkspaceDistMatrix<T,VC,  STAR> X1_VC_STAR(g);
+    WorkspaceDistMatrix<T,MC,  STAR> X1_MC_STAR(g);
     
     const Int kLast = LastOffset( n, bsize );
     for( Int k=kLast; k>=0; k-=bsize )
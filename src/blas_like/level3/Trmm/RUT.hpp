@@ -88,10 +88,10 @@ void RUTA
     auto& U = UProx.GetLocked();
     auto& X = XProx.Get();
 
-    DistMatrix<T,MR,  STAR> X1Trans_MR_STAR(g);
-    DistMatrix<T,MC,  STAR> Z1Trans_MC_STAR(g);
-    DistMatrix<T,MC,  MR  > Z1Trans(g);
-    DistMatrix<T,MR,  MC  > Z1Trans_MR_MC(g);
+    WorkspaceDistMatrix<T,MR,  STAR> X1Trans_MR_STAR(g);
+    WorkspaceDistMatrix<T,MC,  STAR> Z1Trans_MC_STAR(g);
+    WorkspaceDistMatrix<T,MC,  MR  > Z1Trans(g);
+    WorkspaceDistMatrix<T,MR,  MC  > Z1Trans_MR_MC(g);
 
     X1Trans_MR_STAR.AlignWith( U );
     Z1Trans_MC_STAR.AlignWith( U );
@@ -141,10 +141,10 @@ void RUTC
     auto& U = UProx.GetLocked();
     auto& X = XProx.Get();
 
-    DistMatrix<T,STAR,STAR> U11_STAR_STAR(g);
-    DistMatrix<T,MR,  STAR> U12Trans_MR_STAR(g);
-    DistMatrix<T,VC,  STAR> X1_VC_STAR(g);
-    DistMatrix<T,MC,  STAR> D1_MC_STAR(g);
+    WorkspaceDistMatrix<T,STAR,STAR> U11_STAR_STAR(g);
+    WorkspaceDistMatrix<T,MR,  STAR> U12Trans_MR_STAR(g);
+    WorkspaceDistMatrix<T,VC,  STAR> X1_VC_STAR(g);
+    WorkspaceDistMatrix<T,MC,  STAR> D1_MC_STAR(g);
     
     for( Int k=0; k<n; k+=bsize )
     {
@@ -109,6 +109,9 @@ void Trsm
     }
     */
 
+    if( side == LEFT && alg == TRSM_DEFAULT && HavePerfModel() )
+        alg = ModeledTrsmAlgorithm( A, B, GetPerfModel() );
+
     const Int p = B.Grid().Size();
     if( side == LEFT && uplo == LOWER )
     {
@@ -32,10 +32,10 @@ void LLNLarge
     auto& L = LProx.GetLocked();
     auto& X = XProx.Get();
 
-    DistMatrix<F,STAR,STAR> L11_STAR_STAR(g);
-    DistMatrix<F,MC,  STAR> L21_MC_STAR(g);
-    DistMatrix<F,STAR,MR  > X1_STAR_MR(g);
-    DistMatrix<F,STAR,VR  > X1_STAR_VR(g);
+    WorkspaceDistMatrix<F,STAR,STAR> L11_STAR_STAR(g);
+    WorkspaceDistMatrix<F,MC,  STAR> L21_MC_STAR(g);
+    WorkspaceDistMatrix<F,STAR,MR  > X1_STAR_MR(g);
+    WorkspaceDistMatrix<F,STAR,VR  > X1_STAR_VR(g);
 
     for( Int k=0; k<m; k+=bsize )
     {
@@ -87,9 +87,9 @@ void LLNMedium
     auto& L = LProx.GetLocked();
     auto& X = XProx.Get();
 
-    DistMatrix<F,STAR,STAR> L11_STAR_STAR(g);
-    DistMatrix<F,MC,  STAR> L21_MC_STAR(g);
-    DistMatrix<F,MR,  STAR> X1Trans_MR_STAR(g);
+    WorkspaceDistMatrix<F,STAR,STAR> L11_STAR_STAR(g);
+    WorkspaceDistMatrix<F,MC,  STAR> L21_MC_STAR(g);
+    WorkspaceDistMatrix<F,MR,  STAR> X1Trans_MR_STAR(g);
 
     for( Int k=0; k<m; k+=bsize )
     {
@@ -140,7 +140,7 @@ void LLNSmall
     const Int bsize = Blocksize();
     const Grid& g = L.Grid();
 
-    DistMatrix<F,STAR,STAR> L11_STAR_STAR(g), X1_STAR_STAR(g);
+    WorkspaceDistMatrix<F,STAR,STAR> L11_STAR_STAR(g), X1_STAR_STAR(g);
 
     for( Int k=0; k<m; k+=bsize )
     {
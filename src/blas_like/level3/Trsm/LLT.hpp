@@ -39,10 +39,10 @@ void LLTLarge
     auto& L = LProx.GetLocked();
     auto& X = XProx.Get();
 
-    DistMatrix<F,STAR,MC  > L10_STAR_MC(g);
-    DistMatrix<F,STAR,STAR> L11_STAR_STAR(g);
-    DistMatrix<F,STAR,MR  > X1_STAR_MR(g);
-    DistMatrix<F,STAR,VR  > X1_STAR_VR(g);
+    WorkspaceDistMatrix<F,STAR,MC  > L10_STAR_MC(g);
+    WorkspaceDistMatrix<F,STAR,STAR> L11_STAR_STAR(g);
+    WorkspaceDistMatrix<F,STAR,MR  > X1_STAR_MR(g);
+    WorkspaceDistMatrix<F,STAR,VR  > X1_STAR_VR(g);
 
     const Int kLast = LastOffset( m, bsize );
     for( Int k=kLast; k>=0; k-=bsize )
@@ -102,9 +102,9 @@ void LLTMedium
     auto& L = LProx.GetLocked();
     auto& X = XProx.Get();
 
-    DistMatrix<F,STAR,MC  > L10_STAR_MC(g);
-    DistMatrix<F,STAR,STAR> L11_STAR_STAR(g);
-    DistMatrix<F,MR,  STAR> X1Trans_MR_STAR(g);
+    WorkspaceDistMatrix<F,STAR,MC  > L10_STAR_MC(g);
+    WorkspaceDistMatrix<F,STAR,STAR> L11_STAR_STAR(g);
+    WorkspaceDistMatrix<F,MR,  STAR> X1Trans_MR_STAR(g);
 
     const Int kLast = LastOffset( m, bsize );
     for( Int k=kLast; k>=0; k-=bsize )
@@ -167,7 +167,7 @@ void LLTSmall
     const Int bsize = Blocksize();
     const Grid& g = L.Grid();
 
-    DistMatrix<F,STAR,STAR> L11_STAR_STAR(g), Z1_STAR_STAR(g);
+    WorkspaceDistMatrix<F,STAR,STAR> L11_STAR_STAR(g), Z1_STAR_STAR(g);
 
     const Int kLast = LastOffset( m, bsize );
     for( Int k=kLast; k>=0; k-=bsize )
@@ -220,7 +220,7 @@ void LLTSmall
     const Int bsize = Blocksize();
     const Grid& g = L.Grid();
 
-    DistMatrix<F,STAR,STAR> L11_STAR_STAR(g), X1_STAR_STAR(g);
+    WorkspaceDistMatrix<F,STAR,STAR> L11_STAR_STAR(g), X1_STAR_STAR(g);
 
     const Int kLast = LastOffset( m, bsize );
     for( Int k=kLast; k>=0; k-=bsize )
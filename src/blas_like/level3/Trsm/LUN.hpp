@@ -31,10 +31,10 @@ void LUNLarge
     auto& U = UProx.GetLocked();
     auto& X = XProx.Get();
 
-    DistMatrix<F,MC,  STAR> U01_MC_STAR(g);
-    DistMatrix<F,STAR,STAR> U11_STAR_STAR(g);
-    DistMatrix<F,STAR,MR  > X1_STAR_MR(g);
-    DistMatrix<F,STAR,VR  > X1_STAR_VR(g);
+    WorkspaceDistMatrix<F,MC,  STAR> U01_MC_STAR(g);
+    WorkspaceDistMatrix<F,STAR,STAR> U11_STAR_STAR(g);
+    WorkspaceDistMatrix<F,STAR,MR  > X1_STAR_MR(g);
+    WorkspaceDistMatrix<F,STAR,VR  > X1_STAR_VR(g);
 
     const Int kLast = LastOffset( m, bsize );
     for( Int k=kLast; k>=0; k-=bsize )
@@ -86,9 +86,9 @@ void LUNMedium
     auto& U = UProx.GetLocked();
     auto& X = XProx.Get();
 
-    DistMatrix<F,MC,  STAR> U01_MC_STAR(g);
-    DistMatrix<F,STAR,STAR> U11_STAR_STAR(g);
-    DistMatrix<F,MR,  STAR> X1Trans_MR_STAR(g);
+    WorkspaceDistMatrix<F,MC,  STAR> U01_MC_STAR(g);
+    WorkspaceDistMatrix<F,STAR,STAR> U11_STAR_STAR(g);
+    WorkspaceDistMatrix<F,MR,  STAR> X1Trans_MR_STAR(g);
 
     const Int kLast = LastOffset( m, bsize );
     for( Int k=kLast; k>=0; k-=bsize )
@@ -144,7 +144,7 @@ void LUNSmall
     const Int bsize = Blocksize();
     const Grid& g = U.Grid();
 
-    DistMatrix<F,STAR,STAR> U11_STAR_STAR(g), X1_STAR_STAR(g);
+    WorkspaceDistMatrix<F,STAR,STAR> U11_STAR_STAR(g), X1_STAR_STAR(g);
 
     const Int kLast = LastOffset( m, bsize );
     for( Int k=kLast; k>=0; k-=bsize )
@@ -39,10 +39,10 @@ void LUTLarge
     auto& U = UProx.GetLocked();
     auto& X = XProx.Get();
 
-    DistMatrix<F,STAR,STAR> U11_STAR_STAR(g); 
-    DistMatrix<F,STAR,MC  > U12_STAR_MC(g);
-    DistMatrix<F,STAR,MR  > X1_STAR_MR(g);
-    DistMatrix<F,STAR,VR  > X1_STAR_VR(g);
+    WorkspaceDistMatrix<F,STAR,STAR> U11_STAR_STAR(g); 
+    WorkspaceDistMatrix<F,STAR,MC  > U12_STAR_MC(g);
+    WorkspaceDistMatrix<F,STAR,MR  > X1_STAR_MR(g);
+    WorkspaceDistMatrix<F,STAR,VR  > X1_STAR_VR(g);
 
     for( Int k=0; k<m; k+=bsize )
     {
@@ -101,9 +101,9 @@ void LUTMedium
     auto& U = UProx.GetLocked();
     auto& X = XProx.Get();
 
-    DistMatrix<F,STAR,STAR> U11_STAR_STAR(g); 
-    DistMatrix<F,STAR,MC  > U12_STAR_MC(g);
-    DistMatrix<F,MR,  STAR> X1Trans_MR_STAR(g);
+    WorkspaceDistMatrix<F,STAR,STAR> U11_STAR_STAR(g); 
+    WorkspaceDistMatrix<F,STAR,MC  > U12_STAR_MC(g);
+    WorkspaceDistMatrix<F,MR,  STAR> X1Trans_MR_STAR(g);
 
     for( Int k=0; k<m; k+=bsize )
     {
@@ -165,7 +165,7 @@ void LUTSmall
     const Int bsize = Blocksize();
     const Grid& g = U.Grid();
 
-    DistMatrix<F,STAR,STAR> U11_STAR_STAR(g), X1_STAR_STAR(g); 
+    WorkspaceDistMatrix<F,STAR,STAR> U11_STAR_STAR(g), X1_STAR_STAR(g); 
 
     for( Int k=0; k<m; k+=bsize )
     {
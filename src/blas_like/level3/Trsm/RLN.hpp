@@ -33,10 +33,10 @@ void RLN
     auto& L = LProx.GetLocked();
     auto& X = XProx.Get();
 
-    DistMatrix<F,MR,  STAR> L10Trans_MR_STAR(g);
-    DistMatrix<F,STAR,STAR> L11_STAR_STAR(g);
-    DistMatrix<F,STAR,MC  > X1Trans_STAR_MC(g);
-    DistMatrix<F,VC,  STAR> X1_VC_STAR(g);
+    WorkspaceDistMatrix<F,MR,  STAR> L10Trans_MR_STAR(g);
+    WorkspaceDistMatrix<F,STAR,STAR> L11_STAR_STAR(g);
+    WorkspaceDistMatrix<F,STAR,MC  > X1Trans_STAR_MC(g);
+    WorkspaceDistMatrix<F,VC,  STAR> X1_VC_STAR(g);
 
     const Int kLast = LastOffset( n, bsize );
     for( Int k=kLast; k>=0; k-=bsize )
@@ -37,11 +37,11 @@ void RLT
     auto& L = LProx.GetLocked();
     auto& X = XProx.Get();
 
-    DistMatrix<F,STAR,STAR> L11_STAR_STAR(g);
-    DistMatrix<F,VR,  STAR> L21_VR_STAR(g);
-    DistMatrix<F,STAR,MR  > L21Trans_STAR_MR(g);
-    DistMatrix<F,VC,  STAR> X1_VC_STAR(g);
-    DistMatrix<F,STAR,MC  > X1Trans_STAR_MC(g);
+    WorkspaceDistMatrix<F,STAR,STAR> L11_STAR_STAR(g);
+    WorkspaceDistMatrix<F,VR,  STAR> L21_VR_STAR(g);
+    WorkspaceDistMatrix<F,STAR,MR  > L21Trans_STAR_MR(g);
+    WorkspaceDistMatrix<F,VC,  STAR> X1_VC_STAR(g);
+    WorkspaceDistMatrix<F,STAR,MC  > X1Trans_STAR_MC(g);
 
     for( Int k=0; k<n; k+=bsize )
     {
@@ -30,10 +30,10 @@ void RUN
     auto& U = UProx.GetLocked();
     auto& X = XProx.Get();
 
-    DistMatrix<F,STAR,STAR> U11_STAR_STAR(g); 
-    DistMatrix<F,STAR,MR  > U12_STAR_MR(g);
-    DistMatrix<F,VC,  STAR> X1_VC_STAR(g);    
-    DistMatrix<F,STAR,MC  > X1Trans_STAR_MC(g);
+    WorkspaceDistMatrix<F,STAR,STAR> U11_STAR_STAR(g); 
+    WorkspaceDistMatrix<F,STAR,MR  > U12_STAR_MR(g);
+    WorkspaceDistMatrix<F,VC,  STAR> X1_VC_STAR(g);    
+    WorkspaceDistMatrix<F,STAR,MC  > X1Trans_STAR_MC(g);
 
     for( Int k=0; k<n; k+=bsize )
     {
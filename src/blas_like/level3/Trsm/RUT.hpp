@@ -37,11 +37,11 @@ void RUT
     auto& U = UProx.GetLocked();
     auto& X = XProx.Get();
 
-    DistMatrix<F,VR,  STAR> U01_VR_STAR(g);
-    DistMatrix<F,STAR,MR  > U01Trans_STAR_MR(g);
-    DistMatrix<F,STAR,STAR> U11_STAR_STAR(g);
-    DistMatrix<F,VC,  STAR> X1_VC_STAR(g);
-    DistMatrix<F,STAR,MC  > X1Trans_STAR_MC(g);
+    WorkspaceDistMatrix<F,VR,  STAR> U01_VR_STAR(g);
+    WorkspaceDistMatrix<F,STAR,MR  > U01Trans_STAR_MR(g);
+    WorkspaceDistMatrix<F,STAR,STAR> U11_STAR_STAR(g);
+    WorkspaceDistMatrix<F,VC,  STAR> X1_VC_STAR(g);
+    WorkspaceDistMatrix<F,STAR,MC  > X1Trans_STAR_MC(g);
 
     const Int kLast = LastOffset( n, bsize );
     for( Int k=kLast; k>=0; k-=bsize )
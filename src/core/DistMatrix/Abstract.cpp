@@ -37,7 +37,9 @@ EL_NO_EXCEPT
   colShift_(A.colShift_),
   rowShift_(A.rowShift_), 
   root_(A.root_),
-  grid_(A.grid_)
+  grid_(A.grid_),
+  sharedWindow_(std::move(A.sharedWindow_)),
+  nodeShared_(A.nodeShared_)
 { matrix_.ShallowSwap( A.matrix_ ); }
 
 template<typename T>
@@ -59,6 +61,8 @@ AbstractDistMatrix<T>::Empty( bool freeMemory )
     rowConstrained_ = false;
     rootConstrained_ = false;
     SetShifts();
+    sharedWindow_.reset();
+    nodeShared_ = false;
 
     SwapClear( remoteUpdates );
 }
@@ -71,9 +75,19 @@ AbstractDistMatrix<T>::EmptyData( bool freeMemory )
     viewType_ = OWNER;
     height_ = 0;
     width_ = 0;
+    sharedWindow_.reset();
+    nodeShared_ = false;
     SwapClear( remoteUpdates );
 }
 
+template<typename T>
+void
+AbstractDistMatrix<T>::SwapLocalMemory( Memory<T>& memory )
+{
+    EmptyData( false );
+    matrix_.memory_.ShallowSwap( memory );
+}
+
 template<typename T>
 void
 AbstractDistMatrix<T>::SetGrid( const El::Grid& grid )
@@ -177,6 +191,7 @@ AbstractDistMatrix<T>::operator=( AbstractDistMatrix<T>&& A )
         rowShift_ = A.rowShift_;
         root_ = A.root_;
         grid_ = A.grid_;
+        std::swap( sharedWindow_, A.sharedWindow_ );
     }
     return *this;
 }
@@ -210,6 +225,14 @@ Int AbstractDistMatrix<T>::DiagonalLength( Int offset ) const EL_NO_EXCEPT
 template<typename T>
 bool AbstractDistMatrix<T>::Viewing() const EL_NO_EXCEPT 
 { return IsViewing( viewType_ ); }
+
+template<typename T>
+bool AbstractDistMatrix<T>::NodeShared() const EL_NO_EXCEPT 
+{ return nodeShared_; }
+template<typename T>
+const std::shared_ptr<mpi::Window>&
+AbstractDistMatrix<T>::SharedWindow() const EL_NO_EXCEPT
+{ return sharedWindow_; }
 template<typename T>
 bool AbstractDistMatrix<T>::Locked() const EL_NO_EXCEPT 
 { return IsLocked( viewType_ ); }
@@ -229,7 +252,12 @@ Int AbstractDistMatrix<T>::LDim() const EL_NO_EXCEPT
 
 template<typename T>
 El::Matrix<T>& 
-AbstractDistMatrix<T>::Matrix() EL_NO_EXCEPT { return matrix_; }
+AbstractDistMatrix<T>::Matrix()
+{
+    if( nodeShared_ )
+        MakeNodePrivate();
+    return matrix_;
+}
 template<typename T>
 const El::Matrix<T>& 
 AbstractDistMatrix<T>::LockedMatrix() const EL_NO_EXCEPT { return matrix_; }
@@ -242,12 +270,20 @@ AbstractDistMatrix<T>::AllocatedMemory() const EL_NO_EXCEPT
 template<typename T>
 T*
 AbstractDistMatrix<T>::Buffer() EL_NO_RELEASE_EXCEPT
-{ return matrix_.Buffer(); }
+{
+    if( nodeShared_ )
+        MakeNodePrivate();
+    return matrix_.Buffer();
+}
 
 template<typename T>
 T*
 AbstractDistMatrix<T>::Buffer( Int iLoc, Int jLoc ) EL_NO_RELEASE_EXCEPT
-{ return matrix_.Buffer(iLoc,jLoc); }
+{
+    if( nodeShared_ )
+        MakeNodePrivate();
+    return matrix_.Buffer(iLoc,jLoc);
+}
 
 template<typename T>
 const T*
@@ -776,7 +812,11 @@ EL_NO_RELEASE_EXCEPT
 template<typename T>
 void AbstractDistMatrix<T>::SetLocal( Int iLoc, Int jLoc, T alpha )
 EL_NO_RELEASE_EXCEPT
-{ matrix_.Set(iLoc,jLoc,alpha); }
+{
+    if( nodeShared_ )
+        MakeNodePrivate();
+    matrix_.Set(iLoc,jLoc,alpha);
+}
 
 template<typename T>
 void AbstractDistMatrix<T>::SetLocal( const Entry<T>& localEntry )
@@ -787,7 +827,11 @@ template<typename T>
 void
 AbstractDistMatrix<T>::SetLocalRealPart( Int iLoc, Int jLoc, Base<T> alpha )
 EL_NO_RELEASE_EXCEPT
-{ matrix_.SetRealPart(iLoc,jLoc,alpha); }
+{
+    if( nodeShared_ )
+        MakeNodePrivate();
+    matrix_.SetRealPart(iLoc,jLoc,alpha);
+}
 
 template<typename T>
 void
@@ -799,7 +843,11 @@ template<typename T>
 void AbstractDistMatrix<T>::SetLocalImagPart
 ( Int iLoc, Int jLoc, Base<T> alpha )
 EL_NO_RELEASE_EXCEPT
-{ matrix_.SetImagPart(iLoc,jLoc,alpha); }
+{
+    if( nodeShared_ )
+        MakeNodePrivate();
+    matrix_.SetImagPart(iLoc,jLoc,alpha);
+}
 
 template<typename T>
 void AbstractDistMatrix<T>::SetLocalImagPart
@@ -811,7 +859,11 @@ template<typename T>
 void
 AbstractDistMatrix<T>::UpdateLocal( Int iLoc, Int jLoc, T alpha )
 EL_NO_RELEASE_EXCEPT
-{ matrix_.Update(iLoc,jLoc,alpha); }
+{
+    if( nodeShared_ )
+        MakeNodePrivate();
+    matrix_.Update(iLoc,jLoc,alpha);
+}
 
 template<typename T>
 void
@@ -824,7 +876,11 @@ void
 AbstractDistMatrix<T>::UpdateLocalRealPart
 ( Int iLoc, Int jLoc, Base<T> alpha )
 EL_NO_RELEASE_EXCEPT
-{ matrix_.UpdateRealPart(iLoc,jLoc,alpha); }
+{
+    if( nodeShared_ )
+        MakeNodePrivate();
+    matrix_.UpdateRealPart(iLoc,jLoc,alpha);
+}
 
 template<typename T>
 void
@@ -836,7 +892,11 @@ template<typename T>
 void AbstractDistMatrix<T>::UpdateLocalImagPart
 ( Int iLoc, Int jLoc, Base<T> alpha )
 EL_NO_RELEASE_EXCEPT
-{ matrix_.UpdateImagPart(iLoc,jLoc,alpha); }
+{
+    if( nodeShared_ )
+        MakeNodePrivate();
+    matrix_.UpdateImagPart(iLoc,jLoc,alpha);
+}
 
 template<typename T>
 void AbstractDistMatrix<T>::UpdateLocalImagPart
@@ -848,13 +908,21 @@ template<typename T>
 void
 AbstractDistMatrix<T>::MakeLocalReal( Int iLoc, Int jLoc )
 EL_NO_RELEASE_EXCEPT
-{ matrix_.MakeReal( iLoc, jLoc ); }
+{
+    if( nodeShared_ )
+        MakeNodePrivate();
+    matrix_.MakeReal( iLoc, jLoc );
+}
 
 template<typename T>
 void
 AbstractDistMatrix<T>::ConjugateLocal( Int iLoc, Int jLoc )
 EL_NO_RELEASE_EXCEPT
-{ matrix_.Conjugate( iLoc, jLoc ); }
+{
+    if( nodeShared_ )
+        MakeNodePrivate();
+    matrix_.Conjugate( iLoc, jLoc );
+}
 
 template<typename T>
 void
@@ -971,6 +1039,24 @@ AbstractDistMatrix<T>::ShallowSwap( AbstractDistMatrix<T>& A )
     std::swap( rowShift_, A.rowShift_ );
     std::swap( root_, A.root_ );
     std::swap( grid_, A.grid_ );
+    std::swap( sharedWindow_, A.sharedWindow_ );
+    std::swap( nodeShared_, A.nodeShared_ );
+}
+
+// Replace node-shared local data by a private copy
+// ================================================
+// The window itself is kept so that it is still released at the same point
+// by every process of the node (and so that it can be reused)
+
+template<typename T>
+void
+AbstractDistMatrix<T>::MakeNodePrivate()
+{
+    DEBUG_CSE
+    El::Matrix<T> privateMatrix( matrix_ );
+    matrix_.ShallowSwap( privateMatrix );
+    viewType_ = OWNER;
+    nodeShared_ = false;
 }
 
 // Instantiations for {Int,Real,Complex<Real>} for each Real in {float,double}
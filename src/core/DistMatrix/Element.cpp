@@ -40,6 +40,11 @@ void
 ElementalMatrix<T>::Resize( Int height, Int width )
 {
     DEBUG_CSE
+    // Node-shared replicas are replaced by private storage upon resizing (and
+    // every process of the node releases its reference to the window)
+    if( this->sharedWindow_ &&
+        (height != this->height_ || width != this->width_) )
+        this->EmptyData( false );
     DEBUG_ONLY(
       this->AssertNotLocked();
       if( this->Viewing() && (height > this->height_ || width > this->width_) )
@@ -58,6 +63,10 @@ void
 ElementalMatrix<T>::Resize( Int height, Int width, Int ldim )
 {
     DEBUG_CSE
+    if( this->sharedWindow_ &&
+        (height != this->height_ || width != this->width_ ||
+         ldim != this->matrix_.LDim()) )
+        this->EmptyData( false );
     DEBUG_ONLY(
       this->AssertNotLocked();
       if( this->Viewing() && 
@@ -373,6 +382,25 @@ ElementalMatrix<T>::Attach( const El::Grid& g, El::Matrix<T>& A )
     Attach( A.Height(), A.Width(), g, 0, 0, A.Buffer(), A.LDim() );
 }
 
+template<typename T>
+void
+ElementalMatrix<T>::AttachShared
+( Int height, Int width, const El::Grid& g,
+  int colAlign, int rowAlign, T* buffer, Int ldim,
+  std::shared_ptr<mpi::Window> window, int root )
+{
+    DEBUG_CSE
+    const bool colConstrained = this->colConstrained_;
+    const bool rowConstrained = this->rowConstrained_;
+    const bool rootConstrained = this->rootConstrained_;
+    Attach( height, width, g, colAlign, rowAlign, buffer, ldim, root );
+    this->colConstrained_ = colConstrained;
+    this->rowConstrained_ = rowConstrained;
+    this->rootConstrained_ = rootConstrained;
+    this->sharedWindow_ = std::move( window );
+    this->nodeShared_ = true;
+}
+
 template<typename T>
 void
 ElementalMatrix<T>::LockedAttach
@@ -529,6 +557,7 @@ ElementalMatrix<T>::operator=( ElementalMatrix<T>&& A )
         this->rowShift_ = A.rowShift_;
         this->root_ = A.root_;
         this->grid_ = A.grid_;
+        std::swap( this->sharedWindow_, A.sharedWindow_ );
     }
     return *this;
 }
@@ -802,6 +831,8 @@ ElementalMatrix<T>::ShallowSwap( ElementalMatrix<T>& A )
     std::swap( this->rowShift_, A.rowShift_ );
     std::swap( this->root_, A.root_ );
     std::swap( this->grid_, A.grid_ );
+    std::swap( this->sharedWindow_, A.sharedWindow_ );
+    std::swap( this->nodeShared_, A.nodeShared_ );
 }
 
 // Instantiations for {Int,Real,Complex<Real>} for each Real in {float,double}
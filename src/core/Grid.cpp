@@ -9,6 +9,13 @@
 */
 #include <El-lite.hpp>
 
+namespace {
+
+// The number of grids constructed (see Grid::Id)
+int numGrids = 0;
+
+}
+
 namespace El {
 
 Grid* Grid::defaultGrid = 0;
@@ -45,7 +52,7 @@ int Grid::FindFactor( int p ) EL_NO_EXCEPT
 }
 
 Grid::Grid( mpi::Comm comm, GridOrder order )
-: haveViewers_(false), order_(order)
+: haveViewers_(false), order_(order), placement_(RANK_ORDERED)
 {
     DEBUG_CSE
 
@@ -63,7 +70,7 @@ Grid::Grid( mpi::Comm comm, GridOrder order )
 }
 
 Grid::Grid( mpi::Comm comm, int height, GridOrder order )
-: haveViewers_(false), order_(order)
+: haveViewers_(false), order_(order), placement_(RANK_ORDERED)
 {
     DEBUG_CSE
 
@@ -82,6 +89,116 @@ Grid::Grid( mpi::Comm comm, int height, GridOrder order )
     SetUpGrid();
 }
 
+Grid::Grid( mpi::Comm comm, GridPlacement placement, GridOrder order )
+: Grid( comm, 0, placement, order )
+{ }
+
+Grid::Grid
+( mpi::Comm comm, int height, GridPlacement placement, GridOrder order )
+: haveViewers_(false), order_(order), placement_(placement)
+{
+    DEBUG_CSE
+
+    // Extract our rank, the underlying group, and the number of processes
+    mpi::Dup( comm, viewingComm_ );
+    mpi::CommGroup( viewingComm_, viewingGroup_ );
+    size_ = mpi::Size( viewingComm_ );
+
+    if( height < 0 )
+        LogicError("Process grid dimensions must be non-negative");
+    if( placement_ == NODE_AWARE )
+    {
+        height_ = PlaceOnNodes( height );
+    }
+    else
+    {
+        owningGroup_ = viewingGroup_;
+        height_ = ( height == 0 ? FindFactor(size_) : height );
+    }
+
+    SetUpGrid();
+}
+
+// Reorder the processes of the viewing communicator so that the processes
+// on each node are contiguous in the VC ordering (and thus fill entire process
+// columns if the grid height divides the number of processes per node) and
+// return the grid height (choosing one if 'height' is zero).
+//
+// When all nodes have the same number of processes, the automatically-chosen
+// height is the divisor of both the number of processes and the node size
+// which is closest to the square root of the number of processes, as long as
+// the resulting grid is at most twice as skewed as the default one.
+int Grid::PlaceOnNodes( int height )
+{
+    DEBUG_CSE
+    const int viewingRank = mpi::Rank( viewingComm_ );
+
+    // Label each node by its smallest rank
+    mpi::Comm nodeComm;
+    mpi::SplitShared( viewingComm_, viewingRank, nodeComm );
+    int myNodeInfo[2];
+    myNodeInfo[0] = mpi::AllReduce( viewingRank, mpi::MIN, nodeComm );
+    myNodeInfo[1] = mpi::Size( nodeComm );
+    mpi::Free( nodeComm );
+    vector<int> nodeInfo(2*size_);
+    mpi::AllGather( myNodeInfo, 2, nodeInfo.data(), 2, viewingComm_ );
+
+    // Order the processes by their node (and then by their rank)
+    vector<int> placed(size_);
+    for( int q=0; q<size_; ++q )
+        placed[q] = q;
+    std::stable_sort
+    ( placed.begin(), placed.end(),
+      [&]( int q0, int q1 ) { return nodeInfo[2*q0] < nodeInfo[2*q1]; } );
+
+    if( height == 0 )
+    {
+        height = FindFactor( size_ );
+        int minNodeSize = size_, maxNodeSize = 0;
+        for( int q=0; q<size_; ++q )
+        {
+            minNodeSize = Min( minNodeSize, nodeInfo[2*q+1] );
+            maxNodeSize = Max( maxNodeSize, nodeInfo[2*q+1] );
+        }
+        if( minNodeSize == maxNodeSize && minNodeSize % height != 0 )
+        {
+            auto skew = [&]( int h )
+              { return double(Max(h,size_/h)) / double(Min(h,size_/h)); };
+            const double sqrtSize = Sqrt( double(size_) );
+            int bestHeight = 0;
+            for( int h=1; h<=minNodeSize; ++h )
+            {
+                if( size_ % h != 0 || minNodeSize % h != 0 )
+                    continue;
+                if( bestHeight == 0 ||
+                    Abs(Log(h/sqrtSize)) <= Abs(Log(bestHeight/sqrtSize)) )
+                    bestHeight = h;
+            }
+            if( bestHeight != 0 && skew(bestHeight) <= 2*skew(height) )
+                height = bestHeight;
+        }
+    }
+    if( size_ % height != 0 )
+        LogicError
+        ("Grid height, ",height,", does not evenly divide grid size, ",size_);
+
+    // Fill the process columns with the processes in node order
+    const int width = size_ / height;
+    const bool colMajor = ( order_ == COLUMN_MAJOR );
+    vector<int> owningRanks(size_);
+    for( int vcRank=0; vcRank<size_; ++vcRank )
+    {
+        const int mcRank = vcRank % height;
+        const int mrRank = vcRank / height;
+        const int owningRank =
+          ( colMajor ? vcRank : mrRank + mcRank*width );
+        owningRanks[owningRank] = placed[vcRank];
+    }
+    mpi::Incl( viewingGroup_, size_, owningRanks.data(), owningGroup_ );
+
+    return height;
+}
+
 void Grid::SetUpGrid()
 {
     DEBUG_CSE
@@ -92,12 +209,18 @@ void Grid::SetUpGrid()
     viewingRank_ = mpi::Rank( viewingComm_ );
     inGrid_ = ( owningRank_ != mpi::UNDEFINED );
 
+    // The viewing processes may have constructed different numbers of grids
+    id_ = mpi::AllReduce( ::numGrids, mpi::MAX, viewingComm_ );
+    ::numGrids = id_+1;
+    const string suffix = "#" + std::to_string(id_);
+
     const int width = size_ / height_;
     gcd_ = El::GCD( height_, width );
     int lcm = size_ / gcd_;
 
     // Create the communicator for the owning group (mpi::COMM_NULL otherwise)
     mpi::Create( viewingComm_, owningGroup_, owningComm_ );
+    mpi::SetName( viewingComm_, "Viewing"+suffix );
 
     vcToViewing_.resize(size_);
     diagsAndRanks_.resize(2*size_);
@@ -174,6 +297,37 @@ void Grid::SetUpGrid()
         mpi::Split( cartComm_, mdPerpRank_, mdRank_,     mdComm_     );
         mpi::Split( cartComm_, mdRank_,     mdPerpRank_, mdPerpComm_ );
 
+        // Set up the node-local communicators
+        mpi::SplitShared( vcComm_, vcRank_, nodeComm_   );
+        mpi::SplitShared( mcComm_, mcRank_, mcNodeComm_ );
+        mpi::SplitShared( mrComm_, mrRank_, mrNodeComm_ );
+        nodeRank_ = mpi::Rank( nodeComm_ );
+        nodeSize_ = mpi::Size( nodeComm_ );
+        const bool mcNodeLeader = ( mpi::Rank(mcNodeComm_) == 0 );
+        const bool mrNodeLeader = ( mpi::Rank(mrNodeComm_) == 0 );
+        mpi::Split
+        ( vcComm_, (nodeRank_==0 ? 0 : 1), vcRank_, nodeLeaderComm_ );
+        mpi::Split
+        ( mcComm_, (mcNodeLeader ? 0 : 1), mcRank_, mcNodeLeaderComm_ );
+        mpi::Split
+        ( mrComm_, (mrNodeLeader ? 0 : 1), mrRank_, mrNodeLeaderComm_ );
+
+        // Name the communicators for the traffic statistics
+        mpi::SetName( owningComm_, "Owning"+suffix );
+        mpi::SetName( cartComm_, "Cart"+suffix );
+        mpi::SetName( mcComm_, "MC"+suffix );
+        mpi::SetName( mrComm_, "MR"+suffix );
+        mpi::SetName( vcComm_, "VC"+suffix );
+        mpi::SetName( vrComm_, "VR"+suffix );
+        mpi::SetName( mdComm_, "MD"+suffix );
+        mpi::SetName( mdPerpComm_, "MDPerp"+suffix );
+        mpi::SetName( nodeComm_, "Node"+suffix );
+        mpi::SetName( mcNodeComm_, "MCNode"+suffix );
+        mpi::SetName( mrNodeComm_, "MRNode"+suffix );
+        mpi::SetName( nodeLeaderComm_, "NodeLeader"+suffix );
+        mpi::SetName( mcNodeLeaderComm_, "MCNodeLeader"+suffix );
+        mpi::SetName( mrNodeLeaderComm_, "MRNodeLeader"+suffix );
+
         DEBUG_ONLY(
           mpi::ErrorHandlerSet( mcComm_,     mpi::ERRORS_RETURN );
           mpi::ErrorHandlerSet( mrComm_,     mpi::ERRORS_RETURN );
@@ -191,6 +345,12 @@ void Grid::SetUpGrid()
         mdPerpComm_ = mpi::COMM_NULL;
         vcComm_     = mpi::COMM_NULL;
         vrComm_     = mpi::COMM_NULL;
+        nodeComm_   = mpi::COMM_NULL;
+        mcNodeComm_ = mpi::COMM_NULL;
+        mrNodeComm_ = mpi::COMM_NULL;
+        nodeLeaderComm_   = mpi::COMM_NULL;
+        mcNodeLeaderComm_ = mpi::COMM_NULL;
+        mrNodeLeaderComm_ = mpi::COMM_NULL;
 
         mcRank_     = mpi::UNDEFINED;
         mrRank_     = mpi::UNDEFINED;
@@ -198,6 +358,8 @@ void Grid::SetUpGrid()
         mdPerpRank_ = mpi::UNDEFINED;
         vcRank_     = mpi::UNDEFINED;
         vrRank_     = mpi::UNDEFINED;
+        nodeRank_   = mpi::UNDEFINED;
+        nodeSize_   = mpi::UNDEFINED;
 
         // diags and ranks are implicitly set to undefined
     }
@@ -210,21 +372,34 @@ void Grid::SetUpGrid()
 
 Grid::~Grid()
 {
+    // Free any cached workspace which refers to this grid
+    ReleaseWorkspaceCache( *this );
+
     if( !mpi::Finalized() )
     {
         if( InGrid() )
         {
+            for( auto& window : nodeStaging_ )
+                mpi::Free( window );
+            for( auto& layers : layers_ )
+                mpi::Free( layers.depthComm );
             mpi::Free( mdComm_ );
             mpi::Free( mdPerpComm_ );
             mpi::Free( mcComm_ );
             mpi::Free( mrComm_ );
             mpi::Free( vcComm_ );
             mpi::Free( vrComm_ );
+            mpi::Free( nodeComm_ );
+            mpi::Free( mcNodeComm_ );
+            mpi::Free( mrNodeComm_ );
+            mpi::Free( nodeLeaderComm_ );
+            mpi::Free( mcNodeLeaderComm_ );
+            mpi::Free( mrNodeLeaderComm_ );
             mpi::Free( cartComm_ );
             mpi::Free( owningComm_ );
         }
         mpi::Free( viewingComm_ );
-        if( HaveViewers() )
+        if( HaveViewers() || placement_ == NODE_AWARE )
             mpi::Free( owningGroup_ );
         mpi::Free( viewingGroup_ );
     }
@@ -251,6 +426,99 @@ mpi::Comm Grid::MDPerpComm() const EL_NO_EXCEPT { return mdPerpComm_; }
 mpi::Comm Grid::VCComm()     const EL_NO_EXCEPT { return vcComm_;     }
 mpi::Comm Grid::VRComm()     const EL_NO_EXCEPT { return vrComm_;     }
 
+int Grid::NodeRank() const EL_NO_RELEASE_EXCEPT { return nodeRank_; }
+int Grid::NodeSize() const EL_NO_RELEASE_EXCEPT { return nodeSize_; }
+GridPlacement Grid::Placement() const EL_NO_EXCEPT { return placement_; }
+
+mpi::Comm Grid::NodeComm()   const EL_NO_EXCEPT { return nodeComm_;   }
+mpi::Comm Grid::MCNodeComm() const EL_NO_EXCEPT { return mcNodeComm_; }
+mpi::Comm Grid::MRNodeComm() const EL_NO_EXCEPT { return mrNodeComm_; }
+mpi::Comm Grid::NodeLeaderComm() const EL_NO_EXCEPT
+{ return nodeLeaderComm_; }
+mpi::Comm Grid::MCNodeLeaderComm() const EL_NO_EXCEPT
+{ return mcNodeLeaderComm_; }
+mpi::Comm Grid::MRNodeLeaderComm() const EL_NO_EXCEPT
+{ return mrNodeLeaderComm_; }
+
+void* Grid::NodeStaging
+( mpi::Comm nodeComm, size_t numBytes, mpi::Window& window ) const
+{
+    DEBUG_CSE
+    int index = 3;
+    if( nodeComm == nodeComm_ )
+        index = 0;
+    else if( nodeComm == mcNodeComm_ )
+        index = 1;
+    else if( nodeComm == mrNodeComm_ )
+        index = 2;
+    DEBUG_ONLY(
+      if( index == 3 && mpi::Size(nodeComm) != 1 )
+          LogicError("Expected a node-local communicator of the grid");
+    )
+    // Always allocate at least one byte so that the window can be synced
+    numBytes = Max( numBytes, size_t(1) );
+    mpi::Window& staging = nodeStaging_[index];
+    if( staging.numBytes < numBytes )
+    {
+        // Every process of the node makes the same decision since the
+        // requested sizes agree
+        mpi::Free( staging );
+        mpi::AllocateShared( numBytes, nodeComm, staging );
+    }
+    window = staging;
+    return staging.base;
+}
+
+const Grid& Grid::LayerGrid( int numLayers, int layer ) const
+{
+    DEBUG_CSE
+    DEBUG_ONLY(
+      if( layer < 0 || layer >= numLayers )
+          LogicError("Invalid layer ",layer," of ",numLayers);
+    )
+    return *GetLayers(numLayers).grids[layer];
+}
+
+mpi::Comm Grid::LayerDepthComm( int numLayers ) const
+{ return GetLayers(numLayers).depthComm; }
+
+const Grid::Layers& Grid::GetLayers( int numLayers ) const
+{
+    DEBUG_CSE
+    for( const auto& layers : layers_ )
+        if( layers.numLayers == numLayers )
+            return layers;
+    if( numLayers <= 0 || size_ % numLayers != 0 )
+        LogicError
+        ("The number of layers, ",numLayers,", must evenly divide the grid "
+         "size, ",size_);
+
+    // Every viewing process takes part in the construction of each layer's
+    // grid, but only the owning processes belong to the depth communicator
+    Layers layers;
+    layers.numLayers = numLayers;
+    layers.depthComm = mpi::COMM_NULL;
+    const int layerSize = size_ / numLayers;
+    const int layerHeight = FindFactor( layerSize );
+    vector<int> layerRanks( layerSize );
+    for( int l=0; l<numLayers; ++l )
+    {
+        for( int q=0; q<layerSize; ++q )
+            layerRanks[q] = l*layerSize + q;
+        mpi::Group layerGroup;
+        mpi::Incl( owningGroup_, layerSize, layerRanks.data(), layerGroup );
+        layers.grids.emplace_back
+        ( new Grid( viewingComm_, layerGroup, layerHeight, order_ ) );
+        mpi::Free( layerGroup );
+    }
+    if( inGrid_ )
+        mpi::Split
+        ( owningComm_, owningRank_ % layerSize, owningRank_ / layerSize,
+          layers.depthComm );
+    layers_.push_back( std::move(layers) );
+    return layers_.back();
+}
+
 // Provided for simplicity, but redundant
 // ======================================
 int Grid::Height() const EL_NO_EXCEPT { return MCSize(); }
@@ -266,13 +534,14 @@ mpi::Comm Grid::ColComm() const EL_NO_EXCEPT { return MCComm(); }
 mpi::Comm Grid::RowComm() const EL_NO_EXCEPT { return MRComm(); }
 mpi::Comm Grid::Comm() const EL_NO_EXCEPT
 { return ( order_==COLUMN_MAJOR ? VCComm() : VRComm() ); }
+int Grid::Id() const EL_NO_EXCEPT { return id_; }
 
 // Advanced routines
 // =================
 
 // Currently forces a columnMajor absolute rank on the grid
 Grid::Grid( mpi::Comm viewers, mpi::Group owners, int height, GridOrder order )
-: haveViewers_(true), order_(order)
+: haveViewers_(true), order_(order), placement_(RANK_ORDERED)
 {
     DEBUG_CSE
 
@@ -0,0 +1,682 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#ifdef _WIN32
+# include <malloc.h>
+#else
+# include <stdlib.h>
+# ifdef __linux__
+#  include <sys/mman.h>
+# endif
+#endif
+
+namespace {
+using namespace El;
+
+AllocatorCtrl allocatorCtrl;
+
+// The pooled allocator rounds requests up to size classes spaced by quarter
+// powers of two (so that at most 25% of a block is wasted), starting from
+// 64 bytes. 'numClasses' covers every size up to 2^40 bytes.
+const size_t minClassBytes = 64;
+const size_t numClasses = 1 + 4*(40-6);
+
+const size_t hugePageBytes = size_t(1) << 21;
+
+// Returns the index of the smallest class holding 'numBytes' and overwrites
+// 'numBytes' with the capacity of said class
+size_t SizeClass( size_t& numBytes )
+{
+    if( numBytes <= minClassBytes )
+    {
+        numBytes = minClassBytes;
+        return 0;
+    }
+    // Find p such that 2^p < numBytes <= 2^(p+1)
+    size_t p = 6;
+    while( (size_t(1) << (p+1)) < numBytes )
+        ++p;
+    const size_t step = (size_t(1) << p) / 4;
+    const size_t k = (numBytes - (size_t(1) << p) + step - 1) / step;
+    numBytes = (size_t(1) << p) + k*step;
+    return 1 + 4*(p-6) + (k-1);
+}
+
+struct Counters
+{
+    std::atomic<size_t> numRequests{0}, numHits{0}, numSystemFrees{0},
+                        liveBytes{0}, cachedBytes{0}, highWaterMark{0};
+};
+Counters counters;
+
+void UpdateHighWaterMark()
+{
+    const size_t held = ::counters.liveBytes + ::counters.cachedBytes;
+    size_t mark = ::counters.highWaterMark;
+    while( held > mark &&
+           !::counters.highWaterMark.compare_exchange_weak( mark, held ) ) { }
+}
+
+size_t BlockAlignment( size_t numBytes )
+{
+    size_t alignment = ::allocatorCtrl.alignment;
+    if( ::allocatorCtrl.type == SYSTEM_ALLOCATOR )
+        alignment = alignof(std::max_align_t);
+    else if( ::allocatorCtrl.hugePages && numBytes >= hugePageBytes )
+        alignment = std::max( alignment, hugePageBytes );
+    return std::max( alignment, sizeof(void*) );
+}
+
+void* SystemAllocate( size_t numBytes )
+{
+    const size_t alignment = BlockAlignment( numBytes );
+    void* ptr = nullptr;
+#ifdef _WIN32
+    ptr = _aligned_malloc( numBytes, alignment );
+#else
+    if( posix_memalign( &ptr, alignment, numBytes ) != 0 )
+        ptr = nullptr;
+#endif
+    if( ptr == nullptr )
+        throw std::bad_alloc();
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    if( ::allocatorCtrl.hugePages && numBytes >= hugePageBytes )
+        madvise( ptr, numBytes, MADV_HUGEPAGE );
+#endif
+    return ptr;
+}
+
+void SystemFree( void* ptr )
+{
+#ifdef _WIN32
+    _aligned_free( ptr );
+#else
+    free( ptr );
+#endif
+    ++::counters.numSystemFrees;
+}
+
+// Caches are tagged with the generation in which they were filled so that
+// trimming the allocator (or changing its alignment) lazily invalidates the
+// caches of threads which we cannot reach directly
+std::atomic<size_t> generation{0};
+
+struct SharedPool
+{
+    std::mutex mutex;
+    vector<vector<void*>> blocks;
+    size_t numBytes=0;
+
+    SharedPool() : blocks(numClasses) { }
+
+    void Clear()
+    {
+        for( auto& classBlocks : blocks )
+        {
+            for( void* ptr : classBlocks )
+                SystemFree( ptr );
+            SwapClear( classBlocks );
+        }
+        ::counters.cachedBytes -= numBytes;
+        numBytes = 0;
+    }
+
+    ~SharedPool() { Clear(); }
+};
+SharedPool sharedPool;
+
+void ReturnToShared( void* ptr, size_t classIndex, size_t classBytes )
+{
+    std::lock_guard<std::mutex> guard( ::sharedPool.mutex );
+    if( ::sharedPool.numBytes + classBytes <= ::allocatorCtrl.maxCachedBytes )
+    {
+        ::sharedPool.blocks[classIndex].push_back( ptr );
+        ::sharedPool.numBytes += classBytes;
+        ::counters.cachedBytes += classBytes;
+    }
+    else
+        SystemFree( ptr );
+}
+
+struct ThreadCache
+{
+    vector<vector<void*>> blocks;
+    size_t numBytes=0;
+    size_t generation=0;
+
+    ThreadCache() : blocks(numClasses) { }
+
+    void Flush( bool toShared )
+    {
+        size_t classBytes = minClassBytes;
+        for( size_t classIndex=0; classIndex<numClasses; ++classIndex )
+        {
+            for( void* ptr : blocks[classIndex] )
+            {
+                ::counters.cachedBytes -= classBytes;
+                if( toShared )
+                    ReturnToShared( ptr, classIndex, classBytes );
+                else
+                    SystemFree( ptr );
+            }
+            SwapClear( blocks[classIndex] );
+            // Advance to the capacity of the next class
+            classBytes += 1;
+            SizeClass( classBytes );
+        }
+        numBytes = 0;
+    }
+
+    // Ensure that the cache does not hold blocks from a stale generation
+    void Validate()
+    {
+        const size_t currentGeneration = ::generation;
+        if( generation != currentGeneration )
+        {
+            Flush( false );
+            generation = currentGeneration;
+        }
+    }
+
+    ~ThreadCache()
+    { Flush( generation == ::generation ); }
+};
+
+ThreadCache& GetThreadCache()
+{
+    static thread_local ThreadCache cache;
+    cache.Validate();
+    return cache;
+}
+
+// Memory tracking
+// ===============
+struct MemoryUsage
+{
+    size_t numAllocations=0, allocatedBytes=0, liveBytes=0, peakBytes=0;
+};
+
+struct TrackedBlock
+{
+    size_t numBytes;
+    int type, region;
+};
+
+struct MemoryTracker
+{
+    std::mutex mutex;
+    std::atomic<bool> enabled{false};
+    std::atomic<size_t> numBlocks{0};
+    std::unordered_map<const void*,TrackedBlock> blocks;
+
+    // The datatypes and region paths are interned
+    std::map<string,int> typeIndices, regionIndices;
+    vector<string> types, regions;
+    vector<MemoryUsage> typeUsage, regionUsage;
+
+    size_t liveBytes=0, highWaterMark=0;
+    int highWaterRegion=-1;
+    // The live bytes of each datatype at the moment of the high-water mark
+    vector<size_t> highWaterTypeBytes;
+
+    int Intern
+    ( const string& name, std::map<string,int>& indices,
+      vector<string>& names, vector<MemoryUsage>& usage )
+    {
+        auto it = indices.find( name );
+        if( it != indices.end() )
+            return it->second;
+        const int index = names.size();
+        indices[name] = index;
+        names.push_back( name );
+        usage.push_back( MemoryUsage() );
+        return index;
+    }
+};
+MemoryTracker memoryTracker;
+
+} // anonymous namespace
+
+namespace El {
+
+void SetAllocatorCtrl( const AllocatorCtrl& ctrl )
+{
+    DEBUG_CSE
+    if( ctrl.alignment == 0 || (ctrl.alignment & (ctrl.alignment-1)) != 0 )
+        LogicError("Allocator alignment must be a power of two");
+    // Cached blocks might not satisfy the new alignment requirements
+    if( ctrl.alignment > ::allocatorCtrl.alignment ||
+        (ctrl.hugePages && !::allocatorCtrl.hugePages) ||
+        ctrl.type != POOLED_ALLOCATOR )
+        TrimAllocator();
+    ::allocatorCtrl = ctrl;
+}
+
+const AllocatorCtrl& GetAllocatorCtrl()
+{ return ::allocatorCtrl; }
+
+void SetAllocatorCtrlFromArgs( int argc, char** argv )
+{
+    DEBUG_CSE
+    AllocatorCtrl ctrl = ::allocatorCtrl;
+    const string typeFlag="--allocator", alignFlag="--allocAlign",
+                 hugeFlag="--hugePages", trackFlag="--trackMemory";
+    for( int i=0; i+1<argc; ++i )
+    {
+        const string flag = argv[i];
+        const string value = argv[i+1];
+        if( flag == typeFlag )
+        {
+            if( value == "system" )
+                ctrl.type = SYSTEM_ALLOCATOR;
+            else if( value == "aligned" )
+                ctrl.type = ALIGNED_ALLOCATOR;
+            else if( value == "pooled" )
+                ctrl.type = POOLED_ALLOCATOR;
+            else
+                LogicError("Unknown allocator type: ",value);
+        }
+        else if( flag == alignFlag )
+            ctrl.alignment = choice::Cast<size_t>( value );
+        else if( flag == hugeFlag )
+            ctrl.hugePages = choice::Cast<bool>( value );
+        else if( flag == trackFlag )
+            SetMemoryTracking( choice::Cast<bool>( value ) );
+    }
+    SetAllocatorCtrl( ctrl );
+}
+
+void* AllocateBytes( size_t& numBytes )
+{
+    ++::counters.numRequests;
+    const bool pooled = ::allocatorCtrl.type == POOLED_ALLOCATOR &&
+                        numBytes <= ::allocatorCtrl.maxPooledBytes;
+    void* ptr = nullptr;
+    if( pooled )
+    {
+        const size_t classIndex = SizeClass( numBytes );
+        ThreadCache& cache = GetThreadCache();
+        auto& threadBlocks = cache.blocks[classIndex];
+        if( !threadBlocks.empty() )
+        {
+            ptr = threadBlocks.back();
+            threadBlocks.pop_back();
+            cache.numBytes -= numBytes;
+        }
+        else
+        {
+            std::lock_guard<std::mutex> guard( ::sharedPool.mutex );
+            auto& sharedBlocks = ::sharedPool.blocks[classIndex];
+            if( !sharedBlocks.empty() )
+            {
+                ptr = sharedBlocks.back();
+                sharedBlocks.pop_back();
+                ::sharedPool.numBytes -= numBytes;
+            }
+        }
+        if( ptr != nullptr )
+        {
+            ++::counters.numHits;
+            ::counters.cachedBytes -= numBytes;
+            ::counters.liveBytes += numBytes;
+            return ptr;
+        }
+    }
+    ptr = SystemAllocate( numBytes );
+    ::counters.liveBytes += numBytes;
+    UpdateHighWaterMark();
+    return ptr;
+}
+
+void FreeBytes( void* ptr, size_t numBytes )
+{
+    ::counters.liveBytes -= numBytes;
+    if( ::allocatorCtrl.type == POOLED_ALLOCATOR &&
+        numBytes <= ::allocatorCtrl.maxPooledBytes )
+    {
+        // Only blocks whose capacity is exactly that of a size class and
+        // which satisfy the current alignment requirements may be recycled
+        // (blocks allocated before switching allocators might not)
+        size_t classBytes = numBytes;
+        const size_t classIndex = SizeClass( classBytes );
+        const size_t alignment = BlockAlignment( numBytes );
+        if( classBytes == numBytes &&
+            reinterpret_cast<std::uintptr_t>(ptr) % alignment == 0 )
+        {
+            ThreadCache& cache = GetThreadCache();
+            ::counters.cachedBytes += numBytes;
+            if( cache.numBytes + numBytes <=
+                ::allocatorCtrl.maxThreadCachedBytes )
+            {
+                cache.blocks[classIndex].push_back( ptr );
+                cache.numBytes += numBytes;
+            }
+            else
+            {
+                ::counters.cachedBytes -= numBytes;
+                ReturnToShared( ptr, classIndex, numBytes );
+            }
+            return;
+        }
+    }
+    SystemFree( ptr );
+}
+
+void TrimAllocator()
+{
+    DEBUG_CSE
+    ++::generation;
+    GetThreadCache();
+    std::lock_guard<std::mutex> guard( ::sharedPool.mutex );
+    ::sharedPool.Clear();
+}
+
+AllocatorStatistics GetAllocatorStatistics()
+{
+    AllocatorStatistics stats;
+    stats.numRequests = ::counters.numRequests;
+    stats.numHits = ::counters.numHits;
+    stats.numSystemFrees = ::counters.numSystemFrees;
+    stats.liveBytes = ::counters.liveBytes;
+    stats.cachedBytes = ::counters.cachedBytes;
+    stats.highWaterMark = ::counters.highWaterMark;
+    return stats;
+}
+
+void ResetAllocatorStatistics()
+{
+    ::counters.numRequests = 0;
+    ::counters.numHits = 0;
+    ::counters.numSystemFrees = 0;
+    ::counters.highWaterMark =
+      ::counters.liveBytes + ::counters.cachedBytes;
+}
+
+void PrintAllocatorStatistics( ostream& os )
+{
+    const AllocatorStatistics stats = GetAllocatorStatistics();
+    string typeString;
+    switch( ::allocatorCtrl.type )
+    {
+    case SYSTEM_ALLOCATOR:  typeString = "system";  break;
+    case ALIGNED_ALLOCATOR: typeString = "aligned"; break;
+    default:                typeString = "pooled";  break;
+    }
+    os << "Allocator statistics (" << typeString << ", "
+       << ::allocatorCtrl.alignment << "-byte alignment):\n"
+       << "  requests:        " << stats.numRequests << "\n"
+       << "  hit rate:        " << stats.HitRate() << "\n"
+       << "  system frees:    " << stats.numSystemFrees << "\n"
+       << "  live bytes:      " << stats.liveBytes << "\n"
+       << "  cached bytes:    " << stats.cachedBytes << "\n"
+       << "  high-water mark: " << stats.highWaterMark << "\n"
+       << endl;
+}
+
+void SetMemoryTracking( bool track ) { ::memoryTracker.enabled = track; }
+
+bool MemoryTracking() { return ::memoryTracker.enabled; }
+
+size_t TrackedLiveBytes()
+{
+    std::lock_guard<std::mutex> guard( ::memoryTracker.mutex );
+    return ::memoryTracker.liveBytes;
+}
+
+size_t TrackedHighWaterMark()
+{
+    std::lock_guard<std::mutex> guard( ::memoryTracker.mutex );
+    return ::memoryTracker.highWaterMark;
+}
+
+string TrackedHighWaterRegion()
+{
+    std::lock_guard<std::mutex> guard( ::memoryTracker.mutex );
+    const int region = ::memoryTracker.highWaterRegion;
+    return ( region < 0 ? string() : ::memoryTracker.regions[region] );
+}
+
+void ClearMemoryTracking()
+{
+    MemoryTracker& tracker = ::memoryTracker;
+    std::lock_guard<std::mutex> guard( tracker.mutex );
+    for( auto& usage : tracker.typeUsage )
+    {
+        usage.numAllocations = usage.allocatedBytes = 0;
+        usage.peakBytes = usage.liveBytes;
+    }
+    for( auto& usage : tracker.regionUsage )
+        usage.numAllocations = usage.allocatedBytes = usage.peakBytes = 0;
+    tracker.highWaterMark = tracker.liveBytes;
+    tracker.highWaterRegion = -1;
+    tracker.highWaterTypeBytes.clear();
+}
+
+void TrackAllocation( const void* ptr, size_t numBytes, const string& type )
+{
+    MemoryTracker& tracker = ::memoryTracker;
+    const string path = ProfileRegionPath();
+    std::lock_guard<std::mutex> guard( tracker.mutex );
+    const int typeIndex =
+      tracker.Intern
+      ( type, tracker.typeIndices, tracker.types, tracker.typeUsage );
+    const int regionIndex =
+      tracker.Intern
+      ( path, tracker.regionIndices, tracker.regions, tracker.regionUsage );
+    TrackedBlock block;
+    block.numBytes = numBytes;
+    block.type = typeIndex;
+    block.region = regionIndex;
+    if( !tracker.blocks.insert( std::make_pair(ptr,block) ).second )
+        return;
+    ++tracker.numBlocks;
+
+    tracker.liveBytes += numBytes;
+    MemoryUsage& typeUsage = tracker.typeUsage[typeIndex];
+    ++typeUsage.numAllocations;
+    typeUsage.allocatedBytes += numBytes;
+    typeUsage.liveBytes += numBytes;
+    typeUsage.peakBytes = Max( typeUsage.peakBytes, typeUsage.liveBytes );
+    // A region's peak is the largest total of live bytes which one of its
+    // allocations led to, so that the regions which drove the peak stand out
+    MemoryUsage& regionUsage = tracker.regionUsage[regionIndex];
+    ++regionUsage.numAllocations;
+    regionUsage.allocatedBytes += numBytes;
+    regionUsage.liveBytes += numBytes;
+    regionUsage.peakBytes = Max( regionUsage.peakBytes, tracker.liveBytes );
+
+    if( tracker.liveBytes > tracker.highWaterMark )
+    {
+        tracker.highWaterMark = tracker.liveBytes;
+        tracker.highWaterRegion = regionIndex;
+        const int numTypes = tracker.types.size();
+        tracker.highWaterTypeBytes.resize( numTypes );
+        for( int t=0; t<numTypes; ++t )
+            tracker.highWaterTypeBytes[t] = tracker.typeUsage[t].liveBytes;
+    }
+}
+
+void UntrackAllocation( const void* ptr )
+{
+    MemoryTracker& tracker = ::memoryTracker;
+    // Avoid locking unless a buffer was allocated while tracking
+    if( ptr == nullptr || tracker.numBlocks == 0 )
+        return;
+    std::lock_guard<std::mutex> guard( tracker.mutex );
+    auto it = tracker.blocks.find( ptr );
+    if( it == tracker.blocks.end() )
+        return;
+    const TrackedBlock& block = it->second;
+    tracker.liveBytes -= block.numBytes;
+    tracker.typeUsage[block.type].liveBytes -= block.numBytes;
+    tracker.regionUsage[block.region].liveBytes -= block.numBytes;
+    tracker.blocks.erase( it );
+    --tracker.numBlocks;
+}
+
+void WriteMemoryTracking( ostream& os, mpi::Comm comm )
+{
+    DEBUG_CSE
+    // Do not record the communication required to write the statistics
+    const bool accounting = mpi::TrafficAccounting();
+    mpi::SetTrafficAccounting( false );
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+    const int root = 0;
+
+    // Gather the (tab-separated) local statistics onto the root. The 'P' line
+    // holds the high-water mark and its region, the 'S' lines the per-type
+    // breakdown at the high-water mark, and the 'T' and 'R' lines the usage
+    // of each datatype and region.
+    ostringstream localStream;
+    {
+        MemoryTracker& tracker = ::memoryTracker;
+        std::lock_guard<std::mutex> guard( tracker.mutex );
+        const int region = tracker.highWaterRegion;
+        localStream << "P\t" << tracker.highWaterMark << '\t'
+          << tracker.liveBytes << '\t'
+          << ( region < 0 ? string() : tracker.regions[region] ) << '\n';
+        for( size_t t=0; t<tracker.highWaterTypeBytes.size(); ++t )
+            if( tracker.highWaterTypeBytes[t] > 0 )
+                localStream << "S\t" << tracker.types[t] << '\t'
+                  << tracker.highWaterTypeBytes[t] << '\n';
+        auto writeUsage =
+          [&]( char kind, const vector<string>& names,
+               const vector<MemoryUsage>& usage )
+          {
+              for( size_t k=0; k<names.size(); ++k )
+                  localStream << kind << '\t' << names[k] << '\t'
+                    << usage[k].numAllocations << '\t'
+                    << usage[k].allocatedBytes << '\t'
+                    << usage[k].liveBytes << '\t'
+                    << usage[k].peakBytes << '\n';
+          };
+        writeUsage( 'T', tracker.types, tracker.typeUsage );
+        writeUsage( 'R', tracker.regions, tracker.regionUsage );
+    }
+    const string localLines = localStream.str();
+    const int localSize = localLines.size();
+    vector<int> sizes(commSize,0), offsets;
+    mpi::Gather( &localSize, 1, sizes.data(), 1, root, comm );
+    const int totalSize = Scan( sizes, offsets );
+    vector<byte> allLines(totalSize);
+    mpi::Gather
+    ( reinterpret_cast<const byte*>(localLines.data()), localSize,
+      allLines.data(), sizes.data(), offsets.data(), root, comm );
+    mpi::SetTrafficAccounting( accounting );
+    if( commRank != root )
+        return;
+
+    // Reduce the high-water marks and, for each datatype and region, sum the
+    // allocations and take the maximum of the live and peak bytes
+    struct Totals
+    {
+        int numProcs=0;
+        MemoryUsage sum;
+        size_t maxLive=0, maxPeak=0;
+    };
+    std::map<string,Totals> typeTotals, regionTotals;
+    size_t minMark=std::numeric_limits<size_t>::max(), maxMark=0;
+    double sumMark=0;
+    int maxRank=0;
+    string maxRegion;
+    vector<std::pair<string,size_t>> maxBreakdown;
+    for( int q=0; q<commSize; ++q )
+    {
+        std::istringstream stream
+          ( string
+            (reinterpret_cast<const char*>(allLines.data())+offsets[q],
+             sizes[q]) );
+        string line;
+        while( std::getline( stream, line ) )
+        {
+            std::istringstream lineStream( line );
+            string kind, name;
+            std::getline( lineStream, kind, '\t' );
+            if( kind == "P" )
+            {
+                size_t mark, live;
+                lineStream >> mark >> live;
+                lineStream.ignore();
+                std::getline( lineStream, name );
+                minMark = Min( minMark, mark );
+                sumMark += mark;
+                if( q == 0 || mark > maxMark )
+                {
+                    maxMark = mark;
+                    maxRank = q;
+                    maxRegion = name;
+                    maxBreakdown.clear();
+                }
+                continue;
+            }
+            std::getline( lineStream, name, '\t' );
+            if( kind == "S" )
+            {
+                size_t numBytes;
+                lineStream >> numBytes;
+                if( q == maxRank )
+                    maxBreakdown.push_back( std::make_pair(name,numBytes) );
+                continue;
+            }
+            MemoryUsage usage;
+            lineStream >> usage.numAllocations >> usage.allocatedBytes
+                       >> usage.liveBytes >> usage.peakBytes;
+            Totals& total =
+              ( kind == "T" ? typeTotals[name] : regionTotals[name] );
+            ++total.numProcs;
+            total.sum.numAllocations += usage.numAllocations;
+            total.sum.allocatedBytes += usage.allocatedBytes;
+            total.maxLive = Max( total.maxLive, usage.liveBytes );
+            total.maxPeak = Max( total.maxPeak, usage.peakBytes );
+        }
+    }
+
+    os << "Tracked memory high-water mark (bytes): min " << minMark
+       << ", avg " << sumMark/commSize << ", max " << maxMark
+       << " on process " << maxRank << " in region "
+       << ( maxRegion.empty() ? string("(none)") : maxRegion ) << "\n";
+    for( const auto& entry : maxBreakdown )
+        os << "  " << entry.first << ": " << entry.second << "\n";
+
+    const int nameWidth = 40, statWidth = 14;
+    auto writeTotals =
+      [&]( const char* label, const std::map<string,Totals>& totals )
+      {
+          os << std::left << std::setw(nameWidth) << label << std::right
+             << std::setw(6) << "Procs" << std::setw(statWidth) << "allocs"
+             << std::setw(statWidth) << "bytes"
+             << std::setw(statWidth) << "live max"
+             << std::setw(statWidth) << "peak max" << "\n";
+          for( const auto& entry : totals )
+          {
+              const Totals& total = entry.second;
+              os << std::left << std::setw(nameWidth)
+                 << ( entry.first.empty() ? string("(none)") : entry.first )
+                 << std::right << std::setw(6) << total.numProcs
+                 << std::setw(statWidth) << total.sum.numAllocations
+                 << std::setw(statWidth) << total.sum.allocatedBytes
+                 << std::setw(statWidth) << total.maxLive
+                 << std::setw(statWidth) << total.maxPeak << "\n";
+          }
+      };
+    writeTotals( "Datatype", typeTotals );
+    writeTotals( "Region", regionTotals );
+    os << std::flush;
+}
+
+} // namespace El
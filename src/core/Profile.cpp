@@ -0,0 +1,405 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+#include <iomanip>
+#include <map>
+#include <set>
+
+namespace {
+
+struct ProfileNode
+{
+    const char* name;
+    int parent;
+    std::vector<int> children;
+    El::Int numCalls=0;
+    double inclusiveTime=0;
+    El::Clock::time_point start;
+
+    ProfileNode( const char* nodeName, int nodeParent )
+    : name(nodeName), parent(nodeParent)
+    { }
+};
+
+// The root of the tree (node 0) is not a region
+std::vector<ProfileNode> profileNodes( 1, ProfileNode("",-1) );
+int currentProfileNode = 0;
+
+std::string profileFilename;
+El::ProfileFormat profileFormat = El::PROFILE_TABLE;
+
+struct TraceEventRecord
+{
+    const char* name;
+    const char* category;
+    El::Clock::time_point start, end;
+    std::string args;
+};
+
+bool tracing = false;
+El::Clock::time_point traceOrigin;
+std::vector<TraceEventRecord> traceEvents;
+
+bool InParallelRegion()
+{
+#ifdef EL_HYBRID
+    return omp_in_parallel();
+#else
+    return false;
+#endif
+}
+
+std::vector<std::string> SplitPath( const std::string& path )
+{
+    std::vector<std::string> components;
+    std::size_t start = 0;
+    while( true )
+    {
+        const std::size_t end = path.find( '/', start );
+        components.push_back( path.substr( start, end-start ) );
+        if( end == std::string::npos )
+            break;
+        start = end + 1;
+    }
+    return components;
+}
+
+std::string JSONString( const std::string& s )
+{
+    std::string escaped = "\"";
+    for( const char c : s )
+    {
+        if( c == '"' || c == '\\' )
+            escaped += '\\';
+        escaped += c;
+    }
+    return escaped + "\"";
+}
+
+} // anonymous namespace
+
+namespace El {
+
+void PushProfileRegion( const char* name )
+{
+    if( InParallelRegion() )
+        return;
+    // String literals are typically shared, so compare the pointers first
+    int child = -1;
+    for( const int c : ::profileNodes[::currentProfileNode].children )
+    {
+        const char* childName = ::profileNodes[c].name;
+        if( childName == name || std::strcmp( childName, name ) == 0 )
+        {
+            child = c;
+            break;
+        }
+    }
+    if( child < 0 )
+    {
+        child = ::profileNodes.size();
+        ::profileNodes.push_back( ProfileNode(name,::currentProfileNode) );
+        ::profileNodes[::currentProfileNode].children.push_back( child );
+    }
+    ProfileNode& node = ::profileNodes[child];
+    ++node.numCalls;
+    ::currentProfileNode = child;
+    node.start = Clock::now();
+}
+
+void PopProfileRegion()
+{
+    if( InParallelRegion() )
+        return;
+    const auto now = Clock::now();
+    ProfileNode& node = ::profileNodes[::currentProfileNode];
+    // Popping the root would corrupt the next push, so always check
+    if( node.parent < 0 )
+        LogicError("Popped a profile region which was not pushed");
+    node.inclusiveTime +=
+      duration_cast<duration<double>>(now-node.start).count();
+    if( ::tracing )
+        TraceEvent( node.name, "region", node.start, now );
+    ::currentProfileNode = node.parent;
+}
+
+string ProfileRegionPath()
+{
+    string path;
+    for( int k=::currentProfileNode; k>0; k=::profileNodes[k].parent )
+        path = ( path.empty() ? string(::profileNodes[k].name)
+                              : ::profileNodes[k].name+("/"+path) );
+    return path;
+}
+
+void ClearProfile()
+{
+    if( ::currentProfileNode != 0 )
+        LogicError("Cannot clear the profile within a region");
+    ::profileNodes.erase( ::profileNodes.begin()+1, ::profileNodes.end() );
+    ::profileNodes[0].children.clear();
+}
+
+void WriteProfile( ostream& os, ProfileFormat format, mpi::Comm comm )
+{
+    DEBUG_CSE
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+    const int numNodes = ::profileNodes.size();
+
+    // Form the local paths and exclusive times
+    vector<string> paths( numNodes );
+    vector<double> exclusiveTimes( numNodes );
+    for( int k=1; k<numNodes; ++k )
+    {
+        const ProfileNode& node = ::profileNodes[k];
+        const int parent = node.parent;
+        paths[k] = ( parent == 0 ? string(node.name)
+                                 : paths[parent]+"/"+node.name );
+        exclusiveTimes[k] = node.inclusiveTime;
+        if( parent != 0 )
+            exclusiveTimes[parent] -= node.inclusiveTime;
+    }
+
+    // Form the union of the paths of every process, sorted so that each
+    // region directly precedes the regions nested within it
+    string localPaths;
+    for( int k=1; k<numNodes; ++k )
+        localPaths += paths[k] + '\n';
+    const int localSize = localPaths.size();
+    vector<int> sizes(commSize), offsets;
+    mpi::AllGather( &localSize, 1, sizes.data(), 1, comm );
+    const int totalSize = Scan( sizes, offsets );
+    vector<byte> allPaths(totalSize);
+    mpi::AllGather
+    ( reinterpret_cast<const byte*>(localPaths.data()), localSize,
+      allPaths.data(), sizes.data(), offsets.data(), comm );
+    std::set<vector<string>> pathSet;
+    {
+        std::istringstream stream
+          ( string(reinterpret_cast<const char*>(allPaths.data()),totalSize) );
+        string path;
+        while( std::getline( stream, path ) )
+            pathSet.insert( SplitPath(path) );
+    }
+    std::map<vector<string>,int> localNodes;
+    for( int k=1; k<numNodes; ++k )
+        localNodes[SplitPath(paths[k])] = k;
+
+    // Reduce the statistics of each region over the processes which entered it
+    const int numRegions = pathSet.size();
+    const double infinity = std::numeric_limits<double>::infinity();
+    vector<double> minStats(3*numRegions,infinity), maxStats(3*numRegions,0),
+                   sumStats(4*numRegions,0);
+    int region = 0;
+    for( const auto& components : pathSet )
+    {
+        auto it = localNodes.find( components );
+        if( it != localNodes.end() )
+        {
+            const ProfileNode& node = ::profileNodes[it->second];
+            const double stats[3] =
+              { double(node.numCalls), node.inclusiveTime,
+                exclusiveTimes[it->second] };
+            for( int s=0; s<3; ++s )
+            {
+                minStats[3*region+s] = stats[s];
+                maxStats[3*region+s] = stats[s];
+                sumStats[4*region+s] = stats[s];
+            }
+            sumStats[4*region+3] = 1;
+        }
+        ++region;
+    }
+    const int root = 0;
+    mpi::Reduce( minStats.data(), 3*numRegions, mpi::MIN, root, comm );
+    mpi::Reduce( maxStats.data(), 3*numRegions, mpi::MAX, root, comm );
+    mpi::Reduce( sumStats.data(), 4*numRegions, mpi::SUM, root, comm );
+    if( commRank != root )
+        return;
+
+    const char* statNames[3] = { "calls", "inclusive", "exclusive" };
+    if( format == PROFILE_JSON )
+    {
+        os << "{\n  \"numProcesses\": " << commSize << ",\n"
+           << "  \"regions\": [";
+        region = 0;
+        for( const auto& components : pathSet )
+        {
+            string path = components[0];
+            for( Int c=1; c<Int(components.size()); ++c )
+                path += "/" + components[c];
+            const double numProcs = sumStats[4*region+3];
+            os << ( region == 0 ? "\n" : ",\n" )
+               << "    {\"path\": " << JSONString(path)
+               << ", \"name\": " << JSONString(components.back())
+               << ", \"depth\": " << components.size()-1
+               << ", \"processes\": " << numProcs;
+            for( int s=0; s<3; ++s )
+                os << ", \"" << statNames[s] << "\": {"
+                   << "\"min\": " << minStats[3*region+s]
+                   << ", \"avg\": " << sumStats[4*region+s]/numProcs
+                   << ", \"max\": " << maxStats[3*region+s] << "}";
+            os << "}";
+            ++region;
+        }
+        os << "\n  ]\n}" << endl;
+    }
+    else
+    {
+        const int nameWidth = 40, statWidth = 11;
+        os << std::left << std::setw(nameWidth) << "Region" << std::right
+           << std::setw(6) << "Procs";
+        for( int s=0; s<3; ++s )
+            for( const char* suffix : { " min", " avg", " max" } )
+                os << std::setw(statWidth) << (string(statNames[s])+suffix);
+        os << "\n";
+        region = 0;
+        for( const auto& components : pathSet )
+        {
+            const string name =
+              string(2*(components.size()-1),' ') + components.back();
+            const double numProcs = sumStats[4*region+3];
+            os << std::left << std::setw(nameWidth) << name << std::right
+               << std::setw(6) << numProcs;
+            for( int s=0; s<3; ++s )
+                os << std::setw(statWidth) << minStats[3*region+s]
+                   << std::setw(statWidth) << sumStats[4*region+s]/numProcs
+                   << std::setw(statWidth) << maxStats[3*region+s];
+            os << "\n";
+            ++region;
+        }
+        os << std::flush;
+    }
+}
+
+void SetProfileOutput( const string& filename, ProfileFormat format )
+{
+    ::profileFilename = filename;
+    ::profileFormat = format;
+}
+
+void FinalizeProfile()
+{
+    DEBUG_CSE
+    if( ::profileFilename.empty() )
+        WriteProfile( cout, ::profileFormat );
+    else
+    {
+        std::ofstream file;
+        if( mpi::Rank() == 0 )
+            file.open( ::profileFilename.c_str() );
+        WriteProfile( file, ::profileFormat );
+    }
+    ::currentProfileNode = 0;
+    ClearProfile();
+}
+
+void StartTracing( mpi::Comm comm )
+{
+    DEBUG_CSE
+    ::tracing = false;
+    mpi::Barrier( comm );
+    ::traceOrigin = Clock::now();
+    ::tracing = true;
+}
+
+void StopTracing() { ::tracing = false; }
+
+bool Tracing() { return ::tracing; }
+
+void TraceEvent
+( const char* name, const char* category,
+  Clock::time_point start, Clock::time_point end, const string& args )
+{
+    if( !::tracing || InParallelRegion() )
+        return;
+    TraceEventRecord event;
+    event.name = name;
+    event.category = category;
+    event.start = start;
+    event.end = end;
+    event.args = args;
+    ::traceEvents.push_back( event );
+}
+
+void ClearTrace() { ::traceEvents.clear(); }
+
+void WriteTrace( const string& basename, mpi::Comm comm )
+{
+    DEBUG_CSE
+    const string filename =
+      basename + "." + std::to_string(mpi::Rank(comm)) + ".trace";
+    std::ofstream file( filename.c_str() );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+
+    // Each line holds the tab-separated name, category, start (relative to the
+    // trace origin), duration, and arguments of an event, with the times in
+    // microseconds
+    file.precision( 15 );
+    for( const auto& event : ::traceEvents )
+    {
+        const double start =
+          duration_cast<duration<double,std::micro>>
+          (event.start-::traceOrigin).count();
+        const double length =
+          duration_cast<duration<double,std::micro>>
+          (event.end-event.start).count();
+        file << event.name << '\t' << event.category << '\t' << start << '\t'
+             << length << '\t' << event.args << '\n';
+    }
+}
+
+void MergeTraces
+( const string& basename, int numProcesses, const string& filename )
+{
+    DEBUG_CSE
+    std::ofstream file( filename.c_str() );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+
+    file << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [";
+    bool first = true;
+    for( int rank=0; rank<numProcesses; ++rank )
+    {
+        const string rankFilename =
+          basename + "." + std::to_string(rank) + ".trace";
+        std::ifstream rankFile( rankFilename.c_str() );
+        if( !rankFile.is_open() )
+            RuntimeError("Could not open ",rankFilename);
+
+        file << ( first ? "\n" : ",\n" )
+             << "  {\"name\": \"process_name\", \"ph\": \"M\", \"pid\": "
+             << rank << ", \"args\": {\"name\": \"rank " << rank << "\"}}";
+        first = false;
+
+        string line;
+        while( std::getline( rankFile, line ) )
+        {
+            std::istringstream lineStream( line );
+            string name, category, start, length, args;
+            std::getline( lineStream, name, '\t' );
+            std::getline( lineStream, category, '\t' );
+            std::getline( lineStream, start, '\t' );
+            std::getline( lineStream, length, '\t' );
+            std::getline( lineStream, args );
+            file << ",\n  {\"name\": " << JSONString(name)
+                 << ", \"cat\": " << JSONString(category)
+                 << ", \"ph\": \"X\", \"ts\": " << start
+                 << ", \"dur\": " << length
+                 << ", \"pid\": " << rank << ", \"tid\": 0"
+                 << ", \"args\": {" << args << "}}";
+        }
+    }
+    file << "\n]}" << endl;
+}
+
+} // namespace El
@@ -0,0 +1,247 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+#include <map>
+
+namespace {
+using namespace El;
+
+bool workspaceCacheEnabled = false;
+size_t workspaceCacheLimit = size_t(1) << 27;
+size_t workspaceCacheBytes = 0;
+
+// The interface of the per-datatype caches used for trimming and releasing
+// the cache as a whole
+class CacheBase
+{
+public:
+    virtual ~CacheBase() { }
+    virtual size_t LargestEntry() const = 0;
+    virtual void FreeLargestEntry() = 0;
+    virtual void Release( const Grid* grid ) = 0;
+};
+
+vector<CacheBase*>& Caches()
+{
+    static vector<CacheBase*> caches;
+    return caches;
+}
+
+struct Key
+{
+    const Grid* grid;
+    Dist colDist, rowDist;
+
+    bool operator<( const Key& key ) const
+    {
+        if( grid != key.grid )
+            return grid < key.grid;
+        if( colDist != key.colDist )
+            return colDist < key.colDist;
+        return rowDist < key.rowDist;
+    }
+};
+
+template<typename T>
+class Cache : public CacheBase
+{
+public:
+    static Cache<T>& Get()
+    {
+        static Cache<T> cache;
+        return cache;
+    }
+
+    void Borrow( const Key& key, size_t minSize, Memory<T>& memory )
+    {
+        auto it = entries_.find( key );
+        if( it == entries_.end() || it->second.empty() )
+            return;
+        // Use the smallest buffer which fits (or, if none do, the largest,
+        // which is then replaced) so that small temporaries do not pin the
+        // large buffers
+        auto& list = it->second;
+        auto best = list.begin();
+        for( auto entry=list.begin(); entry!=list.end(); ++entry )
+        {
+            const bool fits = ( entry->Size() >= minSize );
+            const bool bestFits = ( best->Size() >= minSize );
+            if( fits ? (!bestFits || entry->Size() < best->Size())
+                     : (!bestFits && entry->Size() > best->Size()) )
+                best = entry;
+        }
+        workspaceCacheBytes -= best->Size()*sizeof(T);
+        memory.ShallowSwap( *best );
+        list.erase( best );
+    }
+
+    void Return( const Key& key, Memory<T>& memory )
+    {
+        const size_t numBytes = memory.Size()*sizeof(T);
+        if( numBytes == 0 )
+            return;
+        if( numBytes > workspaceCacheLimit )
+        {
+            memory.Empty();
+            return;
+        }
+        entries_[key].emplace_back( std::move(memory) );
+        workspaceCacheBytes += numBytes;
+        if( workspaceCacheBytes > workspaceCacheLimit )
+            TrimWorkspaceCache( workspaceCacheLimit );
+    }
+
+    size_t LargestEntry() const override
+    {
+        size_t largest = 0;
+        for( const auto& pair : entries_ )
+            for( const auto& memory : pair.second )
+                largest = Max( largest, memory.Size()*sizeof(T) );
+        return largest;
+    }
+
+    void FreeLargestEntry() override
+    {
+        const size_t largest = LargestEntry();
+        for( auto& pair : entries_ )
+        {
+            auto& list = pair.second;
+            for( auto entry=list.begin(); entry!=list.end(); ++entry )
+            {
+                if( entry->Size()*sizeof(T) == largest )
+                {
+                    workspaceCacheBytes -= largest;
+                    list.erase( entry );
+                    return;
+                }
+            }
+        }
+    }
+
+    void Release( const Grid* grid ) override
+    {
+        for( auto it=entries_.begin(); it!=entries_.end(); )
+        {
+            if( grid == nullptr || it->first.grid == grid )
+            {
+                for( const auto& memory : it->second )
+                    workspaceCacheBytes -= memory.Size()*sizeof(T);
+                it = entries_.erase( it );
+            }
+            else
+                ++it;
+        }
+    }
+
+private:
+    std::map<Key,vector<Memory<T>>> entries_;
+
+    Cache() { Caches().push_back( this ); }
+};
+
+} // anonymous namespace
+
+namespace El {
+
+void EnableWorkspaceCache()
+{ ::workspaceCacheEnabled = true; }
+
+void DisableWorkspaceCache()
+{
+    ::workspaceCacheEnabled = false;
+    ReleaseWorkspaceCache();
+}
+
+bool WorkspaceCacheEnabled()
+{ return ::workspaceCacheEnabled; }
+
+void SetWorkspaceCacheLimit( size_t maxBytes )
+{
+    ::workspaceCacheLimit = maxBytes;
+    TrimWorkspaceCache( maxBytes );
+}
+
+size_t WorkspaceCacheLimit()
+{ return ::workspaceCacheLimit; }
+
+size_t WorkspaceCacheBytes()
+{ return ::workspaceCacheBytes; }
+
+void TrimWorkspaceCache( size_t maxBytes )
+{
+    DEBUG_CSE
+    while( ::workspaceCacheBytes > maxBytes )
+    {
+        CacheBase* largestCache = nullptr;
+        size_t largest = 0;
+        for( CacheBase* cache : Caches() )
+        {
+            const size_t cacheLargest = cache->LargestEntry();
+            if( cacheLargest > largest )
+            {
+                largest = cacheLargest;
+                largestCache = cache;
+            }
+        }
+        if( largestCache == nullptr )
+            break;
+        largestCache->FreeLargestEntry();
+    }
+}
+
+void ReleaseWorkspaceCache()
+{
+    DEBUG_CSE
+    for( CacheBase* cache : Caches() )
+        cache->Release( nullptr );
+}
+
+void ReleaseWorkspaceCache( const Grid& grid )
+{
+    DEBUG_CSE
+    for( CacheBase* cache : Caches() )
+        cache->Release( &grid );
+}
+
+namespace workspace {
+
+template<typename T>
+void Borrow
+( const Grid& grid, Dist colDist, Dist rowDist, size_t minSize,
+  Memory<T>& memory )
+{
+    DEBUG_CSE
+    Cache<T>::Get().Borrow( Key{&grid,colDist,rowDist}, minSize, memory );
+}
+
+template<typename T>
+void Return
+( const Grid& grid, Dist colDist, Dist rowDist, Memory<T>& memory )
+{
+    DEBUG_CSE
+    Cache<T>::Get().Return( Key{&grid,colDist,rowDist}, memory );
+}
+
+#define PROTO(T) \
+  template void Borrow \
+  ( const Grid& grid, Dist colDist, Dist rowDist, size_t minSize, \
+    Memory<T>& memory ); \
+  template void Return \
+  ( const Grid& grid, Dist colDist, Dist rowDist, Memory<T>& memory );
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace workspace
+} // namespace El
@@ -19,6 +19,12 @@ bool elemInitializedMpi = false;
 
 El::Args* args = 0;
 
+// The minimum number of entries each thread of a threaded local loop should
+// be responsible for
+El::Int parallelGrainSize = 16384;
+
+bool reproducibleSums = false;
+
 }
 
 namespace El {
@@ -139,6 +145,9 @@ void Initialize( int& argc, char**& argv )
 
     ::args = new Args( argc, argv );
 
+    // Select the allocator behind Memory<G> before any buffers are formed
+    SetAllocatorCtrlFromArgs( argc, argv );
+
     ::numElemInits = 1;
     if( !mpi::Initialized() )
     {
@@ -182,6 +191,23 @@ void Initialize( int& argc, char**& argv )
     EmptyBlocksizeStack();
     PushBlocksizeStack( 128 );
 
+    // Load the tuned blocksizes if the root process can read the tuning file
+    // (which it then broadcasts, so that every process agrees)
+    string tuningFile;
+    int loadTuning = 0;
+    if( mpi::Rank(mpi::COMM_WORLD) == 0 )
+    {
+        const char* tuningEnv = std::getenv( "EL_TUNING_FILE" );
+        if( tuningEnv != nullptr && std::ifstream(tuningEnv).good() )
+        {
+            tuningFile = tuningEnv;
+            loadTuning = 1;
+        }
+    }
+    mpi::Broadcast( loadTuning, 0, mpi::COMM_WORLD );
+    if( loadTuning )
+        LoadTunedBlocksizes( tuningFile );
+
     // Build the default grid
     Grid::InitializeDefault();
 
@@ -213,6 +239,16 @@ void Finalize()
         delete ::args;
         ::args = 0;
 
+#ifdef EL_PROFILE
+        if( !mpi::Finalized() )
+            FinalizeProfile();
+#endif
+        if( MemoryTracking() && !mpi::Finalized() )
+            WriteMemoryTracking( cout );
+        if( mpi::TrafficAccounting() && !mpi::Finalized() )
+            mpi::WriteTraffic( cout );
+
+        ReleaseWorkspaceCache();
         Grid::FinalizeDefault();
        
         // Destroy the types and ops
@@ -226,12 +262,19 @@ void Finalize()
 
 
         EmptyBlocksizeStack();
+        ClearTunedBlocksizes();
 
 #ifdef EL_HAVE_QD
         FinalizeQD();
 #endif
 
         FinalizeRandom();
+
+        // Release the cached blocks and fall back to the system allocator
+        // for any matrices which outlive Elemental
+        AllocatorCtrl allocCtrl = GetAllocatorCtrl();
+        allocCtrl.type = SYSTEM_ALLOCATOR;
+        SetAllocatorCtrl( allocCtrl );
     }
 
     DEBUG_ONLY( CloseLog() )
@@ -241,6 +284,34 @@ void Finalize()
 #endif
 }
 
+Int ParallelGrainSize() { return ::parallelGrainSize; }
+
+void SetParallelGrainSize( Int grainSize )
+{
+    if( grainSize < 1 )
+        LogicError("The parallel grain size must be positive");
+    ::parallelGrainSize = grainSize;
+}
+
+Int NumParallelChunks( Int work )
+{
+#ifdef EL_HYBRID
+    if( omp_in_parallel() )
+        return 1;
+    const Int maxChunks = work / ::parallelGrainSize;
+    if( maxChunks < 2 )
+        return 1;
+    return Min( maxChunks, Int(omp_get_max_threads()) );
+#else
+    return 1;
+#endif
+}
+
+bool ReproducibleSums() { return ::reproducibleSums; }
+
+void SetReproducibleSums( bool reproducible )
+{ ::reproducibleSums = reproducible; }
+
 Args& GetArgs()
 { 
     if( args == 0 )
@@ -130,5 +130,18 @@ void Axpy
         dcomplex* y, BlasInt incy )
 { EL_BLAS(zaxpy)( &n, &alpha, x, &incx, y, &incy ); }
 
+#ifdef EL_HAVE_QD
+void Axpy
+( BlasInt n,
+  const DoubleDouble& alpha,
+  const DoubleDouble* x, BlasInt incx, 
+        DoubleDouble* y, BlasInt incy )
+{
+    if( incx == 1 && incy == 1 && qd::Axpy( n, alpha, x, y ) )
+        return;
+    Axpy<DoubleDouble>( n, alpha, x, incx, y, incy );
+}
+#endif
+
 } // namespace blas
 } // namespace El
@@ -126,6 +126,18 @@ T Dotu
     }
     return alpha;
 }
+#ifdef EL_HAVE_QD
+DoubleDouble Dot
+( BlasInt n,
+  const DoubleDouble* x, BlasInt incx,
+  const DoubleDouble* y, BlasInt incy )
+{
+    DoubleDouble alpha;
+    if( incx == 1 && incy == 1 && qd::Dot( n, x, y, alpha ) )
+        return alpha;
+    return Dot<DoubleDouble>( n, x, incx, y, incy );
+}
+#endif
 template Int Dotu
 ( BlasInt n,
   const Int* x, BlasInt incx,
@@ -191,5 +203,18 @@ double Dotu
   const double* y, BlasInt incy )
 { return EL_BLAS(ddot)( &n, x, &incx, y, &incy ); }
 
+#ifdef EL_HAVE_QD
+DoubleDouble Dotu
+( BlasInt n,
+  const DoubleDouble* x, BlasInt incx,
+  const DoubleDouble* y, BlasInt incy )
+{
+    DoubleDouble alpha;
+    if( incx == 1 && incy == 1 && qd::Dot( n, x, y, alpha ) )
+        return alpha;
+    return Dotu<DoubleDouble>( n, x, incx, y, incy );
+}
+#endif
+
 } // namespace blas
 } // namespace El
@@ -44,222 +44,301 @@ void EL_BLAS(zgemm)
 namespace El {
 namespace blas {
 
+// A packed, cache-blocked Gemm for the scalar types which are not supported
+// by BLAS (in the spirit of Goto and van de Geijn's "Anatomy of
+// high-performance matrix multiplication"). Panels of op(B) of size KC x NC
+// and of op(A) of size MC x KC are packed (resolving any transposition or
+// conjugation) into micro-panels of width NR and height MR, and each MR x NR
+// tile of C is then updated by a micro-kernel which streams through one
+// micro-panel of each. The MC x NC macro-tiles of C are distributed over the
+// OpenMP threads.
+namespace gemm {
+
 template<typename T>
-void Gemm
-( char transA, char transB,
-  BlasInt m, BlasInt n, BlasInt k,
-  const T& alpha,
-  const T* A, BlasInt ALDim,
-  const T* B, BlasInt BLDim,
-  const T& beta,
-        T* C, BlasInt CLDim )
+struct Blocksizes
 {
-    // NOTE: Temporaries are avoided since constructing a BigInt/BigFloat
-    //       involves a memory allocation
-    if( m > 0 && n > 0 && k == 0 && beta == T(0) )
+    static const BlasInt MR=4, NR=4, MC=64, KC=128, NC=512;
+};
+#ifdef EL_HAVE_QD
+// The height of the micro-panels must match qd::GemmMicroKernel
+template<>
+struct Blocksizes<DoubleDouble>
+{
+    static const BlasInt MR=8, NR=4, MC=64, KC=128, NC=512;
+};
+#endif
+
+// Return op(X)(i,j) for op(X) = X, X^T, or X^H
+template<typename T>
+inline void OpEntry
+( char trans, const T* X, BlasInt XLDim, BlasInt i, BlasInt j, T& alpha )
+{
+    const char transUpper = std::toupper(trans);
+    if( transUpper == 'N' )
+        alpha = X[i+j*XLDim];
+    else if( transUpper == 'C' )
+        Conj( X[j+i*XLDim], alpha );
+    else
+        alpha = X[j+i*XLDim];
+}
+
+// Return a pointer to the entry of X which holds op(X)(i,j)
+template<typename T>
+inline const T* OpPointer
+( char trans, const T* X, BlasInt XLDim, BlasInt i, BlasInt j )
+{ return std::toupper(trans) == 'N' ? &X[i+j*XLDim] : &X[j+i*XLDim]; }
+
+// Pack the mc x kc matrix op(A) into micro-panels of height MR, each of
+// which is stored row-major (so that the micro-kernel reads it contiguously)
+// and padded with zeros
+template<typename T>
+void PackA
+( char trans, BlasInt mc, BlasInt kc,
+  const T* A, BlasInt ALDim, T* APack )
+{
+    const BlasInt MR = Blocksizes<T>::MR;
+    for( BlasInt ir=0; ir<mc; ir+=MR )
     {
-        for( BlasInt j=0; j<n; ++j )
-            for( BlasInt i=0; i<m; ++i )
-                C[i+j*CLDim] = 0;
-        return;
+        const BlasInt mr = Min(MR,mc-ir);
+        T* APanel = &APack[ir*kc];
+        for( BlasInt l=0; l<kc; ++l )
+        {
+            for( BlasInt i=0; i<mr; ++i )
+                OpEntry( trans, A, ALDim, ir+i, l, APanel[i+l*MR] );
+            for( BlasInt i=mr; i<MR; ++i )
+                APanel[i+l*MR] = 0;
+        }
     }
+}
 
-    // Scale C
-    if( beta == T(0) )
+// Pack the kc x nc matrix op(B) into micro-panels of width NR, each of
+// which is stored column-major and padded with zeros
+template<typename T>
+void PackB
+( char trans, BlasInt kc, BlasInt nc,
+  const T* B, BlasInt BLDim, T* BPack )
+{
+    const BlasInt NR = Blocksizes<T>::NR;
+    for( BlasInt jr=0; jr<nc; jr+=NR )
     {
-        for( BlasInt j=0; j<n; ++j )
-            for( BlasInt i=0; i<m; ++i )
-                C[i+j*CLDim] = 0;
+        const BlasInt nr = Min(NR,nc-jr);
+        T* BPanel = &BPack[jr*kc];
+        for( BlasInt l=0; l<kc; ++l )
+        {
+            for( BlasInt j=0; j<nr; ++j )
+                OpEntry( trans, B, BLDim, l, jr+j, BPanel[j+l*NR] );
+            for( BlasInt j=nr; j<NR; ++j )
+                BPanel[j+l*NR] = 0;
+        }
     }
-    else if( beta != T(1) )
+}
+
+// C(0:mr,0:nr) += alpha APanel BPanel, where the accumulators of packed
+// types are kept in a local array (so that they may live in registers)
+template<typename T,typename=EnableIf<IsPacked<T>>>
+void MicroKernel
+( BlasInt mr, BlasInt nr, BlasInt kc,
+  const T& alpha, const T* APanel, const T* BPanel,
+  T* C, BlasInt CLDim, T* )
+{
+    const BlasInt MR = Blocksizes<T>::MR;
+    const BlasInt NR = Blocksizes<T>::NR;
+    T acc[MR*NR];
+    for( BlasInt t=0; t<MR*NR; ++t )
+        acc[t] = 0;
+    for( BlasInt l=0; l<kc; ++l )
     {
-        for( BlasInt j=0; j<n; ++j )
-            for( BlasInt i=0; i<m; ++i )
-                C[i+j*CLDim] *= beta;
+        const T* a = &APanel[l*MR];
+        const T* b = &BPanel[l*NR];
+        for( BlasInt j=0; j<NR; ++j )
+            for( BlasInt i=0; i<MR; ++i )
+                acc[i+j*MR] += a[i]*b[j];
     }
+    for( BlasInt j=0; j<nr; ++j )
+        for( BlasInt i=0; i<mr; ++i )
+            C[i+j*CLDim] += alpha*acc[i+j*MR];
+}
 
-    // Naive implementation
-    T gamma, delta;
-    if( std::toupper(transA) == 'N' && std::toupper(transB) == 'N' )
+// NOTE: Temporaries are avoided since constructing a BigInt/BigFloat
+//       involves a memory allocation; 'work' must hold MR*NR+1 entries
+template<typename T,typename=DisableIf<IsPacked<T>>,typename=void>
+void MicroKernel
+( BlasInt mr, BlasInt nr, BlasInt kc,
+  const T& alpha, const T* APanel, const T* BPanel,
+  T* C, BlasInt CLDim, T* work )
+{
+    const BlasInt MR = Blocksizes<T>::MR;
+    const BlasInt NR = Blocksizes<T>::NR;
+    T* acc = work;
+    T& delta = work[MR*NR];
+    for( BlasInt t=0; t<MR*NR; ++t )
+        acc[t] = 0;
+    for( BlasInt l=0; l<kc; ++l )
     {
-        // C := alpha A B + C
-        for( BlasInt j=0; j<n; ++j )
+        const T* a = &APanel[l*MR];
+        const T* b = &BPanel[l*NR];
+        for( BlasInt j=0; j<NR; ++j )
         {
-            for( BlasInt l=0; l<k; ++l )
+            for( BlasInt i=0; i<MR; ++i )
             {
-                gamma = alpha;
-                gamma *= B[l+j*BLDim];
-                for( BlasInt i=0; i<m; ++i )
-                {
-                    delta = A[i+l*ALDim];
-                    delta *= gamma;
-                    C[i+j*CLDim] += delta;
-                }
+                delta = a[i];
+                delta *= b[j];
+                acc[i+j*MR] += delta;
             }
         }
     }
-    else if( std::toupper(transA) == 'N' )
+    for( BlasInt j=0; j<nr; ++j )
     {
-        if( std::toupper(transB) == 'T' )
+        for( BlasInt i=0; i<mr; ++i )
         {
-            // C := alpha A B^T + C
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt l=0; l<k; ++l )
-                {
-                    gamma = alpha;
-                    gamma *= B[j+l*BLDim];
-                    for( BlasInt i=0; i<m; ++i )
-                    {
-                        delta = A[i+l*ALDim];
-                        delta *= gamma;
-                        C[i+j*CLDim] += delta;
-                    }
-                }
-            }
-        }
-        else
-        {
-            // C := alpha A B^H + C
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt l=0; l<k; ++l )
-                {
-                    Conj( B[j+l*BLDim], gamma );
-                    gamma *= alpha;
-                    for( BlasInt i=0; i<m; ++i )
-                    {
-                        delta = A[i+l*ALDim];
-                        delta *= gamma;
-                        C[i+j*CLDim] += delta;
-                    }
-                }
-            }
+            acc[i+j*MR] *= alpha;
+            C[i+j*CLDim] += acc[i+j*MR];
         }
     }
-    else if( std::toupper(transB) == 'N' )
+}
+
+#ifdef EL_HAVE_QD
+// Full tiles are handed directly to the SIMD micro-kernel, whereas partial
+// tiles are first accumulated into a zeroed full-sized tile
+inline void MicroKernel
+( BlasInt mr, BlasInt nr, BlasInt kc,
+  const DoubleDouble& alpha,
+  const DoubleDouble* APanel, const DoubleDouble* BPanel,
+  DoubleDouble* C, BlasInt CLDim, DoubleDouble* work )
+{
+    const BlasInt MR = Blocksizes<DoubleDouble>::MR;
+    const BlasInt NR = Blocksizes<DoubleDouble>::NR;
+    if( mr == MR && nr == NR &&
+        qd::GemmMicroKernel( kc, alpha, APanel, BPanel, C, CLDim ) )
+        return;
+    if( qd::GetSIMD() != qd::SIMD_NONE )
     {
-        if( std::toupper(transA) == 'T' )
-        {
-            // C := alpha A^T B + C
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt i=0; i<m; ++i )
-                {
-                    gamma = 0;
-                    for( BlasInt l=0; l<k; ++l )
-                    {
-                        delta = A[l+i*ALDim];
-                        delta *= B[l+j*BLDim];
-                        gamma += delta;
-                    }
-                    gamma *= alpha;
-                    C[i+j*CLDim] += gamma;
-                }
-            }
-        }
-        else
-        {
-            // C := alpha A^H B + C
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt i=0; i<m; ++i )
-                {
-                    gamma = 0;
-                    for( BlasInt l=0; l<k; ++l )
-                    {
-                        Conj( A[l+i*ALDim], delta );
-                        delta *= B[l+j*BLDim];
-                        gamma += delta;
-                    }
-                    gamma *= alpha;
-                    C[i+j*CLDim] += gamma;
-                }
-            }
-        }
+        DoubleDouble tile[MR*NR];
+        for( BlasInt t=0; t<MR*NR; ++t )
+            tile[t] = 0;
+        qd::GemmMicroKernel( kc, alpha, APanel, BPanel, tile, MR );
+        for( BlasInt j=0; j<nr; ++j )
+            for( BlasInt i=0; i<mr; ++i )
+                C[i+j*CLDim] += tile[i+j*MR];
+        return;
     }
-    else
+    MicroKernel<DoubleDouble>
+    ( mr, nr, kc, alpha, APanel, BPanel, C, CLDim, work );
+}
+#endif
+
+// C := alpha op(A) op(B) + C
+template<typename T>
+void Blocked
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const T& alpha,
+  const T* A, BlasInt ALDim,
+  const T* B, BlasInt BLDim,
+        T* C, BlasInt CLDim )
+{
+    const BlasInt MR = Blocksizes<T>::MR;
+    const BlasInt NR = Blocksizes<T>::NR;
+    const BlasInt MC = Blocksizes<T>::MC;
+    const BlasInt KC = Blocksizes<T>::KC;
+    const BlasInt NC = Blocksizes<T>::NC;
+
+    const BlasInt kcMax = Min(KC,k);
+    const BlasInt mcMax = ((Min(MC,m)+MR-1)/MR)*MR;
+    const BlasInt ncMax = ((Min(NC,n)+NR-1)/NR)*NR;
+
+    // Each thread packs op(A) into, and accumulates within, its own slice of
+    // the workspace so that no allocations occur within the block loops
+    int numThreads = 1;
+#ifdef EL_HYBRID
+    numThreads = omp_get_max_threads();
+#endif
+    const BlasInt APackSize = mcMax*kcMax;
+    const BlasInt workSize = MR*NR+1;
+    vector<T> BPack( ncMax*kcMax ), APack( numThreads*APackSize ),
+              work( numThreads*workSize );
+    for( BlasInt jc=0; jc<n; jc+=NC )
     {
-        if( std::toupper(transA) == 'T' && std::toupper(transB) == 'T' )
-        {
-            // C := alpha A^T B^T + C
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt i=0; i<m; ++i )
-                {
-                    gamma = 0;
-                    for( BlasInt l=0; l<k; ++l )
-                    {
-                        delta = A[l+i*ALDim];
-                        delta *= B[j+l*BLDim];
-                        gamma += delta;
-                    }
-                    gamma *= alpha;
-                    C[i+j*CLDim] += gamma;
-                }
-            }
-        }
-        else if( std::toupper(transA) == 'T' )
-        {
-            // C := alpha A^T B^H + C
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt i=0; i<m; ++i )
-                {
-                    gamma = 0;
-                    for( BlasInt l=0; l<k; ++l )
-                    {
-                        Conj( B[j+l*BLDim], delta );
-                        delta *= A[l+i*ALDim];
-                        gamma += delta;
-                    }
-                    gamma *= alpha;
-                    C[i+j*CLDim] += gamma;
-                }
-            }
-        }
-        else if( std::toupper(transB) == 'T' )
+        const BlasInt nc = Min(NC,n-jc);
+        for( BlasInt pc=0; pc<k; pc+=KC )
         {
-            // C := alpha A^H B^T + C
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt i=0; i<m; ++i )
-                {
-                    gamma = 0;
-                    for( BlasInt l=0; l<k; ++l )
-                    {
-                        Conj( A[l+i*ALDim], delta );
-                        delta *= B[j+l*BLDim];
-                        gamma += delta;
-                    }
-                    gamma *= alpha;
-                    C[i+j*CLDim] += gamma;
-                }
-            }
-        }
-        else
-        {
-            // C := alpha A^H B^H + C
-            T phi;
-            for( BlasInt j=0; j<n; ++j )
+            const BlasInt kc = Min(KC,k-pc);
+            PackB
+            ( transB, kc, nc,
+              OpPointer(transB,B,BLDim,pc,jc), BLDim, BPack.data() );
+
+#ifdef EL_HYBRID
+            #pragma omp parallel
+#endif
             {
-                for( BlasInt i=0; i<m; ++i )
+                int thread = 0;
+#ifdef EL_HYBRID
+                thread = omp_get_thread_num();
+#endif
+                T* APackThread = &APack[thread*APackSize];
+                T* workThread = &work[thread*workSize];
+#ifdef EL_HYBRID
+                #pragma omp for schedule(static)
+#endif
+                for( BlasInt ic=0; ic<m; ic+=MC )
                 {
-                    gamma = 0;
-                    for( BlasInt l=0; l<k; ++l )
+                    const BlasInt mc = Min(MC,m-ic);
+                    PackA
+                    ( transA, mc, kc,
+                      OpPointer(transA,A,ALDim,ic,pc), ALDim, APackThread );
+                    for( BlasInt jr=0; jr<nc; jr+=NR )
                     {
-                        Conj( A[l+i*ALDim], delta );       
-                        Conj( B[j+l*BLDim], phi );
-                        delta *= phi;
-                        gamma += delta;
+                        const BlasInt nr = Min(NR,nc-jr);
+                        for( BlasInt ir=0; ir<mc; ir+=MR )
+                        {
+                            const BlasInt mr = Min(MR,mc-ir);
+                            MicroKernel
+                            ( mr, nr, kc, alpha,
+                              &APackThread[ir*kc], &BPack[jr*kc],
+                              &C[(ic+ir)+(jc+jr)*CLDim], CLDim,
+                              workThread );
+                        }
                     }
-                    gamma *= alpha;
-                    C[i+j*CLDim] += gamma;
                 }
             }
         }
     }
 }
+
+} // namespace gemm
+
+template<typename T>
+void Gemm
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const T& alpha,
+  const T* A, BlasInt ALDim,
+  const T* B, BlasInt BLDim,
+  const T& beta,
+        T* C, BlasInt CLDim )
+{
+    // NOTE: Temporaries are avoided since constructing a BigInt/BigFloat
+    //       involves a memory allocation
+
+    // Scale C
+    if( beta == T(0) )
+    {
+        for( BlasInt j=0; j<n; ++j )
+            for( BlasInt i=0; i<m; ++i )
+                C[i+j*CLDim] = 0;
+    }
+    else if( beta != T(1) )
+    {
+        for( BlasInt j=0; j<n; ++j )
+            for( BlasInt i=0; i<m; ++i )
+                C[i+j*CLDim] *= beta;
+    }
+    if( m == 0 || n == 0 || k == 0 || alpha == T(0) )
+        return;
+
+    gemm::Blocked
+    ( transA, transB, m, n, k, alpha, A, ALDim, B, BLDim, C, CLDim );
+}
 template void Gemm
 ( char transA, char transB,
   BlasInt m, BlasInt n, BlasInt k, 
@@ -257,5 +257,60 @@ void Gemv
 { EL_BLAS(zgemv)
   ( &trans, &m, &n, &alpha, A, &ALDim, x, &incx, &beta, y, &incy ); }
 
+#ifdef EL_HAVE_QD
+void Gemv
+( char trans, BlasInt m, BlasInt n,
+  const DoubleDouble& alpha,
+  const DoubleDouble* A, BlasInt ALDim, 
+  const DoubleDouble* x, BlasInt incx,
+  const DoubleDouble& beta,
+        DoubleDouble* y, BlasInt incy )
+{
+    // Only the unit-stride cases are vectorized: the columns of A are
+    // combined with SIMD axpy's in the normal case and SIMD dot products
+    // in the (conjugate-)transposed case
+    const bool normal = ( std::toupper(trans) == 'N' );
+    if( qd::GetSIMD() == qd::SIMD_NONE ||
+        (normal && incy != 1) || (!normal && incx != 1) ||
+        (beta == DoubleDouble(0) && (normal ? n : m) == 0) )
+    {
+        Gemv<DoubleDouble>
+        ( trans, m, n, alpha, A, ALDim, x, incx, beta, y, incy );
+        return;
+    }
+
+    // As in the reference BLAS, y is overwritten (rather than scaled) when
+    // beta is zero so that any NaN or Inf within it is discarded
+    const BlasInt yLength = ( normal ? m : n );
+    if( beta == DoubleDouble(0) )
+    {
+        for( BlasInt i=0; i<yLength; ++i )
+            y[i*incy] = 0;
+    }
+    else
+        Scal( yLength, beta, y, incy );
+
+    DoubleDouble gamma;
+    if( normal )
+    {
+        for( BlasInt j=0; j<n; ++j )
+        {
+            gamma = x[j*incx];
+            gamma *= alpha;
+            qd::Axpy( m, gamma, &A[j*ALDim], y );
+        }
+    }
+    else
+    {
+        for( BlasInt i=0; i<n; ++i )
+        {
+            qd::Dot( m, &A[i*ALDim], x, gamma );
+            gamma *= alpha;
+            y[i*incy] += gamma;
+        }
+    }
+}
+#endif
+
 } // namespace blas
 } // namespace El
@@ -70,6 +70,15 @@ double Nrm2( BlasInt n, const double* x, BlasInt incx )
 { return EL_BLAS(dnrm2)( &n, x, &incx ); }
 double Nrm2( BlasInt n, const dcomplex* x, BlasInt incx )
 { return EL_BLAS(dznrm2)( &n, x, &incx ); }
+#ifdef EL_HAVE_QD
+DoubleDouble Nrm2( BlasInt n, const DoubleDouble* x, BlasInt incx )
+{
+    DoubleDouble alpha;
+    if( incx == 1 && qd::Nrm2( n, x, alpha ) )
+        return alpha;
+    return Nrm2<DoubleDouble>( n, x, incx );
+}
+#endif
 
 // NOTE: 'nrm1' is not the official name but is consistent with 'nrm2'
 template<typename F>
@@ -55,7 +55,7 @@ namespace El {
 namespace blas {
 
 template<typename T>
-void Herk
+void HerkUnblocked
 ( char uplo, char trans,
   BlasInt n, BlasInt k,
   const Base<T>& alpha,
@@ -163,6 +163,61 @@ void Herk
         }
     }
 }
+// A blocked algorithm which casts all but the diagonal blocks of C in terms
+// of the packed Gemm
+template<typename T>
+void Herk
+( char uplo, char trans,
+  BlasInt n, BlasInt k,
+  const Base<T>& alpha,
+  const T* A, BlasInt ALDim,
+  const Base<T>& beta,
+        T* C, BlasInt CLDim )
+{
+    const BlasInt nb = gemm::Blocksizes<T>::MC;
+    if( n <= nb )
+    {
+        HerkUnblocked( uplo, trans, n, k, alpha, A, ALDim, beta, C, CLDim );
+        return;
+    }
+
+    // Scale C
+    if( beta == Base<T>(0) )
+    {
+        for( BlasInt j=0; j<n; ++j )
+            for( BlasInt i=0; i<n; ++i )
+                C[i+j*CLDim] = 0;
+    }
+    else if( beta != Base<T>(1) )
+    {
+        for( BlasInt j=0; j<n; ++j )
+            for( BlasInt i=0; i<n; ++i )
+                C[i+j*CLDim] *= beta;
+    }
+
+    // C(I,J) += alpha op(A)(I,:) op(A)(J,:)^H, where op(A) is either
+    // A or A^H
+    const bool normal = ( std::toupper(trans) == 'N' );
+    const bool lower = ( std::toupper(uplo) == 'L' );
+    const char transLeft = ( normal ? 'N' : 'C' );
+    const char transRight = ( normal ? 'C' : 'N' );
+    const T alphaT( alpha ), one(1);
+    for( BlasInt j0=0; j0<n; j0+=nb )
+    {
+        const BlasInt jb = Min(nb,n-j0);
+        HerkUnblocked
+        ( uplo, trans, jb, k,
+          alpha, gemm::OpPointer(transLeft,A,ALDim,j0,0), ALDim,
+          Base<T>(1), &C[j0+j0*CLDim], CLDim );
+        const BlasInt i0 = ( lower ? j0+jb : 0 );
+        const BlasInt mI = ( lower ? n-(j0+jb) : j0 );
+        Gemm
+        ( transLeft, transRight, mI, jb, k,
+          alphaT, gemm::OpPointer(transLeft,A,ALDim,i0,0), ALDim,
+                  gemm::OpPointer(transRight,A,ALDim,0,j0), ALDim,
+          one,    &C[i0+j0*CLDim], CLDim );
+    }
+}
 template void Herk
 ( char uplo, char trans,
   BlasInt n, BlasInt k,
@@ -291,7 +346,7 @@ void Herk
 }
 
 template<typename T>
-void Syrk
+void SyrkUnblocked
 ( char uplo, char trans,
   BlasInt n, BlasInt k, 
   const T& alpha,
@@ -399,6 +454,61 @@ void Syrk
         }
     }
 }
+// A blocked algorithm which casts all but the diagonal blocks of C in terms
+// of the packed Gemm
+template<typename T>
+void Syrk
+( char uplo, char trans,
+  BlasInt n, BlasInt k,
+  const T& alpha,
+  const T* A, BlasInt ALDim,
+  const T& beta,
+        T* C, BlasInt CLDim )
+{
+    const BlasInt nb = gemm::Blocksizes<T>::MC;
+    if( n <= nb )
+    {
+        SyrkUnblocked( uplo, trans, n, k, alpha, A, ALDim, beta, C, CLDim );
+        return;
+    }
+
+    // Scale C
+    if( beta == T(0) )
+    {
+        for( BlasInt j=0; j<n; ++j )
+            for( BlasInt i=0; i<n; ++i )
+                C[i+j*CLDim] = 0;
+    }
+    else if( beta != T(1) )
+    {
+        for( BlasInt j=0; j<n; ++j )
+            for( BlasInt i=0; i<n; ++i )
+                C[i+j*CLDim] *= beta;
+    }
+
+    // C(I,J) += alpha op(A)(I,:) op(A)(J,:)^T, where op(A) is either
+    // A or A^T
+    const bool normal = ( std::toupper(trans) == 'N' );
+    const bool lower = ( std::toupper(uplo) == 'L' );
+    const char transLeft = ( normal ? 'N' : 'T' );
+    const char transRight = ( normal ? 'T' : 'N' );
+    const T alphaT( alpha ), one(1);
+    for( BlasInt j0=0; j0<n; j0+=nb )
+    {
+        const BlasInt jb = Min(nb,n-j0);
+        SyrkUnblocked
+        ( uplo, trans, jb, k,
+          alpha, gemm::OpPointer(transLeft,A,ALDim,j0,0), ALDim,
+          T(1), &C[j0+j0*CLDim], CLDim );
+        const BlasInt i0 = ( lower ? j0+jb : 0 );
+        const BlasInt mI = ( lower ? n-(j0+jb) : j0 );
+        Gemm
+        ( transLeft, transRight, mI, jb, k,
+          alphaT, gemm::OpPointer(transLeft,A,ALDim,i0,0), ALDim,
+                  gemm::OpPointer(transRight,A,ALDim,0,j0), ALDim,
+          one,    &C[i0+j0*CLDim], CLDim );
+    }
+}
 template void Syrk
 ( char uplo, char trans,
   BlasInt n, BlasInt k, 
@@ -38,7 +38,7 @@ namespace El {
 namespace blas {
 
 template<typename T>
-void Trmm
+void TrmmUnblocked
 ( char side, char uplo, char trans, char unit,
   BlasInt m, BlasInt n,
   const T& alpha,
@@ -49,9 +49,10 @@ void Trmm
     const bool conjugate = ( std::toupper(trans) == 'C' );
 
     // Scale B
-    for( BlasInt j=0; j<n; ++j )
-        for( BlasInt i=0; i<m; ++i )
-            B[i+j*BLDim] *= alpha;
+    if( alpha != T(1) )
+        for( BlasInt j=0; j<n; ++j )
+            for( BlasInt i=0; i<m; ++i )
+                B[i+j*BLDim] *= alpha;
 
     // TODO: Legitimate blocked implementations...it seems offensive to
     //       repeatedly stream all of the triangular matrix through memory
@@ -78,6 +79,76 @@ void Trmm
         }
     }
 }
+// A blocked algorithm which casts all but the diagonal-block products in
+// terms of the packed Gemm
+template<typename T>
+void Trmm
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const T& alpha,
+  const T* A, BlasInt ALDim,
+        T* B, BlasInt BLDim )
+{
+    const bool onLeft = ( std::toupper(side) == 'L' );
+    const BlasInt nb = gemm::Blocksizes<T>::KC;
+    const BlasInt mA = ( onLeft ? m : n );
+    if( mA <= nb )
+    {
+        TrmmUnblocked
+        ( side, uplo, trans, unit, m, n, alpha, A, ALDim, B, BLDim );
+        return;
+    }
+
+    // Scale B
+    if( alpha != T(1) )
+        for( BlasInt j=0; j<n; ++j )
+            for( BlasInt i=0; i<m; ++i )
+                B[i+j*BLDim] *= alpha;
+
+    // op(A) is lower-triangular if A is lower-triangular and not transposed
+    // or upper-triangular and transposed. Each block of B is overwritten
+    // only after it is no longer needed to update the remaining blocks.
+    const bool opLower =
+      ( (std::toupper(uplo) == 'L') == (std::toupper(trans) == 'N') );
+    const bool forward = ( onLeft != opLower );
+    const T one(1);
+    const BlasInt numBlocks = (mA+nb-1) / nb;
+    for( BlasInt t=0; t<numBlocks; ++t )
+    {
+        const BlasInt k0 = ( forward ? t : numBlocks-1-t )*nb;
+        const BlasInt kb = Min(nb,mA-k0);
+        const BlasInt k1 = k0 + kb;
+        const T* A11 = &A[k0+k0*ALDim];
+        if( onLeft )
+        {
+            TrmmUnblocked
+            ( side, uplo, trans, unit, kb, n, one, A11, ALDim,
+              &B[k0], BLDim );
+            // B(K,:) += op(A)(K,J) B(J,:) for the untouched rows J
+            const BlasInt j0 = ( forward ? k1 : 0 );
+            const BlasInt mJ = ( forward ? m-k1 : k0 );
+            Gemm
+            ( trans, 'N', kb, n, mJ,
+              one, gemm::OpPointer(trans,A,ALDim,k0,j0), ALDim,
+                   &B[j0], BLDim,
+              one, &B[k0], BLDim );
+        }
+        else
+        {
+            TrmmUnblocked
+            ( side, uplo, trans, unit, m, kb, one, A11, ALDim,
+              &B[k0*BLDim], BLDim );
+            // B(:,K) += B(:,J) op(A)(J,K) for the untouched columns J
+            const BlasInt j0 = ( forward ? k1 : 0 );
+            const BlasInt nJ = ( forward ? n-k1 : k0 );
+            Gemm
+            ( 'N', trans, m, kb, nJ,
+              one, &B[j0*BLDim], BLDim,
+                   gemm::OpPointer(trans,A,ALDim,j0,k0), ALDim,
+              one, &B[k0*BLDim], BLDim );
+        }
+    }
+}
 template void Trmm
 ( char side, char uplo, char trans, char unit,
   BlasInt m, BlasInt n,
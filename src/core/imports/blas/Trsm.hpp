@@ -38,7 +38,7 @@ namespace El {
 namespace blas {
 
 template<typename F>
-void Trsm
+void TrsmUnblocked
 ( char side, char uplo, char trans, char unit,
   BlasInt m, BlasInt n,
   const F& alpha,
@@ -53,9 +53,10 @@ void Trsm
     const bool unitDiag = ( std::toupper(unit) == 'U' );
 
     // Scale B
-    for( BlasInt j=0; j<n; ++j )
-        for( BlasInt i=0; i<m; ++i )
-            B[i+j*BLDim] *= alpha;
+    if( alpha != F(1) )
+        for( BlasInt j=0; j<n; ++j )
+            for( BlasInt i=0; i<m; ++i )
+                B[i+j*BLDim] *= alpha;
 
     F alpha11, alpha11Conj;
     if( onLeft )
@@ -293,6 +294,75 @@ void Trsm
         }
     }
 }
+// A blocked algorithm which casts all but the diagonal-block solves in terms
+// of the packed Gemm
+template<typename F>
+void Trsm
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const F& alpha,
+  const F* A, BlasInt ALDim,
+        F* B, BlasInt BLDim )
+{
+    const bool onLeft = ( std::toupper(side) == 'L' );
+    const BlasInt nb = gemm::Blocksizes<F>::KC;
+    const BlasInt mA = ( onLeft ? m : n );
+    if( mA <= nb )
+    {
+        TrsmUnblocked
+        ( side, uplo, trans, unit, m, n, alpha, A, ALDim, B, BLDim );
+        return;
+    }
+
+    // Scale B
+    if( alpha != F(1) )
+        for( BlasInt j=0; j<n; ++j )
+            for( BlasInt i=0; i<m; ++i )
+                B[i+j*BLDim] *= alpha;
+
+    // op(A) is lower-triangular if A is lower-triangular and not transposed
+    // or upper-triangular and transposed
+    const bool opLower =
+      ( (std::toupper(uplo) == 'L') == (std::toupper(trans) == 'N') );
+    const bool forward = ( onLeft == opLower );
+    const F one(1), negOne(-1);
+    const BlasInt numBlocks = (mA+nb-1) / nb;
+    for( BlasInt t=0; t<numBlocks; ++t )
+    {
+        const BlasInt k0 = ( forward ? t : numBlocks-1-t )*nb;
+        const BlasInt kb = Min(nb,mA-k0);
+        const BlasInt k1 = k0 + kb;
+        const F* A11 = &A[k0+k0*ALDim];
+        if( onLeft )
+        {
+            TrsmUnblocked
+            ( side, uplo, trans, unit, kb, n, one, A11, ALDim,
+              &B[k0], BLDim );
+            // B(I,:) -= op(A)(I,K) B(K,:) for the unsolved rows I
+            const BlasInt i0 = ( forward ? k1 : 0 );
+            const BlasInt mI = ( forward ? m-k1 : k0 );
+            Gemm
+            ( trans, 'N', mI, n, kb,
+              negOne, gemm::OpPointer(trans,A,ALDim,i0,k0), ALDim,
+                      &B[k0], BLDim,
+              one,    &B[i0], BLDim );
+        }
+        else
+        {
+            TrsmUnblocked
+            ( side, uplo, trans, unit, m, kb, one, A11, ALDim,
+              &B[k0*BLDim], BLDim );
+            // B(:,J) -= B(:,K) op(A)(K,J) for the unsolved columns J
+            const BlasInt j0 = ( forward ? k1 : 0 );
+            const BlasInt nJ = ( forward ? n-k1 : k0 );
+            Gemm
+            ( 'N', trans, m, nJ, kb,
+              negOne, &B[k0*BLDim], BLDim,
+                      gemm::OpPointer(trans,A,ALDim,k0,j0), ALDim,
+              one,    &B[j0*BLDim], BLDim );
+        }
+    }
+}
 #ifdef EL_HAVE_QD
 template void Trsm
 ( char side, char uplo, char trans, char unit,
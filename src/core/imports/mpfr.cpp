@@ -13,6 +13,7 @@ namespace {
 
 size_t numLimbs;
 int numIntLimbs;
+bool slabStorage = false;
 
 El::BigInt bigIntZero, bigIntOne, bigIntTwo;
 
@@ -69,6 +70,12 @@ void SetMinIntBits( int numBits )
     previouslySet = true;
 }
 
+bool SlabStorage()
+{ return ::slabStorage; }
+
+void SetSlabStorage( bool slabStorage )
+{ ::slabStorage = slabStorage; }
+
 int NumIntBits()
 { return ::numIntLimbs*GMP_NUMB_BITS; }
 
@@ -9,6 +9,15 @@
 #include <El-lite.hpp>
 #ifdef EL_HAVE_MPC
 
+namespace {
+
+// Slabs begin with a header holding the number of bytes in the block (which
+// the allocator may have rounded up), followed by the entries and then by
+// their limbs
+const size_t slabHeaderBytes = alignof(std::max_align_t);
+
+} // anonymous namespace
+
 namespace El {
 
 void BigFloat::SetNumLimbs( mpfr_prec_t prec )
@@ -39,6 +48,14 @@ mpfr_prec_t BigFloat::Precision() const
 
 void BigFloat::SetPrecision( mpfr_prec_t prec )
 {
+    if( slabBacked_ )
+    {
+        if( prec != Precision() )
+            LogicError
+            ("Cannot change the precision of a slab-backed BigFloat from ",
+             Precision()," to ",prec);
+        return;
+    }
     mpfr_set_prec( mpfrFloat_, prec ); 
     SetNumLimbs( prec );
 }
@@ -46,6 +63,9 @@ void BigFloat::SetPrecision( mpfr_prec_t prec )
 size_t BigFloat::NumLimbs() const
 { return numLimbs_; }
 
+bool BigFloat::SlabBacked() const
+{ return slabBacked_; }
+
 BigFloat::BigFloat()
 {
     DEBUG_CSE
@@ -223,15 +243,30 @@ BigFloat::BigFloat( const std::string& str, int base, mpfr_prec_t prec )
 BigFloat::BigFloat( BigFloat&& a )
 {
     DEBUG_CSE
+    if( a.slabBacked_ )
+    {
+        // The limbs of a slab-backed BigFloat cannot change hands
+        Init( a.Precision() );
+        mpfr_set( Pointer(), a.LockedPointer(), mpfr::RoundingMode() );
+        return;
+    }
     Pointer()->_mpfr_d = 0;
     mpfr_swap( Pointer(), a.Pointer() );
     std::swap( numLimbs_, a.numLimbs_ );
 }
 
+BigFloat::BigFloat( mpfr_prec_t prec, void* limbs, SlabTag )
+: slabBacked_(true)
+{
+    mpfr_custom_init( limbs, prec );
+    mpfr_custom_init_set( Pointer(), MPFR_ZERO_KIND, 0, prec, limbs );
+    SetNumLimbs( prec );
+}
+
 BigFloat::~BigFloat()
 {
     DEBUG_CSE
-    if( Pointer()->_mpfr_d != 0 )
+    if( !slabBacked_ && Pointer()->_mpfr_d != 0 )
         mpfr_clear( Pointer() );
 }
 
@@ -395,6 +430,21 @@ BigFloat& BigFloat::operator=( const Quad& a )
 BigFloat& BigFloat::operator=( BigFloat&& a )
 {
     DEBUG_CSE
+    if( slabBacked_ || a.slabBacked_ )
+    {
+        // The limbs of a slab-backed BigFloat cannot change hands, so we
+        // fall back to a copy (which preserves the precision of 'a' unless
+        // this BigFloat is itself slab-backed)
+        if( !slabBacked_ )
+        {
+            if( Pointer()->_mpfr_d == 0 )
+                Init( a.Precision() );
+            else
+                SetPrecision( a.Precision() );
+        }
+        mpfr_set( Pointer(), a.LockedPointer(), mpfr::RoundingMode() );
+        return *this;
+    }
     mpfr_swap( Pointer(), a.Pointer() );
     std::swap( numLimbs_, a.numLimbs_ );
     return *this;
@@ -1101,9 +1151,13 @@ byte* BigFloat::Serialize( byte* buf ) const
 const byte* BigFloat::Deserialize( const byte* buf )
 {
     DEBUG_CSE
-    // TODO: Ensure that the precisions matched already
-    std::memcpy( &mpfrFloat_->_mpfr_prec, buf, sizeof(mpfr_prec_t) );
+    // The limbs are only copied after the precision (and hence the number of
+    // limbs) has been matched; slab-backed entries cannot change precision
+    mpfr_prec_t prec;
+    std::memcpy( &prec, buf, sizeof(mpfr_prec_t) );
     buf += sizeof(mpfr_prec_t);
+    if( prec != Precision() )
+        SetPrecision( prec );
     std::memcpy( &mpfrFloat_->_mpfr_sign, buf, sizeof(mpfr_sign_t) );
     buf += sizeof(mpfr_sign_t);
     std::memcpy( &mpfrFloat_->_mpfr_exp, buf, sizeof(mpfr_exp_t) );
@@ -1118,6 +1172,43 @@ const byte* BigFloat::Deserialize( const byte* buf )
 byte* BigFloat::Deserialize( byte* buf )
 { return const_cast<byte*>(Deserialize(static_cast<const byte*>(buf))); }
 
+namespace mpfr {
+
+BigFloat* NewSlab( size_t size )
+{
+    DEBUG_CSE
+    if( size == 0 )
+        return nullptr;
+    const mpfr_prec_t prec = Precision();
+    const size_t limbBytes = mpfr_custom_get_size( prec );
+    // NOTE: sizeof(BigFloat) is a multiple of the alignment of mp_limb_t
+    size_t numBytes = slabHeaderBytes + size*(sizeof(BigFloat)+limbBytes);
+    byte* block = static_cast<byte*>(AllocateBytes( numBytes ));
+    std::memcpy( block, &numBytes, sizeof(size_t) );
+
+    BigFloat* entries = reinterpret_cast<BigFloat*>(block+slabHeaderBytes);
+    byte* limbs = block + slabHeaderBytes + size*sizeof(BigFloat);
+    for( size_t i=0; i<size; ++i )
+        new(&entries[i])
+          BigFloat( prec, &limbs[i*limbBytes], BigFloat::SlabTag() );
+    return entries;
+}
+
+void DeleteSlab( BigFloat* entries, size_t size )
+{
+    DEBUG_CSE
+    if( entries == nullptr )
+        return;
+    for( size_t i=0; i<size; ++i )
+        entries[i].~BigFloat();
+    byte* block = reinterpret_cast<byte*>(entries) - slabHeaderBytes;
+    size_t numBytes;
+    std::memcpy( &numBytes, block, sizeof(size_t) );
+    FreeBytes( block, numBytes );
+}
+
+} // namespace mpfr
+
 BigFloat operator+( const BigFloat& a, const BigFloat& b )
 { return BigFloat(a) += b; }
 BigFloat operator-( const BigFloat& a, const BigFloat& b )
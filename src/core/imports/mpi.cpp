@@ -10,6 +10,9 @@
 */
 #include <El-lite.hpp>
 
+#include <iomanip>
+#include <map>
+
 // TODO: Introduce macros to shorten the explicit instantiation code
 
 typedef unsigned char* UCP;
@@ -47,6 +50,610 @@ MPI_Op NativeOp( const El::mpi::Op& op )
     return opC;
 }
 
+// Traffic accounting
+// ==================
+// Each MPI routine which communicates is called through a wrapper (in the
+// 'traffic' namespace) with the same arguments which, if accounting was
+// enabled, records the call, the bytes which the calling process nominally
+// sends and receives, and the time spent within MPI, under the name of the
+// communicator and the name of the operation. If tracing is enabled (see
+// El::StartTracing), each call is also recorded as an event.
+//
+// The communicators of each grid are named with the grid's number (see
+// El::Grid::Id), and each unnamed communicator is given a distinct name
+// (numbered in the order in which the calling process first used it) so that
+// the statistics of different communicators are not merged.
+
+bool trafficAccounting = false;
+std::map<std::pair<std::string,std::string>,El::mpi::TrafficStats>
+  trafficStats;
+std::map<MPI_Comm,std::string> unnamedComms;
+// Freed communicators are forgotten, so the numbers are not reused
+int numUnnamedComms = 0;
+
+std::string CommName( MPI_Comm comm )
+{
+    char name[MPI_MAX_OBJECT_NAME];
+    int length;
+    MPI_Comm_get_name( comm, name, &length );
+    if( length > 0 )
+        return std::string( name, length );
+    auto it = ::unnamedComms.find( comm );
+    if( it != ::unnamedComms.end() )
+        return it->second;
+    int commSize;
+    MPI_Comm_size( comm, &commSize );
+    const std::string unnamed =
+      "unnamed(" + std::to_string(commSize) + ")#" +
+      std::to_string(::numUnnamedComms++);
+    ::unnamedComms[comm] = unnamed;
+    return unnamed;
+}
+
+int CommRank( MPI_Comm comm )
+{
+    int commRank;
+    MPI_Comm_rank( comm, &commRank );
+    return commRank;
+}
+
+int CommSize( MPI_Comm comm )
+{
+    int commSize;
+    MPI_Comm_size( comm, &commSize );
+    return commSize;
+}
+
+long long Bytes( int count, MPI_Datatype type )
+{
+    int typeSize;
+    MPI_Type_size( type, &typeSize );
+    return static_cast<long long>(count)*typeSize;
+}
+
+long long Bytes( const int* counts, int numCounts, MPI_Datatype type )
+{
+    long long totalCount = 0;
+    for( int q=0; q<numCounts; ++q )
+        totalCount += counts[q];
+    return totalCount*Bytes( 1, type );
+}
+
+class TrafficScope
+{
+public:
+    long long sent=0, recv=0;
+
+    TrafficScope( const char* operation, MPI_Comm comm )
+    : accounting_(::trafficAccounting), tracing_(El::Tracing()),
+      operation_(operation), comm_(comm)
+    {
+        if( Active() )
+            start_ = El::Clock::now();
+    }
+
+    ~TrafficScope()
+    {
+        if( !Active() )
+            return;
+        const auto end = El::Clock::now();
+        const std::string commName = CommName( comm_ );
+        if( accounting_ )
+        {
+            El::mpi::TrafficStats& stats =
+              ::trafficStats[std::make_pair(commName,std::string(operation_))];
+            ++stats.numCalls;
+            stats.bytesSent += sent;
+            stats.bytesRecv += recv;
+            stats.time +=
+              std::chrono::duration<double>(end-start_).count();
+        }
+        if( tracing_ )
+            El::TraceEvent
+            ( operation_, "mpi", start_, end,
+              "\"comm\": \""+commName+"\", \"sent\": "+std::to_string(sent)+
+              ", \"recv\": "+std::to_string(recv) );
+    }
+
+    bool Active() const { return accounting_ || tracing_; }
+
+private:
+    bool accounting_, tracing_;
+    const char* operation_;
+    MPI_Comm comm_;
+    El::Clock::time_point start_;
+};
+
+namespace traffic {
+
+// Point-to-point
+// --------------
+
+int Send
+( const void* buf, int count, MPI_Datatype type, int to, int tag,
+  MPI_Comm comm )
+{
+    TrafficScope scope( "Send", comm );
+    if( scope.Active() )
+        scope.sent = Bytes( count, type );
+    return MPI_Send( const_cast<void*>(buf), count, type, to, tag, comm );
+}
+
+int Isend
+( const void* buf, int count, MPI_Datatype type, int to, int tag,
+  MPI_Comm comm, MPI_Request* request )
+{
+    TrafficScope scope( "ISend", comm );
+    if( scope.Active() )
+        scope.sent = Bytes( count, type );
+    return MPI_Isend
+    ( const_cast<void*>(buf), count, type, to, tag, comm, request );
+}
+
+int Irsend
+( const void* buf, int count, MPI_Datatype type, int to, int tag,
+  MPI_Comm comm, MPI_Request* request )
+{
+    TrafficScope scope( "IRSend", comm );
+    if( scope.Active() )
+        scope.sent = Bytes( count, type );
+    return MPI_Irsend
+    ( const_cast<void*>(buf), count, type, to, tag, comm, request );
+}
+
+int Issend
+( const void* buf, int count, MPI_Datatype type, int to, int tag,
+  MPI_Comm comm, MPI_Request* request )
+{
+    TrafficScope scope( "ISSend", comm );
+    if( scope.Active() )
+        scope.sent = Bytes( count, type );
+    return MPI_Issend
+    ( const_cast<void*>(buf), count, type, to, tag, comm, request );
+}
+
+int Recv
+( void* buf, int count, MPI_Datatype type, int from, int tag,
+  MPI_Comm comm, MPI_Status* status )
+{
+    TrafficScope scope( "Recv", comm );
+    if( scope.Active() )
+        scope.recv = Bytes( count, type );
+    return MPI_Recv( buf, count, type, from, tag, comm, status );
+}
+
+int Irecv
+( void* buf, int count, MPI_Datatype type, int from, int tag,
+  MPI_Comm comm, MPI_Request* request )
+{
+    TrafficScope scope( "IRecv", comm );
+    if( scope.Active() )
+        scope.recv = Bytes( count, type );
+    return MPI_Irecv( buf, count, type, from, tag, comm, request );
+}
+
+int Sendrecv
+( const void* sbuf, int sc, MPI_Datatype stype, int to,   int stag,
+        void* rbuf, int rc, MPI_Datatype rtype, int from, int rtag,
+  MPI_Comm comm, MPI_Status* status )
+{
+    TrafficScope scope( "SendRecv", comm );
+    if( scope.Active() )
+    {
+        scope.sent = Bytes( sc, stype );
+        scope.recv = Bytes( rc, rtype );
+    }
+    return MPI_Sendrecv
+    ( const_cast<void*>(sbuf), sc, stype, to, stag,
+      rbuf, rc, rtype, from, rtag, comm, status );
+}
+
+int Sendrecv_replace
+( void* buf, int count, MPI_Datatype type,
+  int to, int stag, int from, int rtag, MPI_Comm comm, MPI_Status* status )
+{
+    TrafficScope scope( "SendRecv", comm );
+    if( scope.Active() )
+        scope.sent = scope.recv = Bytes( count, type );
+    return MPI_Sendrecv_replace
+    ( buf, count, type, to, stag, from, rtag, comm, status );
+}
+
+// Collectives
+// -----------
+// Each process is charged for the portions of the send and receive buffers
+// which are significant on it (e.g., only the root of a gather receives).
+
+int Barrier( MPI_Comm comm )
+{
+    TrafficScope scope( "Barrier", comm );
+    return MPI_Barrier( comm );
+}
+
+int Bcast( void* buf, int count, MPI_Datatype type, int root, MPI_Comm comm )
+{
+    TrafficScope scope( "Broadcast", comm );
+    if( scope.Active() )
+    {
+        if( CommRank(comm) == root )
+            scope.sent = Bytes( count, type );
+        else
+            scope.recv = Bytes( count, type );
+    }
+    return MPI_Bcast( buf, count, type, root, comm );
+}
+
+int Gather
+( const void* sbuf, int sc, MPI_Datatype stype,
+        void* rbuf, int rc, MPI_Datatype rtype, int root, MPI_Comm comm )
+{
+    TrafficScope scope( "Gather", comm );
+    if( scope.Active() )
+    {
+        if( sbuf != MPI_IN_PLACE )
+            scope.sent = Bytes( sc, stype );
+        if( CommRank(comm) == root )
+            scope.recv = CommSize(comm)*Bytes( rc, rtype );
+    }
+    return MPI_Gather
+    ( const_cast<void*>(sbuf), sc, stype, rbuf, rc, rtype, root, comm );
+}
+
+int Gatherv
+( const void* sbuf, int sc, MPI_Datatype stype,
+        void* rbuf, const int* rcs, const int* rds, MPI_Datatype rtype,
+  int root, MPI_Comm comm )
+{
+    TrafficScope scope( "Gather", comm );
+    if( scope.Active() )
+    {
+        if( sbuf != MPI_IN_PLACE )
+            scope.sent = Bytes( sc, stype );
+        if( CommRank(comm) == root )
+            scope.recv = Bytes( rcs, CommSize(comm), rtype );
+    }
+    return MPI_Gatherv
+    ( const_cast<void*>(sbuf), sc, stype,
+      rbuf, const_cast<int*>(rcs), const_cast<int*>(rds), rtype, root, comm );
+}
+
+int Allgather
+( const void* sbuf, int sc, MPI_Datatype stype,
+        void* rbuf, int rc, MPI_Datatype rtype, MPI_Comm comm )
+{
+    TrafficScope scope( "AllGather", comm );
+    if( scope.Active() )
+    {
+        scope.sent =
+          ( sbuf == MPI_IN_PLACE ? Bytes( rc, rtype ) : Bytes( sc, stype ) );
+        scope.recv = CommSize(comm)*Bytes( rc, rtype );
+    }
+    return MPI_Allgather
+    ( const_cast<void*>(sbuf), sc, stype, rbuf, rc, rtype, comm );
+}
+
+int Allgatherv
+( const void* sbuf, int sc, MPI_Datatype stype,
+        void* rbuf, const int* rcs, const int* rds, MPI_Datatype rtype,
+  MPI_Comm comm )
+{
+    TrafficScope scope( "AllGather", comm );
+    if( scope.Active() )
+    {
+        scope.sent =
+          ( sbuf == MPI_IN_PLACE ? Bytes( rcs[CommRank(comm)], rtype )
+                                 : Bytes( sc, stype ) );
+        scope.recv = Bytes( rcs, CommSize(comm), rtype );
+    }
+    return MPI_Allgatherv
+    ( const_cast<void*>(sbuf), sc, stype,
+      rbuf, const_cast<int*>(rcs), const_cast<int*>(rds), rtype, comm );
+}
+
+int Scatter
+( const void* sbuf, int sc, MPI_Datatype stype,
+        void* rbuf, int rc, MPI_Datatype rtype, int root, MPI_Comm comm )
+{
+    TrafficScope scope( "Scatter", comm );
+    if( scope.Active() )
+    {
+        if( CommRank(comm) == root )
+            scope.sent = CommSize(comm)*Bytes( sc, stype );
+        if( rbuf != MPI_IN_PLACE )
+            scope.recv = Bytes( rc, rtype );
+    }
+    return MPI_Scatter
+    ( const_cast<void*>(sbuf), sc, stype, rbuf, rc, rtype, root, comm );
+}
+
+int Alltoall
+( const void* sbuf, int sc, MPI_Datatype stype,
+        void* rbuf, int rc, MPI_Datatype rtype, MPI_Comm comm )
+{
+    TrafficScope scope( "AllToAll", comm );
+    if( scope.Active() )
+    {
+        const int commSize = CommSize( comm );
+        scope.sent = commSize*Bytes( sc, stype );
+        scope.recv = commSize*Bytes( rc, rtype );
+    }
+    return MPI_Alltoall
+    ( const_cast<void*>(sbuf), sc, stype, rbuf, rc, rtype, comm );
+}
+
+int Alltoallv
+( const void* sbuf, const int* scs, const int* sds, MPI_Datatype stype,
+        void* rbuf, const int* rcs, const int* rds, MPI_Datatype rtype,
+  MPI_Comm comm )
+{
+    TrafficScope scope( "AllToAll", comm );
+    if( scope.Active() )
+    {
+        const int commSize = CommSize( comm );
+        scope.sent = Bytes( scs, commSize, stype );
+        scope.recv = Bytes( rcs, commSize, rtype );
+    }
+    return MPI_Alltoallv
+    ( const_cast<void*>(sbuf), const_cast<int*>(scs), const_cast<int*>(sds),
+      stype,
+      rbuf, const_cast<int*>(rcs), const_cast<int*>(rds), rtype, comm );
+}
+
+int Reduce
+( const void* sbuf, void* rbuf, int count, MPI_Datatype type, MPI_Op op,
+  int root, MPI_Comm comm )
+{
+    TrafficScope scope( "Reduce", comm );
+    if( scope.Active() )
+    {
+        scope.sent = Bytes( count, type );
+        if( CommRank(comm) == root )
+            scope.recv = scope.sent;
+    }
+    return MPI_Reduce
+    ( const_cast<void*>(sbuf), rbuf, count, type, op, root, comm );
+}
+
+int Allreduce
+( const void* sbuf, void* rbuf, int count, MPI_Datatype type, MPI_Op op,
+  MPI_Comm comm )
+{
+    TrafficScope scope( "AllReduce", comm );
+    if( scope.Active() )
+        scope.sent = scope.recv = Bytes( count, type );
+    return MPI_Allreduce
+    ( const_cast<void*>(sbuf), rbuf, count, type, op, comm );
+}
+
+int Reduce_scatter
+( const void* sbuf, void* rbuf, const int* rcs, MPI_Datatype type,
+  MPI_Op op, MPI_Comm comm )
+{
+    TrafficScope scope( "ReduceScatter", comm );
+    if( scope.Active() )
+    {
+        scope.sent = Bytes( rcs, CommSize(comm), type );
+        scope.recv = Bytes( rcs[CommRank(comm)], type );
+    }
+    return MPI_Reduce_scatter
+    ( const_cast<void*>(sbuf), rbuf, const_cast<int*>(rcs), type, op, comm );
+}
+
+#ifdef EL_HAVE_MPI_REDUCE_SCATTER_BLOCK
+int Reduce_scatter_block
+( const void* sbuf, void* rbuf, int rc, MPI_Datatype type,
+  MPI_Op op, MPI_Comm comm )
+{
+    TrafficScope scope( "ReduceScatter", comm );
+    if( scope.Active() )
+    {
+        scope.recv = Bytes( rc, type );
+        scope.sent = CommSize(comm)*scope.recv;
+    }
+    return MPI_Reduce_scatter_block
+    ( const_cast<void*>(sbuf), rbuf, rc, type, op, comm );
+}
+#endif
+
+int Scan
+( const void* sbuf, void* rbuf, int count, MPI_Datatype type, MPI_Op op,
+  MPI_Comm comm )
+{
+    TrafficScope scope( "Scan", comm );
+    if( scope.Active() )
+        scope.sent = scope.recv = Bytes( count, type );
+    return MPI_Scan( const_cast<void*>(sbuf), rbuf, count, type, op, comm );
+}
+
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+int Ibcast
+( void* buf, int count, MPI_Datatype type, int root, MPI_Comm comm,
+  MPI_Request* request )
+{
+    TrafficScope scope( "IBroadcast", comm );
+    if( scope.Active() )
+    {
+        if( CommRank(comm) == root )
+            scope.sent = Bytes( count, type );
+        else
+            scope.recv = Bytes( count, type );
+    }
+    return EL_NONBLOCKING_COLL(Ibcast)
+    ( buf, count, type, root, comm, request );
+}
+
+int Igather
+( const void* sbuf, int sc, MPI_Datatype stype,
+        void* rbuf, int rc, MPI_Datatype rtype, int root, MPI_Comm comm,
+  MPI_Request* request )
+{
+    TrafficScope scope( "IGather", comm );
+    if( scope.Active() )
+    {
+        if( sbuf != MPI_IN_PLACE )
+            scope.sent = Bytes( sc, stype );
+        if( CommRank(comm) == root )
+            scope.recv = CommSize(comm)*Bytes( rc, rtype );
+    }
+    return EL_NONBLOCKING_COLL(Igather)
+    ( const_cast<void*>(sbuf), sc, stype, rbuf, rc, rtype, root, comm,
+      request );
+}
+
+int Iallgather
+( const void* sbuf, int sc, MPI_Datatype stype,
+        void* rbuf, int rc, MPI_Datatype rtype, MPI_Comm comm,
+  MPI_Request* request )
+{
+    TrafficScope scope( "IAllGather", comm );
+    if( scope.Active() )
+    {
+        scope.sent =
+          ( sbuf == MPI_IN_PLACE ? Bytes( rc, rtype ) : Bytes( sc, stype ) );
+        scope.recv = CommSize(comm)*Bytes( rc, rtype );
+    }
+    return EL_NONBLOCKING_COLL(Iallgather)
+    ( const_cast<void*>(sbuf), sc, stype, rbuf, rc, rtype, comm, request );
+}
+
+int Ialltoall
+( const void* sbuf, int sc, MPI_Datatype stype,
+        void* rbuf, int rc, MPI_Datatype rtype, MPI_Comm comm,
+  MPI_Request* request )
+{
+    TrafficScope scope( "IAllToAll", comm );
+    if( scope.Active() )
+    {
+        const int commSize = CommSize( comm );
+        scope.sent = commSize*Bytes( sc, stype );
+        scope.recv = commSize*Bytes( rc, rtype );
+    }
+    return EL_NONBLOCKING_COLL(Ialltoall)
+    ( const_cast<void*>(sbuf), sc, stype, rbuf, rc, rtype, comm, request );
+}
+#endif // ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+
+} // namespace traffic
+
+// Reproducible (binned) summation
+// ===============================
+// If reproducible sums were requested, floating-point sums are performed by
+// binning each entry (see El::SumBins) relative to the maximum magnitude of
+// that entry over all of the processes and then summing the folds, which is
+// exact. (A single bound for all of the entries would drop any entry which
+// is negligible relative to the largest of the other entries.)
+
+template<typename Real>
+bool UseBinnedSum( const El::mpi::Op& op )
+{
+    return op == El::mpi::SUM && El::IsBlasScalar<Real>::value &&
+           El::ReproducibleSums();
+}
+
+template<typename Real,typename=El::EnableIf<El::IsBlasScalar<Real>>>
+void BinEntries
+( const Real* sbuf, int count, MPI_Comm comm,
+  std::vector<El::SumBins>& bins, std::vector<double>& folds )
+{
+    const int numFolds = El::SumBins::numFolds;
+    std::vector<double> maxAbs( count );
+    for( int i=0; i<count; ++i )
+        maxAbs[i] = double(El::Abs(sbuf[i]));
+    SafeMpi
+    ( traffic::Allreduce
+      ( MPI_IN_PLACE, maxAbs.data(), count, MPI_DOUBLE, MPI_MAX, comm ) );
+
+    bins.clear();
+    bins.reserve( count );
+    folds.assign( numFolds*count, 0 );
+    for( int i=0; i<count; ++i )
+    {
+        bins.emplace_back( maxAbs[i] );
+        bins[i].Deposit( double(sbuf[i]), &folds[i*numFolds] );
+    }
+}
+
+template<typename Real,typename=El::EnableIf<El::IsBlasScalar<Real>>>
+void CollapseEntries
+( const El::SumBins* bins, const double* folds, Real* rbuf, int count )
+{
+    const int numFolds = El::SumBins::numFolds;
+    for( int i=0; i<count; ++i )
+        rbuf[i] = Real(bins[i].Collapse(&folds[i*numFolds]));
+}
+
+// UseBinnedSum is false for the remaining datatypes
+template<typename Real,
+         typename=El::DisableIf<El::IsBlasScalar<Real>>,typename=void>
+void BinEntries
+( const Real* sbuf, int count, MPI_Comm comm,
+  std::vector<El::SumBins>& bins, std::vector<double>& folds )
+{ El::LogicError("Binned sums require floating-point entries"); }
+
+template<typename Real,
+         typename=El::DisableIf<El::IsBlasScalar<Real>>,typename=void>
+void CollapseEntries
+( const El::SumBins* bins, const double* folds, Real* rbuf, int count )
+{ El::LogicError("Binned sums require floating-point entries"); }
+
+// NOTE: The following allow 'sbuf' and 'rbuf' to coincide
+
+template<typename Real>
+void BinnedReduce
+( const Real* sbuf, Real* rbuf, int count, int root, MPI_Comm comm )
+{
+    std::vector<El::SumBins> bins;
+    std::vector<double> folds;
+    BinEntries( sbuf, count, comm, bins, folds );
+    int commRank;
+    MPI_Comm_rank( comm, &commRank );
+    if( commRank == root )
+    {
+        SafeMpi
+        ( traffic::Reduce
+          ( MPI_IN_PLACE, folds.data(), folds.size(), MPI_DOUBLE, MPI_SUM,
+            root, comm ) );
+        CollapseEntries( bins.data(), folds.data(), rbuf, count );
+    }
+    else
+        SafeMpi
+        ( traffic::Reduce
+          ( folds.data(), 0, folds.size(), MPI_DOUBLE, MPI_SUM, root, comm ) );
+}
+
+template<typename Real>
+void BinnedAllReduce( const Real* sbuf, Real* rbuf, int count, MPI_Comm comm )
+{
+    std::vector<El::SumBins> bins;
+    std::vector<double> folds;
+    BinEntries( sbuf, count, comm, bins, folds );
+    SafeMpi
+    ( traffic::Allreduce
+      ( MPI_IN_PLACE, folds.data(), folds.size(), MPI_DOUBLE, MPI_SUM,
+        comm ) );
+    CollapseEntries( bins.data(), folds.data(), rbuf, count );
+}
+
+template<typename Real>
+void BinnedReduceScatter
+( const Real* sbuf, Real* rbuf, int rc, MPI_Comm comm )
+{
+    const int numFolds = El::SumBins::numFolds;
+    int commRank, commSize;
+    MPI_Comm_rank( comm, &commRank );
+    MPI_Comm_size( comm, &commSize );
+    std::vector<El::SumBins> bins;
+    std::vector<double> folds;
+    BinEntries( sbuf, rc*commSize, comm, bins, folds );
+    std::vector<double> recvFolds( numFolds*rc );
+    std::vector<int> recvCounts( commSize, numFolds*rc );
+    SafeMpi
+    ( traffic::Reduce_scatter
+      ( folds.data(), recvFolds.data(), recvCounts.data(), MPI_DOUBLE,
+        MPI_SUM, comm ) );
+    CollapseEntries( &bins[commRank*rc], recvFolds.data(), rbuf, rc );
+}
+
 } // anonymous namespace
 
 namespace El {
@@ -174,9 +781,24 @@ void Split( Comm comm, int color, int key, Comm& newComm ) EL_NO_RELEASE_EXCEPT
     SafeMpi( MPI_Comm_split( comm.comm, color, key, &newComm.comm ) );
 }
 
+void SplitShared( Comm comm, int key, Comm& newComm ) EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_CSE
+#if MPI_VERSION >= 3
+    SafeMpi
+    ( MPI_Comm_split_type
+      ( comm.comm, MPI_COMM_TYPE_SHARED, key, MPI_INFO_NULL, &newComm.comm ) );
+#else
+    // Conservatively assume that no two processes share a node
+    SafeMpi( MPI_Comm_split( comm.comm, Rank(comm), key, &newComm.comm ) );
+#endif
+}
+
 void Free( Comm& comm ) EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    // The handle may be reused by a new communicator
+    ::unnamedComms.erase( comm.comm );
     SafeMpi( MPI_Comm_free( &comm.comm ) );
 }
 
@@ -188,6 +810,18 @@ bool Congruent( Comm comm1, Comm comm2 ) EL_NO_RELEASE_EXCEPT
     return ( result == MPI_IDENT || result == MPI_CONGRUENT );
 }
 
+void SetName( Comm comm, const std::string& name ) EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_CSE
+    SafeMpi( MPI_Comm_set_name( comm.comm, const_cast<char*>(name.c_str()) ) );
+}
+
+std::string Name( Comm comm ) EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_CSE
+    return CommName( comm.comm );
+}
+
 void ErrorHandlerSet( Comm comm, ErrorHandler errorHandler )
 EL_NO_RELEASE_EXCEPT
 {
@@ -396,7 +1030,180 @@ void Translate
 void Barrier( Comm comm ) EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
-    SafeMpi( MPI_Barrier( comm.comm ) );
+    SafeMpi( traffic::Barrier( comm.comm ) );
+}
+
+// Shared-memory windows
+// =====================
+
+void* AllocateShared
+( size_t numBytes, Comm comm, Window& window ) EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_CSE
+#if MPI_VERSION >= 3
+    const bool isRoot = ( Rank(comm) == 0 );
+    const MPI_Aint localBytes = ( isRoot ? MPI_Aint(numBytes) : 0 );
+    SafeMpi
+    ( MPI_Win_allocate_shared
+      ( localBytes, 1, MPI_INFO_NULL, comm.comm, &window.base, &window.win ) );
+    if( !isRoot )
+    {
+        MPI_Aint rootBytes;
+        int dispUnit;
+        SafeMpi
+        ( MPI_Win_shared_query
+          ( window.win, 0, &rootBytes, &dispUnit, &window.base ) );
+    }
+    // Open a passive-target epoch so that SyncShared can synchronize the
+    // public and private copies of the window
+    SafeMpi( MPI_Win_lock_all( MPI_MODE_NOCHECK, window.win ) );
+#else
+    // Without MPI-3, SplitShared only produces singleton communicators
+    if( Size(comm) != 1 )
+        LogicError("Shared-memory windows require MPI-3");
+    SafeMpi( MPI_Alloc_mem( MPI_Aint(numBytes), MPI_INFO_NULL, &window.base ) );
+#endif
+    window.numBytes = numBytes;
+    window.comm = comm;
+    return window.base;
+}
+
+void SyncShared( Window window, Comm comm ) EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_CSE
+#if MPI_VERSION >= 3
+    SafeMpi( MPI_Win_sync( window.win ) );
+    SafeMpi( traffic::Barrier( comm.comm ) );
+    SafeMpi( MPI_Win_sync( window.win ) );
+#else
+    SafeMpi( traffic::Barrier( comm.comm ) );
+#endif
+}
+
+void Free( Window& window ) EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_CSE
+#if MPI_VERSION >= 3
+    if( window.win != MPI_WIN_NULL )
+    {
+        SafeMpi( MPI_Win_unlock_all( window.win ) );
+        SafeMpi( MPI_Win_free( &window.win ) );
+    }
+#else
+    if( window.base != nullptr )
+        SafeMpi( MPI_Free_mem( window.base ) );
+#endif
+    window.base = nullptr;
+    window.numBytes = 0;
+    window.comm = COMM_NULL;
+}
+
+// Traffic accounting
+// ==================
+
+void SetTrafficAccounting( bool enable ) { ::trafficAccounting = enable; }
+bool TrafficAccounting() { return ::trafficAccounting; }
+
+vector<TrafficEntry> TrafficSummary()
+{
+    vector<TrafficEntry> summary;
+    for( const auto& entry : ::trafficStats )
+    {
+        TrafficEntry summaryEntry;
+        summaryEntry.commName = entry.first.first;
+        summaryEntry.operation = entry.first.second;
+        summaryEntry.stats = entry.second;
+        summary.push_back( summaryEntry );
+    }
+    return summary;
+}
+
+void ClearTraffic() { ::trafficStats.clear(); }
+
+void WriteTraffic( std::ostream& os, Comm comm )
+{
+    DEBUG_CSE
+    // Do not record the communication required to write the statistics
+    const bool accounting = ::trafficAccounting;
+    ::trafficAccounting = false;
+    const int commRank = Rank( comm );
+    const int commSize = Size( comm );
+    const int root = 0;
+
+    // Gather the (tab-separated) local statistics onto the root
+    std::ostringstream localStream;
+    localStream.precision( 17 );
+    for( const auto& entry : ::trafficStats )
+    {
+        const TrafficStats& stats = entry.second;
+        localStream << entry.first.first << '\t' << entry.first.second << '\t'
+          << stats.numCalls << '\t' << stats.bytesSent << '\t'
+          << stats.bytesRecv << '\t' << stats.time << '\n';
+    }
+    const std::string localLines = localStream.str();
+    const int localSize = localLines.size();
+    vector<int> sizes(commSize,0), offsets;
+    Gather( &localSize, 1, sizes.data(), 1, root, comm );
+    const int totalSize = El::Scan( sizes, offsets );
+    vector<byte> allLines(totalSize);
+    Gather
+    ( reinterpret_cast<const byte*>(localLines.data()), localSize,
+      allLines.data(), sizes.data(), offsets.data(), root, comm );
+    ::trafficAccounting = accounting;
+    if( commRank != root )
+        return;
+
+    // Sum the statistics of each (communicator,operation) pair over the
+    // processes, and also track the maximum time
+    struct Totals
+    {
+        int numProcs=0;
+        TrafficStats sum;
+        double maxTime=0;
+    };
+    std::map<std::pair<std::string,std::string>,Totals> totals;
+    std::istringstream stream
+      ( std::string(reinterpret_cast<const char*>(allLines.data()),totalSize) );
+    std::string line;
+    while( std::getline( stream, line ) )
+    {
+        std::istringstream lineStream( line );
+        std::string commName, operation;
+        std::getline( lineStream, commName, '\t' );
+        std::getline( lineStream, operation, '\t' );
+        TrafficStats stats;
+        lineStream >> stats.numCalls >> stats.bytesSent >> stats.bytesRecv
+                   >> stats.time;
+        Totals& total = totals[std::make_pair(commName,operation)];
+        ++total.numProcs;
+        total.sum.numCalls += stats.numCalls;
+        total.sum.bytesSent += stats.bytesSent;
+        total.sum.bytesRecv += stats.bytesRecv;
+        total.sum.time += stats.time;
+        total.maxTime = std::max( total.maxTime, stats.time );
+    }
+
+    const int nameWidth = 16, statWidth = 14;
+    os << std::left << std::setw(nameWidth) << "Communicator"
+       << std::setw(nameWidth) << "Operation" << std::right
+       << std::setw(6) << "Procs" << std::setw(statWidth) << "calls"
+       << std::setw(statWidth) << "bytes sent"
+       << std::setw(statWidth) << "bytes recv"
+       << std::setw(statWidth) << "time avg"
+       << std::setw(statWidth) << "time max" << "\n";
+    for( const auto& entry : totals )
+    {
+        const Totals& total = entry.second;
+        os << std::left << std::setw(nameWidth) << entry.first.first
+           << std::setw(nameWidth) << entry.first.second << std::right
+           << std::setw(6) << total.numProcs
+           << std::setw(statWidth) << total.sum.numCalls
+           << std::setw(statWidth) << total.sum.bytesSent
+           << std::setw(statWidth) << total.sum.bytesRecv
+           << std::setw(statWidth) << total.sum.time/total.numProcs
+           << std::setw(statWidth) << total.maxTime << "\n";
+    }
+    os << std::flush;
 }
 
 // Test for completion
@@ -544,7 +1351,7 @@ EL_NO_RELEASE_EXCEPT
 { 
     DEBUG_CSE
     SafeMpi
-    ( MPI_Send
+    ( traffic::Send
       ( const_cast<Real*>(buf), count, TypeMap<Real>(), to, tag, comm.comm ) );
 }
 
@@ -556,12 +1363,12 @@ EL_NO_RELEASE_EXCEPT
     DEBUG_CSE
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
-    ( MPI_Send
+    ( traffic::Send
       ( const_cast<Complex<Real>*>(buf), 2*count, TypeMap<Real>(), to, 
         tag, comm.comm ) );
 #else
     SafeMpi
-    ( MPI_Send
+    ( traffic::Send
       ( const_cast<Complex<Real>*>(buf), count, 
         TypeMap<Complex<Real>>(), to, tag, comm.comm ) );
 #endif
@@ -574,7 +1381,8 @@ void TaggedSend( const T* buf, int count, int to, int tag, Comm comm )
     std::vector<byte> packedBuf;
     Serialize( count, buf, packedBuf );
     SafeMpi
-    ( MPI_Send( packedBuf.data(), count, TypeMap<T>(), to, tag, comm.comm ) );
+    ( traffic::Send
+      ( packedBuf.data(), count, TypeMap<T>(), to, tag, comm.comm ) );
 }
 
 template<typename T>
@@ -597,7 +1405,7 @@ EL_NO_RELEASE_EXCEPT
 { 
     DEBUG_CSE
     SafeMpi
-    ( MPI_Isend
+    ( traffic::Isend
       ( const_cast<Real*>(buf), count, TypeMap<Real>(), to, 
         tag, comm.comm, &request.backend ) );
 }
@@ -610,12 +1418,12 @@ void TaggedISend
     DEBUG_CSE
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
-    ( MPI_Isend
+    ( traffic::Isend
       ( const_cast<Complex<Real>*>(buf), 2*count, 
         TypeMap<Real>(), to, tag, comm.comm, &request.backend ) );
 #else
     SafeMpi
-    ( MPI_Isend
+    ( traffic::Isend
       ( const_cast<Complex<Real>*>(buf), count, 
         TypeMap<Complex<Real>>(), to, tag, comm.comm, &request.backend ) );
 #endif
@@ -629,7 +1437,7 @@ EL_NO_RELEASE_EXCEPT
     DEBUG_CSE
     Serialize( count, buf, request.buffer );
     SafeMpi
-    ( MPI_Isend
+    ( traffic::Isend
       ( request.buffer.data(), count, TypeMap<T>(), to, tag, comm.comm,
         &request.backend ) );
 }
@@ -658,7 +1466,7 @@ EL_NO_RELEASE_EXCEPT
 { 
     DEBUG_CSE
     SafeMpi
-    ( MPI_Irsend
+    ( traffic::Irsend
       ( const_cast<Real*>(buf), count, TypeMap<Real>(), to, 
         tag, comm.comm, &request.backend ) );
 }
@@ -671,12 +1479,12 @@ void TaggedIRSend
     DEBUG_CSE
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
-    ( MPI_Irsend
+    ( traffic::Irsend
       ( const_cast<Complex<Real>*>(buf), 2*count, 
         TypeMap<Real>(), to, tag, comm.comm, &request.backend ) );
 #else
     SafeMpi
-    ( MPI_Irsend
+    ( traffic::Irsend
       ( const_cast<Complex<Real>*>(buf), count, 
         TypeMap<Complex<Real>>(), to, tag, comm.comm, &request.backend ) );
 #endif
@@ -691,7 +1499,7 @@ EL_NO_RELEASE_EXCEPT
     DEBUG_CSE
     Serialize( count, buf, request.buffer );
     SafeMpi
-    ( MPI_Irsend
+    ( traffic::Irsend
       ( request.buffer.data(), count, TypeMap<T>(), to, 
         tag, comm.comm, &request.backend ) );
 }
@@ -719,7 +1527,7 @@ void TaggedISSend
 {
     DEBUG_CSE
     SafeMpi
-    ( MPI_Issend
+    ( traffic::Issend
       ( const_cast<Real*>(buf), count, TypeMap<Real>(), to, 
         tag, comm.comm, &request.backend ) );
 }
@@ -732,12 +1540,12 @@ void TaggedISSend
     DEBUG_CSE
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
-    ( MPI_Issend
+    ( traffic::Issend
       ( const_cast<Complex<Real>*>(buf), 2*count, 
         TypeMap<Real>(), to, tag, comm.comm, &request.backend ) );
 #else
     SafeMpi
-    ( MPI_Issend
+    ( traffic::Issend
       ( const_cast<Complex<Real>*>(buf), count, 
         TypeMap<Complex<Real>>(), to, tag, comm.comm, &request.backend ) );
 #endif
@@ -751,7 +1559,7 @@ EL_NO_RELEASE_EXCEPT
     DEBUG_CSE
     Serialize( count, buf, request.buffer );
     SafeMpi
-    ( MPI_Issend
+    ( traffic::Issend
       ( request.buffer.data(), count, TypeMap<T>(), to, 
         tag, comm.comm, &request.backend ) );
 }
@@ -773,7 +1581,8 @@ EL_NO_RELEASE_EXCEPT
     DEBUG_CSE
     Status status;
     SafeMpi
-    ( MPI_Recv( buf, count, TypeMap<Real>(), from, tag, comm.comm, &status ) );
+    ( traffic::Recv
+      ( buf, count, TypeMap<Real>(), from, tag, comm.comm, &status ) );
 }
 
 template<typename Real,typename>
@@ -784,10 +1593,10 @@ EL_NO_RELEASE_EXCEPT
     Status status;
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
-    ( MPI_Recv( buf, 2*count, TypeMap<Real>(), from, tag, comm.comm, &status ) );
+    ( traffic::Recv( buf, 2*count, TypeMap<Real>(), from, tag, comm.comm, &status ) );
 #else
     SafeMpi
-    ( MPI_Recv
+    ( traffic::Recv
       ( buf, count, TypeMap<Complex<Real>>(), from, tag, comm.comm, &status ) );
 #endif
 }
@@ -800,7 +1609,7 @@ void TaggedRecv( T* buf, int count, int from, int tag, Comm comm )
     ReserveSerialized( count, buf, packedBuf );
     Status status;
     SafeMpi
-    ( MPI_Recv
+    ( traffic::Recv
       ( packedBuf.data(), count, TypeMap<T>(), from, tag,
         comm.comm, &status ) );
     Deserialize( count, packedBuf, buf );
@@ -828,7 +1637,7 @@ EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
     SafeMpi
-    ( MPI_Irecv
+    ( traffic::Irecv
       ( buf, count, TypeMap<Real>(), from, tag, comm.comm, &request.backend ) );
 }
 
@@ -841,12 +1650,12 @@ EL_NO_RELEASE_EXCEPT
     DEBUG_CSE
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
-    ( MPI_Irecv
+    ( traffic::Irecv
       ( buf, 2*count, TypeMap<Real>(), from, tag, comm.comm,
         &request.backend ) );
 #else
     SafeMpi
-    ( MPI_Irecv
+    ( traffic::Irecv
       ( buf, count, TypeMap<Complex<Real>>(), from, tag, comm.comm,
         &request.backend ) );
 #endif
@@ -863,7 +1672,7 @@ EL_NO_RELEASE_EXCEPT
     request.unpackedRecvBuf = buf;
     ReserveSerialized( count, buf, request.buffer );
     SafeMpi
-    ( MPI_Irecv
+    ( traffic::Irecv
       ( request.buffer.data(), count, TypeMap<T>(), from, tag, comm.comm,
         &request.backend ) );
 }
@@ -892,7 +1701,7 @@ EL_NO_RELEASE_EXCEPT
     DEBUG_CSE
     Status status;
     SafeMpi
-    ( MPI_Sendrecv
+    ( traffic::Sendrecv
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(), to,   stag,
         rbuf,                    rc, TypeMap<Real>(), from, rtag, 
         comm.comm, &status ) );
@@ -908,13 +1717,13 @@ EL_NO_RELEASE_EXCEPT
     Status status;
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
-    ( MPI_Sendrecv
+    ( traffic::Sendrecv
       ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(), to,   stag,
         rbuf,                             2*rc, TypeMap<Real>(), from, rtag, 
         comm.comm, &status ) );
 #else
     SafeMpi
-    ( MPI_Sendrecv
+    ( traffic::Sendrecv
       ( const_cast<Complex<Real>*>(sbuf), 
         sc, TypeMap<Complex<Real>>(), to,   stag,
         rbuf,                          
@@ -933,7 +1742,7 @@ void TaggedSendRecv
     Serialize( sc, sbuf, packedSend );
     ReserveSerialized( rc, rbuf, packedRecv );
     SafeMpi
-    ( MPI_Sendrecv
+    ( traffic::Sendrecv
       ( packedSend.data(), sc, TypeMap<T>(), to,   stag,
         packedRecv.data(), rc, TypeMap<T>(), from, rtag, 
         comm.comm, &status ) );
@@ -969,7 +1778,7 @@ EL_NO_RELEASE_EXCEPT
     DEBUG_CSE
     Status status;
     SafeMpi
-    ( MPI_Sendrecv_replace
+    ( traffic::Sendrecv_replace
       ( buf, count, TypeMap<Real>(), to, stag, from, rtag, comm.comm,
         &status ) );
 }
@@ -984,12 +1793,12 @@ EL_NO_RELEASE_EXCEPT
     Status status;
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
-    ( MPI_Sendrecv_replace
+    ( traffic::Sendrecv_replace
       ( buf, 2*count, TypeMap<Real>(), to, stag, from, rtag, comm.comm, 
         &status ) );
 #else
     SafeMpi
-    ( MPI_Sendrecv_replace
+    ( traffic::Sendrecv_replace
       ( buf, count, TypeMap<Complex<Real>>(), 
         to, stag, from, rtag, comm.comm, &status ) );
 #endif
@@ -1006,7 +1815,7 @@ EL_NO_RELEASE_EXCEPT
     Serialize( count, buf, packedBuf );
     Status status;
     SafeMpi
-    ( MPI_Sendrecv_replace
+    ( traffic::Sendrecv_replace
       ( packedBuf.data(), count, TypeMap<T>(), to, stag, from, rtag,
         comm.comm, &status ) );
     Deserialize( count, packedBuf, buf );
@@ -1024,7 +1833,7 @@ EL_NO_RELEASE_EXCEPT
     DEBUG_CSE
     if( Size(comm) == 1 || count == 0 )
         return;
-    SafeMpi( MPI_Bcast( buf, count, TypeMap<Real>(), root, comm.comm ) );
+    SafeMpi( traffic::Bcast( buf, count, TypeMap<Real>(), root, comm.comm ) );
 }
 
 template<typename Real,typename>
@@ -1035,9 +1844,9 @@ EL_NO_RELEASE_EXCEPT
     if( Size(comm) == 1 )
         return;
 #ifdef EL_AVOID_COMPLEX_MPI
-    SafeMpi( MPI_Bcast( buf, 2*count, TypeMap<Real>(), root, comm.comm ) );
+    SafeMpi( traffic::Bcast( buf, 2*count, TypeMap<Real>(), root, comm.comm ) );
 #else
-    SafeMpi( MPI_Bcast( buf, count, TypeMap<Complex<Real>>(), root, comm.comm ) );
+    SafeMpi( traffic::Bcast( buf, count, TypeMap<Complex<Real>>(), root, comm.comm ) );
 #endif
 }
 
@@ -1051,7 +1860,7 @@ EL_NO_RELEASE_EXCEPT
     std::vector<byte> packedBuf;
     Serialize( count, buf, packedBuf );
     SafeMpi(
-      MPI_Bcast( packedBuf.data(), count, TypeMap<T>(), root, comm.comm )
+      traffic::Bcast( packedBuf.data(), count, TypeMap<T>(), root, comm.comm )
     );
     Deserialize( count, packedBuf, buf );
 }
@@ -1067,7 +1876,7 @@ void IBroadcast
     DEBUG_CSE
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
     SafeMpi
-    ( MPI_Ibcast
+    ( traffic::Ibcast
       ( buf, count, TypeMap<Real>(), root, comm.comm, &request.backend ) );
 #else
     LogicError("Elemental was not configured with non-blocking support");
@@ -1083,11 +1892,11 @@ void IBroadcast
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
-    ( MPI_Ibcast
+    ( traffic::Ibcast
       ( buf, 2*count, TypeMap<Real>(), root, comm.comm, &request.backend ) );
 #else
     SafeMpi
-    ( MPI_Ibcast
+    ( traffic::Ibcast
       ( buf, count, TypeMap<Complex<Real>>(), root, comm.comm,
         &request.backend ) );
 #endif
@@ -1102,13 +1911,15 @@ void IBroadcast
 {
     DEBUG_CSE
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    // Every process serializes its buffer so that the root's data is sent
+    // and the other processes have a correctly-sized receive buffer
     request.receivingPacked = true;
     request.recvCount = count;
     request.unpackedRecvBuf = buf;
-    ReserveSerialized( count, buf, request.buffer );
+    Serialize( count, buf, request.buffer );
     SafeMpi
-    ( MPI_Ibcast
-      ( request.buffer.data(), count, TypeMap<Real>(), root, comm.comm,
+    ( traffic::Ibcast
+      ( request.buffer.data(), count, TypeMap<T>(), root, comm.comm,
         &request.backend ) );
 #else
     LogicError("Elemental was not configured with non-blocking support");
@@ -1127,7 +1938,7 @@ EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
     SafeMpi
-    ( MPI_Gather
+    ( traffic::Gather
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
         rbuf,                    rc, TypeMap<Real>(), root, comm.comm ) );
 }
@@ -1141,13 +1952,13 @@ EL_NO_RELEASE_EXCEPT
     DEBUG_CSE
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
-    ( MPI_Gather
+    ( traffic::Gather
       ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(),
         rbuf,                             2*rc, TypeMap<Real>(),
         root, comm.comm ) );
 #else
     SafeMpi
-    ( MPI_Gather
+    ( traffic::Gather
       ( const_cast<Complex<Real>*>(sbuf), sc, TypeMap<Complex<Real>>(),
         rbuf,                             rc, TypeMap<Complex<Real>>(), 
         root, comm.comm ) );
@@ -1171,7 +1982,7 @@ EL_NO_RELEASE_EXCEPT
     if( commRank == root )
         ReserveSerialized( totalRecv, rbuf, packedRecv );
     SafeMpi
-    ( MPI_Gather
+    ( traffic::Gather
       ( packedSend.data(), sc, TypeMap<T>(),
         packedRecv.data(), rc, TypeMap<T>(), root, comm.comm ) );
     if( commRank == root )
@@ -1188,7 +1999,7 @@ void IGather
     DEBUG_CSE
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
     SafeMpi
-    ( MPI_Igather
+    ( traffic::Igather
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
         rbuf,                    rc, TypeMap<Real>(), root, comm.comm,
         &request.backend ) );
@@ -1208,13 +2019,13 @@ void IGather
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
-    ( MPI_Igather
+    ( traffic::Igather
       ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(),
         rbuf,                             2*rc, TypeMap<Real>(), 
         root, comm.comm, &request.backend ) );
 #else
     SafeMpi
-    ( MPI_Igather
+    ( traffic::Igather
       ( const_cast<Complex<Real>*>(sbuf), sc, TypeMap<Complex<Real>>(),
         rbuf,                             rc, TypeMap<Complex<Real>>(), 
         root, comm.comm, &request.backend ) );
@@ -1233,19 +2044,12 @@ void IGather
 {
     DEBUG_CSE
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
-    if( mpi::Rank(comm) == root )
-    {
-        const int commSize = mpi::Size(comm);
-        request.receivingPacked = true;
-        request.recvCount = rc*commSize;
-        request.unpackedRecvBuf = rbuf;
-        ReserveSerialized( rc*commSize, rbuf, request.buffer );
-    }
-    SafeMpi
-    ( MPI_Igather
-      ( request.buffer.data(), sc, TypeMap<Real>(),
-        rbuf,                  rc, TypeMap<Real>(), root, comm.comm,
-        &request.backend ) );
+    // The send and receive buffers would both need to be serialized and kept
+    // alive, so the gather is performed immediately and the request is
+    // marked as complete
+    Gather( sbuf, sc, rbuf, rc, root, comm );
+    request.receivingPacked = false;
+    request.backend = MPI_REQUEST_NULL;
 #else
     LogicError("Elemental was not configured with non-blocking support");
 #endif
@@ -1260,7 +2064,7 @@ EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
     SafeMpi
-    ( MPI_Gatherv
+    ( traffic::Gatherv
       ( const_cast<Real*>(sbuf), 
         sc,       
         TypeMap<Real>(),
@@ -1295,13 +2099,13 @@ EL_NO_RELEASE_EXCEPT
         }
     }
     SafeMpi
-    ( MPI_Gatherv
+    ( traffic::Gatherv
       ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(),
         rbuf, rcsDouble.data(), rdsDouble.data(), TypeMap<Real>(),
         root, comm.comm ) );
 #else
     SafeMpi
-    ( MPI_Gatherv
+    ( traffic::Gatherv
       ( const_cast<Complex<Real>*>(sbuf), 
         sc,       
         TypeMap<Complex<Real>>(),
@@ -1334,7 +2138,7 @@ EL_NO_RELEASE_EXCEPT
     if( commRank == root )
         ReserveSerialized( totalRecv, rbuf, packedRecv );
     SafeMpi
-    ( MPI_Gatherv
+    ( traffic::Gatherv
       ( packedSend.data(),
         sc,
         TypeMap<T>(),
@@ -1357,13 +2161,13 @@ EL_NO_RELEASE_EXCEPT
     DEBUG_CSE
 #ifdef EL_USE_BYTE_ALLGATHERS
     SafeMpi
-    ( MPI_Allgather
+    ( traffic::Allgather
       ( (UCP)const_cast<Real*>(sbuf), sizeof(Real)*sc, MPI_UNSIGNED_CHAR, 
         (UCP)rbuf,                    sizeof(Real)*rc, MPI_UNSIGNED_CHAR, 
         comm.comm ) );
 #else
     SafeMpi
-    ( MPI_Allgather
+    ( traffic::Allgather
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(), 
         rbuf,                    rc, TypeMap<Real>(), comm.comm ) );
 #endif
@@ -1378,7 +2182,7 @@ EL_NO_RELEASE_EXCEPT
     DEBUG_CSE
 #ifdef EL_USE_BYTE_ALLGATHERS
     SafeMpi
-    ( MPI_Allgather
+    ( traffic::Allgather
       ( (UCP)const_cast<Complex<Real>*>(sbuf),
         2*sizeof(Real)*sc, MPI_UNSIGNED_CHAR, 
         (UCP)rbuf,
@@ -1387,13 +2191,13 @@ EL_NO_RELEASE_EXCEPT
 #else
  #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
-    ( MPI_Allgather
+    ( traffic::Allgather
       ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(),
         rbuf,                             2*rc, TypeMap<Real>(),
         comm.comm ) );
  #else
     SafeMpi
-    ( MPI_Allgather
+    ( traffic::Allgather
       ( const_cast<Complex<Real>*>(sbuf), sc, TypeMap<Complex<Real>>(),
         rbuf,                             rc, TypeMap<Complex<Real>>(),
         comm.comm ) );
@@ -1416,12 +2220,74 @@ EL_NO_RELEASE_EXCEPT
 
     ReserveSerialized( totalRecv, rbuf, packedRecv );
     SafeMpi
-    ( MPI_Allgather
+    ( traffic::Allgather
       ( packedSend.data(), sc, TypeMap<T>(),
         packedRecv.data(), rc, TypeMap<T>(), comm.comm ) );
     Deserialize( totalRecv, packedRecv, rbuf );
 }
 
+template<typename Real,typename>
+void IAllGather
+( const Real* sbuf, int sc,
+        Real* rbuf, int rc, Comm comm,
+  Request<Real>& request )
+{
+    DEBUG_CSE
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    SafeMpi
+    ( traffic::Iallgather
+      ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
+        rbuf,                    rc, TypeMap<Real>(), comm.comm,
+        &request.backend ) );
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename Real,typename>
+void IAllGather
+( const Complex<Real>* sbuf, int sc,
+        Complex<Real>* rbuf, int rc, Comm comm,
+  Request<Complex<Real>>& request )
+{
+    DEBUG_CSE
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+#ifdef EL_AVOID_COMPLEX_MPI
+    SafeMpi
+    ( traffic::Iallgather
+      ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(),
+        rbuf,                             2*rc, TypeMap<Real>(),
+        comm.comm, &request.backend ) );
+#else
+    SafeMpi
+    ( traffic::Iallgather
+      ( const_cast<Complex<Real>*>(sbuf), sc, TypeMap<Complex<Real>>(),
+        rbuf,                             rc, TypeMap<Complex<Real>>(),
+        comm.comm, &request.backend ) );
+#endif
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename T,typename,typename>
+void IAllGather
+( const T* sbuf, int sc,
+        T* rbuf, int rc, Comm comm,
+  Request<T>& request )
+{
+    DEBUG_CSE
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    // As with IGather, the serialized exchange is performed immediately
+    // and the request is marked as complete
+    AllGather( sbuf, sc, rbuf, rc, comm );
+    request.receivingPacked = false;
+    request.backend = MPI_REQUEST_NULL;
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
 template<typename Real,typename>
 void AllGather
 ( const Real* sbuf, int sc,
@@ -1438,13 +2304,13 @@ EL_NO_RELEASE_EXCEPT
         byteRds[i] = sizeof(Real)*rds[i];
     }
     SafeMpi
-    ( MPI_Allgatherv
+    ( traffic::Allgatherv
       ( (UCP)const_cast<Real*>(sbuf), sizeof(Real)*sc,   MPI_UNSIGNED_CHAR, 
         (UCP)rbuf, byteRcs.data(), byteRds.data(), MPI_UNSIGNED_CHAR, 
         comm.comm ) );
 #else
     SafeMpi
-    ( MPI_Allgatherv
+    ( traffic::Allgatherv
       ( const_cast<Real*>(sbuf), 
         sc, 
         TypeMap<Real>(), 
@@ -1472,7 +2338,7 @@ EL_NO_RELEASE_EXCEPT
         byteRds[i] = 2*sizeof(Real)*rds[i];
     }
     SafeMpi
-    ( MPI_Allgatherv
+    ( traffic::Allgatherv
       ( (UCP)const_cast<Complex<Real>*>(sbuf),
         2*sizeof(Real)*sc, MPI_UNSIGNED_CHAR, 
         (UCP)rbuf, byteRcs.data(), byteRds.data(),
@@ -1488,12 +2354,12 @@ EL_NO_RELEASE_EXCEPT
         realRds[i] = 2*rds[i];
     }
     SafeMpi
-    ( MPI_Allgatherv
+    ( traffic::Allgatherv
       ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(),
         rbuf, realRcs.data(), realRds.data(), TypeMap<Real>(), comm.comm ) );
  #else
     SafeMpi
-    ( MPI_Allgatherv
+    ( traffic::Allgatherv
       ( const_cast<Complex<Real>*>(sbuf), 
         sc, 
         TypeMap<Complex<Real>>(),
@@ -1521,7 +2387,7 @@ EL_NO_RELEASE_EXCEPT
 
     ReserveSerialized( totalRecv, rbuf, packedRecv );
     SafeMpi
-    ( MPI_Allgatherv
+    ( traffic::Allgatherv
       ( packedSend.data(),
         sc,
         TypeMap<T>(),
@@ -1541,7 +2407,7 @@ EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
     SafeMpi
-    ( MPI_Scatter
+    ( traffic::Scatter
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
         rbuf,                    rc, TypeMap<Real>(), root, comm.comm ) );
 }
@@ -1555,13 +2421,13 @@ EL_NO_RELEASE_EXCEPT
     DEBUG_CSE
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
-    ( MPI_Scatter
+    ( traffic::Scatter
       ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(),
         rbuf,                             2*rc, TypeMap<Real>(), root,
         comm.comm ) );
 #else
     SafeMpi
-    ( MPI_Scatter
+    ( traffic::Scatter
       ( const_cast<Complex<Real>*>(sbuf), sc, TypeMap<Complex<Real>>(),
         rbuf,                             rc, TypeMap<Complex<Real>>(), 
         root, comm.comm ) );
@@ -1585,7 +2451,7 @@ EL_NO_RELEASE_EXCEPT
 
     ReserveSerialized( rc, rbuf, packedRecv );
     SafeMpi
-    ( MPI_Scatter
+    ( traffic::Scatter
       ( packedSend.data(), sc, TypeMap<T>(),
         packedRecv.data(), rc, TypeMap<T>(), root, comm.comm ) );
     Deserialize( rc, packedRecv, rbuf );
@@ -1600,14 +2466,14 @@ EL_NO_RELEASE_EXCEPT
     if( commRank == root )
     {
         SafeMpi
-        ( MPI_Scatter
+        ( traffic::Scatter
           ( buf,          sc, TypeMap<Real>(), 
             MPI_IN_PLACE, rc, TypeMap<Real>(), root, comm.comm ) );
     }
     else
     {
         SafeMpi
-        ( MPI_Scatter
+        ( traffic::Scatter
           ( 0,   sc, TypeMap<Real>(), 
             buf, rc, TypeMap<Real>(), root, comm.comm ) );
     }
@@ -1623,12 +2489,12 @@ EL_NO_RELEASE_EXCEPT
     {
 #ifdef EL_AVOID_COMPLEX_MPI
         SafeMpi
-        ( MPI_Scatter
+        ( traffic::Scatter
           ( buf,          2*sc, TypeMap<Real>(), 
             MPI_IN_PLACE, 2*rc, TypeMap<Real>(), root, comm.comm ) );
 #else
         SafeMpi
-        ( MPI_Scatter
+        ( traffic::Scatter
           ( buf,          sc, TypeMap<Complex<Real>>(), 
             MPI_IN_PLACE, rc, TypeMap<Complex<Real>>(), root, comm.comm ) );
 #endif
@@ -1637,12 +2503,12 @@ EL_NO_RELEASE_EXCEPT
     {
 #ifdef EL_AVOID_COMPLEX_MPI
         SafeMpi
-        ( MPI_Scatter
+        ( traffic::Scatter
           ( 0,   2*sc, TypeMap<Real>(), 
             buf, 2*rc, TypeMap<Real>(), root, comm.comm ) );
 #else
         SafeMpi
-        ( MPI_Scatter
+        ( traffic::Scatter
           ( 0,   sc, TypeMap<Complex<Real>>(), 
             buf, rc, TypeMap<Complex<Real>>(), root, comm.comm ) );
 #endif
@@ -1666,7 +2532,7 @@ EL_NO_RELEASE_EXCEPT
 
     ReserveSerialized( rc, buf, packedRecv );
     SafeMpi
-    ( MPI_Scatter
+    ( traffic::Scatter
       ( packedSend.data(), sc, TypeMap<T>(),
         packedRecv.data(), rc, TypeMap<T>(), root, comm.comm ) );
     Deserialize( rc, packedRecv, buf );
@@ -1680,7 +2546,7 @@ EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
     SafeMpi
-    ( MPI_Alltoall
+    ( traffic::Alltoall
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
         rbuf,                    rc, TypeMap<Real>(), comm.comm ) );
 }
@@ -1694,14 +2560,14 @@ EL_NO_RELEASE_EXCEPT
     DEBUG_CSE
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
-    ( MPI_Alltoall
+    ( traffic::Alltoall
       ( const_cast<Complex<Real>*>(sbuf),
         2*sc, TypeMap<Real>(),
         rbuf,
         2*rc, TypeMap<Real>(), comm.comm ) );
 #else
     SafeMpi
-    ( MPI_Alltoall
+    ( traffic::Alltoall
       ( const_cast<Complex<Real>*>(sbuf),
         sc, TypeMap<Complex<Real>>(),
         rbuf,
@@ -1724,12 +2590,74 @@ EL_NO_RELEASE_EXCEPT
     Serialize( totalSend, sbuf, packedSend );
     ReserveSerialized( totalRecv, rbuf, packedRecv );
     SafeMpi
-    ( MPI_Alltoall
+    ( traffic::Alltoall
       ( packedSend.data(), sc, TypeMap<T>(),
         packedRecv.data(), rc, TypeMap<T>(), comm.comm ) );
     Deserialize( totalRecv, packedRecv, rbuf );
 }
 
+template<typename Real,typename>
+void IAllToAll
+( const Real* sbuf, int sc,
+        Real* rbuf, int rc, Comm comm,
+  Request<Real>& request )
+{
+    DEBUG_CSE
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    SafeMpi
+    ( traffic::Ialltoall
+      ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
+        rbuf,                    rc, TypeMap<Real>(), comm.comm,
+        &request.backend ) );
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename Real,typename>
+void IAllToAll
+( const Complex<Real>* sbuf, int sc,
+        Complex<Real>* rbuf, int rc, Comm comm,
+  Request<Complex<Real>>& request )
+{
+    DEBUG_CSE
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+#ifdef EL_AVOID_COMPLEX_MPI
+    SafeMpi
+    ( traffic::Ialltoall
+      ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(),
+        rbuf,                             2*rc, TypeMap<Real>(),
+        comm.comm, &request.backend ) );
+#else
+    SafeMpi
+    ( traffic::Ialltoall
+      ( const_cast<Complex<Real>*>(sbuf), sc, TypeMap<Complex<Real>>(),
+        rbuf,                             rc, TypeMap<Complex<Real>>(),
+        comm.comm, &request.backend ) );
+#endif
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename T,typename,typename>
+void IAllToAll
+( const T* sbuf, int sc,
+        T* rbuf, int rc, Comm comm,
+  Request<T>& request )
+{
+    DEBUG_CSE
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    // As with IGather, the serialized exchange is performed immediately
+    // and the request is marked as complete
+    AllToAll( sbuf, sc, rbuf, rc, comm );
+    request.receivingPacked = false;
+    request.backend = MPI_REQUEST_NULL;
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
 template<typename Real,typename>
 void AllToAll
 ( const Real* sbuf, const int* scs, const int* sds, 
@@ -1738,7 +2666,7 @@ EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
     SafeMpi
-    ( MPI_Alltoallv
+    ( traffic::Alltoallv
       ( const_cast<Real*>(sbuf), 
         const_cast<int*>(scs), 
         const_cast<int*>(sds), 
@@ -1770,13 +2698,13 @@ EL_NO_RELEASE_EXCEPT
         rdsDoubled[i] = 2*rds[i];
     }
     SafeMpi
-    ( MPI_Alltoallv
+    ( traffic::Alltoallv
       ( const_cast<Complex<Real>*>(sbuf),
               scsDoubled.data(), sdsDoubled.data(), TypeMap<Real>(),
         rbuf, rcsDoubled.data(), rdsDoubled.data(), TypeMap<Real>(), comm.comm ) );
 #else
     SafeMpi
-    ( MPI_Alltoallv
+    ( traffic::Alltoallv
       ( const_cast<Complex<Real>*>(sbuf), 
         const_cast<int*>(scs), 
         const_cast<int*>(sds), 
@@ -1804,7 +2732,7 @@ EL_NO_RELEASE_EXCEPT
     Serialize( totalSend, sbuf, packedSend );
     ReserveSerialized( totalRecv, rbuf, packedRecv );
     SafeMpi
-    ( MPI_Alltoallv
+    ( traffic::Alltoallv
       ( packedSend.data(),
         const_cast<int*>(scs), const_cast<int*>(sds), TypeMap<T>(),
         packedRecv.data(),
@@ -1841,10 +2769,15 @@ EL_NO_RELEASE_EXCEPT
     DEBUG_CSE
     if( count == 0 )
         return;
+    if( UseBinnedSum<Real>( op ) )
+    {
+        BinnedReduce( sbuf, rbuf, count, root, comm.comm );
+        return;
+    }
 
     MPI_Op opC = NativeOp<Real>( op );
     SafeMpi
-    ( MPI_Reduce
+    ( traffic::Reduce
       ( const_cast<Real*>(sbuf), rbuf, count, TypeMap<Real>(),
         opC, root, comm.comm ) );
 }
@@ -1858,13 +2791,20 @@ EL_NO_RELEASE_EXCEPT
     DEBUG_CSE
     if( count == 0 )
         return;
+    if( UseBinnedSum<Real>( op ) )
+    {
+        BinnedReduce
+        ( reinterpret_cast<const Real*>(sbuf), reinterpret_cast<Real*>(rbuf),
+          2*count, root, comm.comm );
+        return;
+    }
 
 #ifdef EL_AVOID_COMPLEX_MPI
     if( op == SUM )
     {
         MPI_Op opC = NativeOp<Real>( op );
         SafeMpi
-        ( MPI_Reduce
+        ( traffic::Reduce
           ( const_cast<Complex<Real>*>(sbuf),
             rbuf, 2*count, TypeMap<Real>(), opC, 
             root, comm.comm ) );
@@ -1873,14 +2813,14 @@ EL_NO_RELEASE_EXCEPT
     {
         MPI_Op opC = NativeOp<Complex<Real>>( op );
         SafeMpi
-        ( MPI_Reduce
+        ( traffic::Reduce
           ( const_cast<Complex<Real>*>(sbuf),
             rbuf, count, TypeMap<Complex<Real>>(), opC, root, comm.comm ) );
     }
 #else
     MPI_Op opC = NativeOp<Complex<Real>>( op );
     SafeMpi
-    ( MPI_Reduce
+    ( traffic::Reduce
       ( const_cast<Complex<Real>*>(sbuf), 
         rbuf, count, TypeMap<Complex<Real>>(), opC, root, comm.comm ) );
 #endif
@@ -1904,7 +2844,7 @@ EL_NO_RELEASE_EXCEPT
     if( commRank == root )
         ReserveSerialized( count, rbuf, packedRecv );
     SafeMpi
-    ( MPI_Reduce
+    ( traffic::Reduce
       ( packedSend.data(), packedRecv.data(), count, TypeMap<T>(),
         opC, root, comm.comm ) );
     if( commRank == root )
@@ -1941,6 +2881,11 @@ EL_NO_RELEASE_EXCEPT
     DEBUG_CSE
     if( count == 0 || Size(comm) == 1 )
         return;
+    if( UseBinnedSum<Real>( op ) )
+    {
+        BinnedReduce( buf, buf, count, root, comm.comm );
+        return;
+    }
 
     MPI_Op opC = NativeOp<Real>( op );
 
@@ -1948,13 +2893,13 @@ EL_NO_RELEASE_EXCEPT
     if( commRank == root )
     {
         SafeMpi
-        ( MPI_Reduce
+        ( traffic::Reduce
           ( MPI_IN_PLACE, buf, count, TypeMap<Real>(), opC, root, 
             comm.comm ) );
     }
     else
         SafeMpi
-        ( MPI_Reduce
+        ( traffic::Reduce
           ( buf, 0, count, TypeMap<Real>(), opC, root, comm.comm ) );
 }
 
@@ -1965,6 +2910,13 @@ EL_NO_RELEASE_EXCEPT
     DEBUG_CSE
     if( Size(comm) == 1 )
         return;
+    if( count != 0 && UseBinnedSum<Real>( op ) )
+    {
+        BinnedReduce
+        ( reinterpret_cast<Real*>(buf), reinterpret_cast<Real*>(buf),
+          2*count, root, comm.comm );
+        return;
+    }
     if( count != 0 )
     {
         const int commRank = Rank( comm );
@@ -1975,13 +2927,13 @@ EL_NO_RELEASE_EXCEPT
             if( commRank == root )
             {
                 SafeMpi
-                ( MPI_Reduce
+                ( traffic::Reduce
                   ( MPI_IN_PLACE, buf, 2*count, TypeMap<Real>(), opC, 
                     root, comm.comm ) );
             }
             else
                 SafeMpi
-                ( MPI_Reduce
+                ( traffic::Reduce
                   ( buf, 0, 2*count, TypeMap<Real>(), opC, root, comm.comm ) );
         }
         else
@@ -1990,13 +2942,13 @@ EL_NO_RELEASE_EXCEPT
             if( commRank == root )
             {
                 SafeMpi
-                ( MPI_Reduce
+                ( traffic::Reduce
                   ( MPI_IN_PLACE, buf, count, TypeMap<Complex<Real>>(), opC, 
                     root, comm.comm ) );
             }
             else
                 SafeMpi
-                ( MPI_Reduce
+                ( traffic::Reduce
                   ( buf, 0, count, TypeMap<Complex<Real>>(), opC, 
                     root, comm.comm ) );
         }
@@ -2005,13 +2957,13 @@ EL_NO_RELEASE_EXCEPT
         if( commRank == root )
         {
             SafeMpi
-            ( MPI_Reduce
+            ( traffic::Reduce
               ( MPI_IN_PLACE, buf, count, TypeMap<Complex<Real>>(), opC, 
                 root, comm.comm ) );
         }
         else
             SafeMpi
-            ( MPI_Reduce
+            ( traffic::Reduce
               ( buf, 0, count, TypeMap<Complex<Real>>(), opC, root, 
                 comm.comm ) );
 #endif
@@ -2037,7 +2989,7 @@ EL_NO_RELEASE_EXCEPT
     if( commRank == root )
         ReserveSerialized( count, buf, packedRecv );
     SafeMpi
-    ( MPI_Reduce
+    ( traffic::Reduce
       ( packedSend.data(), packedRecv.data(), count, TypeMap<T>(),
         opC, root, comm.comm ) );
     if( commRank == root )
@@ -2054,11 +3006,16 @@ void AllReduce( const Real* sbuf, Real* rbuf, int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    if( count != 0 && UseBinnedSum<Real>( op ) )
+    {
+        BinnedAllReduce( sbuf, rbuf, count, comm.comm );
+        return;
+    }
     if( count != 0 )
     {
         MPI_Op opC = NativeOp<Real>( op );
         SafeMpi
-        ( MPI_Allreduce
+        ( traffic::Allreduce
           ( const_cast<Real*>(sbuf), rbuf, count, TypeMap<Real>(), opC, 
             comm.comm ) );
     }
@@ -2070,6 +3027,13 @@ void AllReduce
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    if( count != 0 && UseBinnedSum<Real>( op ) )
+    {
+        BinnedAllReduce
+        ( reinterpret_cast<const Real*>(sbuf), reinterpret_cast<Real*>(rbuf),
+          2*count, comm.comm );
+        return;
+    }
     if( count != 0 )
     {
 #ifdef EL_AVOID_COMPLEX_MPI
@@ -2077,7 +3041,7 @@ EL_NO_RELEASE_EXCEPT
         {
             MPI_Op opC = NativeOp<Real>( op );
             SafeMpi
-            ( MPI_Allreduce
+            ( traffic::Allreduce
                 ( const_cast<Complex<Real>*>(sbuf),
                   rbuf, 2*count, TypeMap<Real>(), opC, comm.comm ) );
         }
@@ -2085,14 +3049,14 @@ EL_NO_RELEASE_EXCEPT
         {
             MPI_Op opC = NativeOp<Complex<Real>>( op );
             SafeMpi
-            ( MPI_Allreduce
+            ( traffic::Allreduce
               ( const_cast<Complex<Real>*>(sbuf),
                 rbuf, count, TypeMap<Complex<Real>>(), opC, comm.comm ) );
         }
 #else
         MPI_Op opC = NativeOp<Complex<Real>>( op );
         SafeMpi
-        ( MPI_Allreduce
+        ( traffic::Allreduce
           ( const_cast<Complex<Real>*>(sbuf), 
             rbuf, count, TypeMap<Complex<Real>>(), opC, comm.comm ) );
 #endif
@@ -2114,7 +3078,7 @@ EL_NO_RELEASE_EXCEPT
 
     ReserveSerialized( count, rbuf, packedRecv );
     SafeMpi
-    ( MPI_Allreduce
+    ( traffic::Allreduce
       ( packedSend.data(), packedRecv.data(), count, TypeMap<T>(),
         opC, comm.comm ) );
     Deserialize( count, packedRecv, rbuf );
@@ -2135,6 +3099,17 @@ T AllReduce( T sb, Comm comm )
 EL_NO_RELEASE_EXCEPT
 { return AllReduce( sb, SUM, comm ); }
 
+void AllReduceFolds( double* folds, int count, Comm comm )
+EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_CSE
+    if( count == 0 || Size(comm) == 1 )
+        return;
+    SafeMpi
+    ( traffic::Allreduce
+      ( MPI_IN_PLACE, folds, count, MPI_DOUBLE, MPI_SUM, comm.comm ) );
+}
+
 template<typename Real,typename>
 void AllReduce( Real* buf, int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
@@ -2142,10 +3117,15 @@ EL_NO_RELEASE_EXCEPT
     DEBUG_CSE
     if( count == 0 || Size(comm) == 1 )
         return;
+    if( UseBinnedSum<Real>( op ) )
+    {
+        BinnedAllReduce( buf, buf, count, comm.comm );
+        return;
+    }
 
     MPI_Op opC = NativeOp<Real>( op );
     SafeMpi
-    ( MPI_Allreduce
+    ( traffic::Allreduce
       ( MPI_IN_PLACE, buf, count, TypeMap<Real>(), opC, comm.comm ) );
 }
 
@@ -2156,27 +3136,34 @@ EL_NO_RELEASE_EXCEPT
     DEBUG_CSE
     if( count == 0 || Size(comm) == 1 )
         return;
+    if( UseBinnedSum<Real>( op ) )
+    {
+        BinnedAllReduce
+        ( reinterpret_cast<Real*>(buf), reinterpret_cast<Real*>(buf),
+          2*count, comm.comm );
+        return;
+    }
 
 #ifdef EL_AVOID_COMPLEX_MPI
     if( op == SUM )
     {
         MPI_Op opC = NativeOp<Real>( op );
         SafeMpi
-        ( MPI_Allreduce
+        ( traffic::Allreduce
           ( MPI_IN_PLACE, buf, 2*count, TypeMap<Real>(), opC, comm.comm ) );
     }
     else
     {
         MPI_Op opC = NativeOp<Complex<Real>>( op );
         SafeMpi
-        ( MPI_Allreduce
+        ( traffic::Allreduce
           ( MPI_IN_PLACE, buf, count, TypeMap<Complex<Real>>(), 
             opC, comm.comm ) );
     }
 #else
     MPI_Op opC = NativeOp<Complex<Real>>( op );
     SafeMpi
-    ( MPI_Allreduce
+    ( traffic::Allreduce
       ( MPI_IN_PLACE, buf, count, TypeMap<Complex<Real>>(), opC, 
         comm.comm ) );
 #endif
@@ -2196,7 +3183,7 @@ EL_NO_RELEASE_EXCEPT
 
     ReserveSerialized( count, buf, packedRecv );
     SafeMpi
-    ( MPI_Allreduce
+    ( traffic::Allreduce
       ( packedSend.data(), packedRecv.data(), count, TypeMap<T>(),
         opC, comm.comm ) );
     Deserialize( count, packedRecv, buf );
@@ -2214,6 +3201,11 @@ EL_NO_RELEASE_EXCEPT
     DEBUG_CSE
     if( rc == 0 )
         return;
+    if( UseBinnedSum<Real>( op ) )
+    {
+        BinnedReduceScatter( sbuf, rbuf, rc, comm.comm );
+        return;
+    }
 #ifdef EL_REDUCE_SCATTER_BLOCK_VIA_ALLREDUCE
     const int commSize = Size( comm );
     const int commRank = Rank( comm );
@@ -2222,7 +3214,7 @@ EL_NO_RELEASE_EXCEPT
 #elif defined(EL_HAVE_MPI_REDUCE_SCATTER_BLOCK)
     MPI_Op opC = NativeOp<Real>( op );
     SafeMpi
-    ( MPI_Reduce_scatter_block
+    ( traffic::Reduce_scatter_block
       ( sbuf, rbuf, rc, TypeMap<Real>(), opC, comm.comm ) );
 #else
     const int commSize = Size( comm );
@@ -2239,6 +3231,13 @@ EL_NO_RELEASE_EXCEPT
     DEBUG_CSE
     if( rc == 0 )
         return;
+    if( UseBinnedSum<Real>( op ) )
+    {
+        BinnedReduceScatter
+        ( reinterpret_cast<Real*>(sbuf), reinterpret_cast<Real*>(rbuf),
+          2*rc, comm.comm );
+        return;
+    }
 
 #ifdef EL_REDUCE_SCATTER_BLOCK_VIA_ALLREDUCE
     const int commSize = Size( comm );
@@ -2249,12 +3248,12 @@ EL_NO_RELEASE_EXCEPT
 # ifdef EL_AVOID_COMPLEX_MPI
     MPI_Op opC = NativeOp<Real>( op );
     SafeMpi
-    ( MPI_Reduce_scatter_block
+    ( traffic::Reduce_scatter_block
       ( sbuf, rbuf, 2*rc, TypeMap<Real>(), opC, comm.comm ) );
 # else
     MPI_Op opC = NativeOp<Complex<Real>>( op );
     SafeMpi
-    ( MPI_Reduce_scatter_block
+    ( traffic::Reduce_scatter_block
       ( sbuf, rbuf, rc, TypeMap<Complex<Real>>(), opC, comm.comm ) );
 # endif
 #else
@@ -2283,7 +3282,7 @@ EL_NO_RELEASE_EXCEPT
 
     ReserveSerialized( totalRecv, rbuf, packedRecv );
     SafeMpi
-    ( MPI_Reduce_scatter_block
+    ( traffic::Reduce_scatter_block
       ( packedSend.data(), packedRecv.data(), rc, TypeMap<T>(),
         opC, comm.comm ) );
 
@@ -2316,6 +3315,11 @@ EL_NO_RELEASE_EXCEPT
     DEBUG_CSE
     if( rc == 0 || Size(comm) == 1 )
         return;
+    if( UseBinnedSum<Real>( op ) )
+    {
+        BinnedReduceScatter( buf, buf, rc, comm.comm );
+        return;
+    }
 
 #ifdef EL_REDUCE_SCATTER_BLOCK_VIA_ALLREDUCE
     const int commSize = Size( comm );
@@ -2326,7 +3330,7 @@ EL_NO_RELEASE_EXCEPT
 #elif defined(EL_HAVE_MPI_REDUCE_SCATTER_BLOCK)
     MPI_Op opC = NativeOp<Real>( op );
     SafeMpi
-    ( MPI_Reduce_scatter_block
+    ( traffic::Reduce_scatter_block
       ( MPI_IN_PLACE, buf, rc, TypeMap<Real>(), opC, comm.comm ) );
 #else
     const int commSize = Size( comm );
@@ -2343,6 +3347,13 @@ EL_NO_RELEASE_EXCEPT
     DEBUG_CSE
     if( rc == 0 || Size(comm) == 1 )
         return;
+    if( UseBinnedSum<Real>( op ) )
+    {
+        BinnedReduceScatter
+        ( reinterpret_cast<Real*>(buf), reinterpret_cast<Real*>(buf),
+          2*rc, comm.comm );
+        return;
+    }
 
 #ifdef EL_REDUCE_SCATTER_BLOCK_VIA_ALLREDUCE
     const int commSize = Size( comm );
@@ -2354,12 +3365,12 @@ EL_NO_RELEASE_EXCEPT
 # ifdef EL_AVOID_COMPLEX_MPI
     MPI_Op opC = NativeOp<Real>( op );
     SafeMpi
-    ( MPI_Reduce_scatter_block
+    ( traffic::Reduce_scatter_block
       ( MPI_IN_PLACE, buf, 2*rc, TypeMap<Real>(), opC, comm.comm ) );
 # else
     MPI_Op opC = NativeOp<Complex<Real>>( op );
     SafeMpi
-    ( MPI_Reduce_scatter_block
+    ( traffic::Reduce_scatter_block
       ( MPI_IN_PLACE, buf, rc, TypeMap<Complex<Real>>(), opC, comm.comm ) );
 # endif
 #else
@@ -2388,7 +3399,7 @@ EL_NO_RELEASE_EXCEPT
 
     ReserveSerialized( totalRecv, buf, packedRecv );
     SafeMpi
-    ( MPI_Reduce_scatter_block
+    ( traffic::Reduce_scatter_block
       ( packedSend.data(), packedRecv.data(), rc, TypeMap<T>(),
         opC, comm.comm ) );
 
@@ -2412,7 +3423,7 @@ EL_NO_RELEASE_EXCEPT
     DEBUG_CSE
     MPI_Op opC = NativeOp<Real>( op );
     SafeMpi
-    ( MPI_Reduce_scatter
+    ( traffic::Reduce_scatter
       ( const_cast<Real*>(sbuf), 
         rbuf, const_cast<int*>(rcs), TypeMap<Real>(), opC, comm.comm ) );
 }
@@ -2434,7 +3445,7 @@ EL_NO_RELEASE_EXCEPT
         for( int i=0; i<p; ++i )
             rcsDoubled[i] = 2*rcs[i];
         SafeMpi
-        ( MPI_Reduce_scatter
+        ( traffic::Reduce_scatter
           ( const_cast<Complex<Real>*>(sbuf),
             rbuf, rcsDoubled.data(), TypeMap<Real>(), opC, comm.comm ) );
     }
@@ -2442,7 +3453,7 @@ EL_NO_RELEASE_EXCEPT
     {
         MPI_Op opC = NativeOp<Complex<Real>>( op );
         SafeMpi
-        ( MPI_Reduce_scatter
+        ( traffic::Reduce_scatter
           ( const_cast<Complex<Real>*>(sbuf),
             rbuf, const_cast<int*>(rcs), TypeMap<Complex<Real>>(), 
             opC, comm.comm ) );
@@ -2450,7 +3461,7 @@ EL_NO_RELEASE_EXCEPT
 #else
     MPI_Op opC = NativeOp<Complex<Real>>( op );
     SafeMpi
-    ( MPI_Reduce_scatter
+    ( traffic::Reduce_scatter
       ( const_cast<Complex<Real>*>(sbuf), 
         rbuf, const_cast<int*>(rcs), TypeMap<Complex<Real>>(), opC, 
         comm.comm ) );
@@ -2475,7 +3486,7 @@ EL_NO_RELEASE_EXCEPT
     Serialize( totalSend, sbuf, packedSend );
     ReserveSerialized( totalRecv, rbuf, packedRecv );
     SafeMpi
-    ( MPI_Reduce_scatter
+    ( traffic::Reduce_scatter
       ( packedSend.data(), packedRecv.data(), const_cast<int*>(rcs),
         TypeMap<T>(), opC, comm.comm ) );
     Deserialize( totalRecv, packedRecv, rbuf );
@@ -2512,7 +3523,7 @@ EL_NO_RELEASE_EXCEPT
     {
         MPI_Op opC = NativeOp<Real>( op );
         SafeMpi
-        ( MPI_Scan
+        ( traffic::Scan
           ( const_cast<Real*>(sbuf), rbuf, count, TypeMap<Real>(),
             opC, comm.comm ) );
     }
@@ -2532,7 +3543,7 @@ EL_NO_RELEASE_EXCEPT
         {
             MPI_Op opC = NativeOp<Real>( op );
             SafeMpi
-            ( MPI_Scan
+            ( traffic::Scan
               ( const_cast<Complex<Real>*>(sbuf),
                 rbuf, 2*count, TypeMap<Real>(), opC, comm.comm ) );
         }
@@ -2540,14 +3551,14 @@ EL_NO_RELEASE_EXCEPT
         {
             MPI_Op opC = NativeOp<Complex<Real>>( op );
             SafeMpi
-            ( MPI_Scan
+            ( traffic::Scan
               ( const_cast<Complex<Real>*>(sbuf),
                 rbuf, count, TypeMap<Complex<Real>>(), opC, comm.comm ) );
         }
 #else
         MPI_Op opC = NativeOp<Complex<Real>>( op );
         SafeMpi
-        ( MPI_Scan
+        ( traffic::Scan
           ( const_cast<Complex<Real>*>(sbuf), 
             rbuf, count, TypeMap<Complex<Real>>(), opC, comm.comm ) );
 #endif
@@ -2567,7 +3578,7 @@ EL_NO_RELEASE_EXCEPT
     Serialize( count, sbuf, packedSend );
     ReserveSerialized( count, rbuf, packedRecv );
     SafeMpi
-    ( MPI_Scan
+    ( traffic::Scan
       ( packedSend.data(), packedRecv.data(), count, TypeMap<T>(),
         opC, comm.comm ) );
     Deserialize( count, packedRecv, rbuf );
@@ -2605,7 +3616,7 @@ EL_NO_RELEASE_EXCEPT
     {
         MPI_Op opC = NativeOp<Real>( op );
         SafeMpi
-        ( MPI_Scan
+        ( traffic::Scan
           ( MPI_IN_PLACE, buf, count, TypeMap<Real>(), opC, comm.comm ) );
     }
 }
@@ -2622,21 +3633,21 @@ EL_NO_RELEASE_EXCEPT
         {
             MPI_Op opC = NativeOp<Real>( op );
             SafeMpi
-            ( MPI_Scan
+            ( traffic::Scan
               ( MPI_IN_PLACE, buf, 2*count, TypeMap<Real>(), opC, comm.comm ) );
         }
         else
         {
             MPI_Op opC = NativeOp<Complex<Real>>( op );
             SafeMpi
-            ( MPI_Scan
+            ( traffic::Scan
               ( MPI_IN_PLACE, buf, count, TypeMap<Complex<Real>>(), opC, 
                 comm.comm ) );
         }
 #else
         MPI_Op opC = NativeOp<Complex<Real>>( op );
         SafeMpi
-        ( MPI_Scan
+        ( traffic::Scan
           ( MPI_IN_PLACE, buf, count, TypeMap<Complex<Real>>(), opC, 
             comm.comm ) );
 #endif
@@ -2656,7 +3667,7 @@ EL_NO_RELEASE_EXCEPT
     Serialize( count, buf, packedSend );
     ReserveSerialized( count, buf, packedRecv );
     SafeMpi
-    ( MPI_Scan
+    ( traffic::Scan
       ( packedSend.data(), packedRecv.data(), count, TypeMap<T>(),
         opC, comm.comm ) );
     Deserialize( count, packedRecv, buf );
@@ -2702,7 +3713,7 @@ EL_NO_RELEASE_EXCEPT
     }
 
     // Ensure that recvs are posted before the sends
-    // (Invalid MPI_Irecv's have been observed otherwise)
+    // (Invalid traffic::Irecv's have been observed otherwise)
     Barrier( comm );
 
     for( int q=0; q<commSize; ++q )
@@ -2815,6 +3826,9 @@ EL_NO_RELEASE_EXCEPT
   EL_NO_RELEASE_EXCEPT; \
   template void AllGather( const T* sbuf, int sc, T* rbuf, int rc, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
+  template void IAllGather \
+  ( const T* sbuf, int sc, T* rbuf, int rc, Comm comm, \
+    Request<T>& request ); \
   template void AllGather \
   ( const T* sbuf, int sc, \
           T* rbuf, const int* rcs, const int* rds, Comm comm ) \
@@ -2829,6 +3843,9 @@ EL_NO_RELEASE_EXCEPT
   ( const T* sbuf, int sc, \
           T* rbuf, int rc, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
+  template void IAllToAll \
+  ( const T* sbuf, int sc, \
+          T* rbuf, int rc, Comm comm, Request<T>& request ); \
   template void AllToAll \
   ( const T* sbuf, const int* scs, const int* sds, \
           T* rbuf, const int* rcs, const int* rds, Comm comm ) \
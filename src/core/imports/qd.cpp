@@ -9,11 +9,23 @@
 #include <El-lite.hpp>
 
 #ifdef EL_HAVE_QD
+#include "./qd/SIMD.hpp"
 
 namespace {
 
 unsigned oldControlWord=0;
 
+El::qd::SIMD simd = El::qd::SIMD_NONE;
+
+#if defined(EL_HAVE_QD_AVX512) || defined(EL_HAVE_QD_AVX2)
+# define EL_HAVE_QD_SIMD
+// View the (high,low) pairs of double-doubles as an array of doubles
+const double* Words( const El::DoubleDouble* x )
+{ return reinterpret_cast<const double*>(x); }
+double* Words( El::DoubleDouble* x )
+{ return reinterpret_cast<double*>(x); }
+#endif
+
 }
 
 namespace El {
@@ -21,6 +33,7 @@ namespace El {
 void InitializeQD()
 {
     fpu_fix_start( &::oldControlWord );
+    ::simd = qd::DetectedSIMD();
 }
 
 void FinalizeQD()
@@ -117,5 +130,169 @@ QuadDouble::operator long long int() const
     return result;
 }
 
+namespace qd {
+
+static_assert
+( sizeof(DoubleDouble) == 2*sizeof(double),
+  "DoubleDouble must consist of exactly two doubles" );
+
+SIMD DetectedSIMD()
+{
+#ifdef EL_HAVE_QD_SIMD
+    __builtin_cpu_init();
+#endif
+#ifdef EL_HAVE_QD_AVX512
+    if( __builtin_cpu_supports("avx512f") )
+        return SIMD_AVX512;
+#endif
+#ifdef EL_HAVE_QD_AVX2
+    if( __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma") )
+        return SIMD_AVX2;
+#endif
+    return SIMD_NONE;
+}
+
+SIMD GetSIMD()
+{ return ::simd; }
+
+void SetSIMD( SIMD simd )
+{
+    const SIMD detected = DetectedSIMD();
+    ::simd = ( simd < detected ? simd : detected );
+}
+
+#ifdef EL_HAVE_QD_SIMD
+
+bool Axpy
+( Int n, const DoubleDouble& alpha, const DoubleDouble* x, DoubleDouble* y )
+{
+    switch( ::simd )
+    {
+#ifdef EL_HAVE_QD_AVX512
+    case SIMD_AVX512:
+        avx512::Axpy( n, Words(&alpha), Words(x), Words(y) );
+        return true;
+#endif
+#ifdef EL_HAVE_QD_AVX2
+    case SIMD_AVX2:
+        avx2::Axpy( n, Words(&alpha), Words(x), Words(y) );
+        return true;
+#endif
+    default:
+        return false;
+    }
+}
+
+bool Dot
+( Int n, const DoubleDouble* x, const DoubleDouble* y, DoubleDouble& result )
+{
+    switch( ::simd )
+    {
+#ifdef EL_HAVE_QD_AVX512
+    case SIMD_AVX512:
+        avx512::Dot( n, Words(x), Words(y), Words(&result) );
+        return true;
+#endif
+#ifdef EL_HAVE_QD_AVX2
+    case SIMD_AVX2:
+        avx2::Dot( n, Words(x), Words(y), Words(&result) );
+        return true;
+#endif
+    default:
+        return false;
+    }
+}
+
+bool Nrm2( Int n, const DoubleDouble* x, DoubleDouble& result )
+{
+    double maxAbs;
+    switch( ::simd )
+    {
+#ifdef EL_HAVE_QD_AVX512
+    case SIMD_AVX512: maxAbs = avx512::MaxAbs( n, Words(x) ); break;
+#endif
+#ifdef EL_HAVE_QD_AVX2
+    case SIMD_AVX2:   maxAbs = avx2::MaxAbs( n, Words(x) ); break;
+#endif
+    default:
+        return false;
+    }
+    if( maxAbs == 0. || !std::isfinite(maxAbs) )
+    {
+        result = maxAbs;
+        return true;
+    }
+
+    // Scale by a power of two so that the largest entry lies in [1/2,1),
+    // which keeps the scaling exact
+    int exponent;
+    std::frexp( maxAbs, &exponent );
+    const double scale = std::ldexp( 1., -exponent );
+    DoubleDouble scaledSquare;
+    switch( ::simd )
+    {
+#ifdef EL_HAVE_QD_AVX512
+    case SIMD_AVX512:
+        avx512::ScaledSumOfSquares
+        ( n, Words(x), scale, Words(&scaledSquare) );
+        break;
+#endif
+#ifdef EL_HAVE_QD_AVX2
+    case SIMD_AVX2:
+        avx2::ScaledSumOfSquares( n, Words(x), scale, Words(&scaledSquare) );
+        break;
+#endif
+    default:
+        break;
+    }
+    result = Sqrt(scaledSquare);
+    result *= std::ldexp( 1., exponent );
+    return true;
+}
+
+bool GemmMicroKernel
+( Int kc, const DoubleDouble& alpha,
+  const DoubleDouble* A, const DoubleDouble* B,
+  DoubleDouble* C, Int CLDim )
+{
+    switch( ::simd )
+    {
+#ifdef EL_HAVE_QD_AVX512
+    case SIMD_AVX512:
+        avx512::GemmMicroKernel
+        ( kc, Words(&alpha), Words(A), Words(B), Words(C), CLDim );
+        return true;
+#endif
+#ifdef EL_HAVE_QD_AVX2
+    case SIMD_AVX2:
+        avx2::GemmMicroKernel
+        ( kc, Words(&alpha), Words(A), Words(B), Words(C), CLDim );
+        return true;
+#endif
+    default:
+        return false;
+    }
+}
+#else
+bool Axpy
+( Int n, const DoubleDouble& alpha, const DoubleDouble* x, DoubleDouble* y )
+{ return false; }
+
+bool Dot
+( Int n, const DoubleDouble* x, const DoubleDouble* y, DoubleDouble& result )
+{ return false; }
+
+bool Nrm2( Int n, const DoubleDouble* x, DoubleDouble& result )
+{ return false; }
+
+bool GemmMicroKernel
+( Int kc, const DoubleDouble& alpha,
+  const DoubleDouble* A, const DoubleDouble* B,
+  DoubleDouble* C, Int CLDim )
+{ return false; }
+#endif // ifdef EL_HAVE_QD_SIMD
+
+} // namespace qd
+
 } // namespace El
 #endif // ifdef EL_HAVE_QD
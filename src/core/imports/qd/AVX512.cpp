@@ -0,0 +1,79 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: This file is compiled with "-mavx512 -mfma -ffp-contract=off" and must
+//       not include any Elemental headers other than config.h (see SIMD.hpp)
+#include <El/config.h>
+#if defined(EL_HAVE_QD) && defined(EL_HAVE_QD_AVX512)
+#include <immintrin.h>
+
+#include "./SIMD.hpp"
+#include "./SIMDKernels.hpp"
+
+namespace {
+
+struct AVX512Lanes
+{
+    typedef __m512d Reg;
+    static const long width = 8;
+
+    static Reg Set1( double alpha ) { return _mm512_set1_pd(alpha); }
+    static Reg Add( Reg a, Reg b ) { return _mm512_add_pd(a,b); }
+    static Reg Sub( Reg a, Reg b ) { return _mm512_sub_pd(a,b); }
+    static Reg Mul( Reg a, Reg b ) { return _mm512_mul_pd(a,b); }
+    static Reg FMA( Reg a, Reg b, Reg c ) { return _mm512_fmadd_pd(a,b,c); }
+    static Reg FMS( Reg a, Reg b, Reg c ) { return _mm512_fmsub_pd(a,b,c); }
+    static Reg Abs( Reg a ) { return _mm512_abs_pd(a); }
+    static Reg Max( Reg a, Reg b ) { return _mm512_max_pd(a,b); }
+
+    // The high words of pairs (0,4,1,5,2,6,3,7) and the corresponding low
+    // words
+    static void Load( const double* x, Reg& hi, Reg& lo )
+    {
+        const Reg x0 = _mm512_loadu_pd( x );
+        const Reg x1 = _mm512_loadu_pd( x+8 );
+        hi = _mm512_unpacklo_pd( x0, x1 );
+        lo = _mm512_unpackhi_pd( x0, x1 );
+    }
+    static void Store( double* x, Reg hi, Reg lo )
+    {
+        _mm512_storeu_pd( x,   _mm512_unpacklo_pd(hi,lo) );
+        _mm512_storeu_pd( x+8, _mm512_unpackhi_pd(hi,lo) );
+    }
+    static void Spill( Reg a, double* x ) { _mm512_storeu_pd( x, a ); }
+};
+
+} // anonymous namespace
+
+namespace El {
+namespace qd {
+namespace avx512 {
+
+void Axpy( long n, const double* alpha, const double* x, double* y )
+{ ::Axpy<AVX512Lanes>( n, alpha, x, y ); }
+
+void Dot( long n, const double* x, const double* y, double* result )
+{ ::Dot<AVX512Lanes>( n, x, y, result ); }
+
+double MaxAbs( long n, const double* x )
+{ return ::MaxAbs<AVX512Lanes>( n, x ); }
+
+void ScaledSumOfSquares
+( long n, const double* x, double scale, double* result )
+{ ::ScaledSumOfSquares<AVX512Lanes>( n, x, scale, result ); }
+
+void GemmMicroKernel
+( long kc, const double* alpha, const double* A, const double* B,
+  double* C, long CLDim )
+{ ::GemmMicroKernel<AVX512Lanes>( kc, alpha, A, B, C, CLDim ); }
+
+} // namespace avx512
+} // namespace qd
+} // namespace El
+
+#endif // if defined(EL_HAVE_QD) && defined(EL_HAVE_QD_AVX512)
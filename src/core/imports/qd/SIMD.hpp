@@ -0,0 +1,41 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_IMPORTS_QD_SIMD_HPP
+#define EL_IMPORTS_QD_SIMD_HPP
+
+// NOTE: This header is included by translation units which are compiled with
+//       instruction-set-specific flags and must therefore not pull in any
+//       other Elemental headers, as their inline functions could otherwise be
+//       emitted with instructions that the running CPU does not support.
+//
+// Each double-double occupies two consecutive doubles (the high and low
+// words), and each kernel processes contiguous arrays.
+
+namespace El {
+namespace qd {
+
+#define EL_QD_SIMD_KERNELS \
+  void Axpy( long n, const double* alpha, const double* x, double* y ); \
+  void Dot( long n, const double* x, const double* y, double* result ); \
+  double MaxAbs( long n, const double* x ); \
+  void ScaledSumOfSquares \
+  ( long n, const double* x, double scale, double* result ); \
+  void GemmMicroKernel \
+  ( long kc, const double* alpha, const double* A, const double* B, \
+    double* C, long CLDim );
+
+namespace avx2 { EL_QD_SIMD_KERNELS }
+namespace avx512 { EL_QD_SIMD_KERNELS }
+
+#undef EL_QD_SIMD_KERNELS
+
+} // namespace qd
+} // namespace El
+
+#endif // ifndef EL_IMPORTS_QD_SIMD_HPP
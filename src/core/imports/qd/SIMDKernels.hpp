@@ -0,0 +1,294 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_IMPORTS_QD_SIMDKERNELS_HPP
+#define EL_IMPORTS_QD_SIMDKERNELS_HPP
+
+// Double-double kernels written in terms of a 'Lanes' policy which provides
+// a vector register type, its width, and the elementary operations upon it.
+// A double-double vector is held as a pair of registers containing the high
+// and low words; Load and Store convert between this representation and
+// arrays of consecutive (high,low) pairs. The lanes need not be stored in
+// their natural order as long as Store inverts Load.
+//
+// NOTE: The translation units which instantiate these kernels must be
+//       compiled without floating-point contraction (e.g.,
+//       -ffp-contract=off) since fusing the multiplications and additions
+//       would break the error-free transformations.
+
+#include <cmath>
+
+namespace {
+
+struct ScalarLanes
+{
+    typedef double Reg;
+    static const long width = 1;
+
+    static Reg Set1( double alpha ) { return alpha; }
+    static Reg Add( Reg a, Reg b ) { return a + b; }
+    static Reg Sub( Reg a, Reg b ) { return a - b; }
+    static Reg Mul( Reg a, Reg b ) { return a * b; }
+    // a b + c and a b - c with a single rounding
+    static Reg FMA( Reg a, Reg b, Reg c ) { return std::fma(a,b,c); }
+    static Reg FMS( Reg a, Reg b, Reg c ) { return std::fma(a,b,-c); }
+    static Reg Abs( Reg a ) { return std::fabs(a); }
+    static Reg Max( Reg a, Reg b ) { return a > b ? a : b; }
+
+    static void Load( const double* x, Reg& hi, Reg& lo )
+    { hi = x[0]; lo = x[1]; }
+    static void Store( double* x, Reg hi, Reg lo )
+    { x[0] = hi; x[1] = lo; }
+    // Write the 'width' lanes of a register into an array
+    static void Spill( Reg a, double* x ) { x[0] = a; }
+};
+
+template<typename Lanes>
+struct DD
+{
+    typedef typename Lanes::Reg Reg;
+
+    // s + e = a + b exactly
+    static void TwoSum( Reg a, Reg b, Reg& s, Reg& e )
+    {
+        s = Lanes::Add( a, b );
+        const Reg bb = Lanes::Sub( s, a );
+        e = Lanes::Add
+            ( Lanes::Sub( a, Lanes::Sub(s,bb) ), Lanes::Sub( b, bb ) );
+    }
+
+    // s + e = a + b exactly, assuming |a| >= |b|
+    static void QuickTwoSum( Reg a, Reg b, Reg& s, Reg& e )
+    {
+        s = Lanes::Add( a, b );
+        e = Lanes::Sub( b, Lanes::Sub( s, a ) );
+    }
+
+    // (cHi,cLo) := (aHi,aLo) + (bHi,bLo) (the accurate variant)
+    static void Add
+    ( Reg aHi, Reg aLo, Reg bHi, Reg bLo, Reg& cHi, Reg& cLo )
+    {
+        Reg s1, s2, t1, t2;
+        TwoSum( aHi, bHi, s1, s2 );
+        TwoSum( aLo, bLo, t1, t2 );
+        s2 = Lanes::Add( s2, t1 );
+        QuickTwoSum( s1, s2, s1, s2 );
+        s2 = Lanes::Add( s2, t2 );
+        QuickTwoSum( s1, s2, cHi, cLo );
+    }
+
+    // (cHi,cLo) := (aHi,aLo) (bHi,bLo), where the error of the leading
+    // product is recovered exactly with an FMA (TwoProd)
+    static void Mul
+    ( Reg aHi, Reg aLo, Reg bHi, Reg bLo, Reg& cHi, Reg& cLo )
+    {
+        const Reg p1 = Lanes::Mul( aHi, bHi );
+        Reg p2 = Lanes::FMS( aHi, bHi, p1 );
+        p2 = Lanes::FMA( aHi, bLo, p2 );
+        p2 = Lanes::FMA( aLo, bHi, p2 );
+        QuickTwoSum( p1, p2, cHi, cLo );
+    }
+};
+
+// y(0:n) += alpha x(0:n) for the largest multiple n of the width which is at
+// most 'size'; returns n
+template<typename Lanes>
+long AxpyBody( long size, const double* alpha, const double* x, double* y )
+{
+    typedef typename Lanes::Reg Reg;
+    const long w = Lanes::width;
+    const Reg alphaHi = Lanes::Set1( alpha[0] );
+    const Reg alphaLo = Lanes::Set1( alpha[1] );
+    long i=0;
+    for( ; i+w<=size; i+=w )
+    {
+        Reg xHi, xLo, yHi, yLo, pHi, pLo;
+        Lanes::Load( &x[2*i], xHi, xLo );
+        Lanes::Load( &y[2*i], yHi, yLo );
+        DD<Lanes>::Mul( alphaHi, alphaLo, xHi, xLo, pHi, pLo );
+        DD<Lanes>::Add( yHi, yLo, pHi, pLo, yHi, yLo );
+        Lanes::Store( &y[2*i], yHi, yLo );
+    }
+    return i;
+}
+
+template<typename Lanes>
+void Axpy( long n, const double* alpha, const double* x, double* y )
+{
+    const long i = AxpyBody<Lanes>( n, alpha, x, y );
+    AxpyBody<ScalarLanes>( n-i, alpha, &x[2*i], &y[2*i] );
+}
+
+// Sum the lanes of (sumHi,sumLo) into (resultHi,resultLo)
+template<typename Lanes>
+void AccumulateLanes
+( typename Lanes::Reg sumHi, typename Lanes::Reg sumLo,
+  double& resultHi, double& resultLo )
+{
+    const long w = Lanes::width;
+    double hi[w], lo[w];
+    Lanes::Spill( sumHi, hi );
+    Lanes::Spill( sumLo, lo );
+    for( long k=0; k<w; ++k )
+        DD<ScalarLanes>::Add
+        ( resultHi, resultLo, hi[k], lo[k], resultHi, resultLo );
+}
+
+template<typename Lanes>
+long DotBody
+( long size, const double* x, const double* y,
+  double& resultHi, double& resultLo )
+{
+    typedef typename Lanes::Reg Reg;
+    const long w = Lanes::width;
+    Reg sumHi = Lanes::Set1( 0 ), sumLo = Lanes::Set1( 0 );
+    long i=0;
+    for( ; i+w<=size; i+=w )
+    {
+        Reg xHi, xLo, yHi, yLo, pHi, pLo;
+        Lanes::Load( &x[2*i], xHi, xLo );
+        Lanes::Load( &y[2*i], yHi, yLo );
+        DD<Lanes>::Mul( xHi, xLo, yHi, yLo, pHi, pLo );
+        DD<Lanes>::Add( sumHi, sumLo, pHi, pLo, sumHi, sumLo );
+    }
+    AccumulateLanes<Lanes>( sumHi, sumLo, resultHi, resultLo );
+    return i;
+}
+
+template<typename Lanes>
+void Dot( long n, const double* x, const double* y, double* result )
+{
+    result[0] = result[1] = 0;
+    const long i = DotBody<Lanes>( n, x, y, result[0], result[1] );
+    DotBody<ScalarLanes>( n-i, &x[2*i], &y[2*i], result[0], result[1] );
+}
+
+// The maximum absolute value of the high words
+template<typename Lanes>
+long MaxAbsBody( long size, const double* x, double& maxAbs )
+{
+    typedef typename Lanes::Reg Reg;
+    const long w = Lanes::width;
+    Reg maxAbsVec = Lanes::Set1( 0 );
+    long i=0;
+    for( ; i+w<=size; i+=w )
+    {
+        Reg xHi, xLo;
+        Lanes::Load( &x[2*i], xHi, xLo );
+        maxAbsVec = Lanes::Max( maxAbsVec, Lanes::Abs(xHi) );
+    }
+    double lanes[w];
+    Lanes::Spill( maxAbsVec, lanes );
+    for( long k=0; k<w; ++k )
+        maxAbs = ( lanes[k] > maxAbs ? lanes[k] : maxAbs );
+    return i;
+}
+
+template<typename Lanes>
+double MaxAbs( long n, const double* x )
+{
+    double maxAbs = 0;
+    const long i = MaxAbsBody<Lanes>( n, x, maxAbs );
+    MaxAbsBody<ScalarLanes>( n-i, &x[2*i], maxAbs );
+    return maxAbs;
+}
+
+// The sum of the squares of scale*x, where 'scale' should be a power of two
+// so that the scaling is exact
+template<typename Lanes>
+long ScaledSumOfSquaresBody
+( long size, const double* x, double scale,
+  double& resultHi, double& resultLo )
+{
+    typedef typename Lanes::Reg Reg;
+    const long w = Lanes::width;
+    const Reg scaleVec = Lanes::Set1( scale );
+    Reg sumHi = Lanes::Set1( 0 ), sumLo = Lanes::Set1( 0 );
+    long i=0;
+    for( ; i+w<=size; i+=w )
+    {
+        Reg xHi, xLo, pHi, pLo;
+        Lanes::Load( &x[2*i], xHi, xLo );
+        xHi = Lanes::Mul( xHi, scaleVec );
+        xLo = Lanes::Mul( xLo, scaleVec );
+        DD<Lanes>::Mul( xHi, xLo, xHi, xLo, pHi, pLo );
+        DD<Lanes>::Add( sumHi, sumLo, pHi, pLo, sumHi, sumLo );
+    }
+    AccumulateLanes<Lanes>( sumHi, sumLo, resultHi, resultLo );
+    return i;
+}
+
+template<typename Lanes>
+void ScaledSumOfSquares
+( long n, const double* x, double scale, double* result )
+{
+    result[0] = result[1] = 0;
+    const long i =
+      ScaledSumOfSquaresBody<Lanes>( n, x, scale, result[0], result[1] );
+    ScaledSumOfSquaresBody<ScalarLanes>
+    ( n-i, &x[2*i], scale, result[0], result[1] );
+}
+
+// C := alpha A B + C for an 8 x kc column-major A and a kc x 4 row-major B
+// (i.e., the packed micro-panels of blas::Gemm)
+template<typename Lanes>
+void GemmMicroKernel
+( long kc, const double* alpha, const double* A, const double* B,
+  double* C, long CLDim )
+{
+    typedef typename Lanes::Reg Reg;
+    const long MR = 8;
+    const long NR = 4;
+    const long w = Lanes::width;
+    const long numVecs = MR / w;
+
+    Reg accHi[numVecs*NR], accLo[numVecs*NR];
+    for( long t=0; t<numVecs*NR; ++t )
+        accHi[t] = accLo[t] = Lanes::Set1( 0 );
+
+    for( long l=0; l<kc; ++l )
+    {
+        Reg aHi[numVecs], aLo[numVecs];
+        for( long v=0; v<numVecs; ++v )
+            Lanes::Load( &A[2*(v*w+l*MR)], aHi[v], aLo[v] );
+        for( long j=0; j<NR; ++j )
+        {
+            const Reg bHi = Lanes::Set1( B[2*(j+l*NR)] );
+            const Reg bLo = Lanes::Set1( B[2*(j+l*NR)+1] );
+            for( long v=0; v<numVecs; ++v )
+            {
+                Reg pHi, pLo;
+                DD<Lanes>::Mul( aHi[v], aLo[v], bHi, bLo, pHi, pLo );
+                DD<Lanes>::Add
+                ( accHi[v+j*numVecs], accLo[v+j*numVecs], pHi, pLo,
+                  accHi[v+j*numVecs], accLo[v+j*numVecs] );
+            }
+        }
+    }
+
+    const Reg alphaHi = Lanes::Set1( alpha[0] );
+    const Reg alphaLo = Lanes::Set1( alpha[1] );
+    for( long j=0; j<NR; ++j )
+    {
+        for( long v=0; v<numVecs; ++v )
+        {
+            Reg pHi, pLo, cHi, cLo;
+            DD<Lanes>::Mul
+            ( alphaHi, alphaLo, accHi[v+j*numVecs], accLo[v+j*numVecs],
+              pHi, pLo );
+            double* c = &C[2*(v*w+j*CLDim)];
+            Lanes::Load( c, cHi, cLo );
+            DD<Lanes>::Add( cHi, cLo, pHi, pLo, cHi, cLo );
+            Lanes::Store( c, cHi, cLo );
+        }
+    }
+}
+
+} // anonymous namespace
+
+#endif // ifndef EL_IMPORTS_QD_SIMDKERNELS_HPP
@@ -13,6 +13,12 @@ namespace {
 // A common Mersenne twister configuration
 std::mt19937 generator;
 
+// The (process-independent) seed and number of streams of the counter-based
+// generator
+unsigned long long streamSeed;
+unsigned long long numRandomStreams = 0;
+bool counterBasedRandom = true;
+
 #ifdef EL_HAVE_MPC
 gmp_randstate_t gmpRandState;
 #endif
@@ -31,6 +37,11 @@ void InitializeRandom( bool deterministic )
 
     srand( seed );
 
+    // The streams must agree on every process
+    Int streamSecs = secs;
+    mpi::Broadcast( streamSecs, 0, mpi::COMM_WORLD );
+    SetRandomStreamSeed( streamSecs );
+
 #ifdef EL_HAVE_MPC
     mpfr::SetMinIntBits( 256 );
     mpfr::SetPrecision( 256 );
@@ -49,6 +60,30 @@ void FinalizeRandom()
 std::mt19937& Generator()
 { return ::generator; }
 
+bool CounterBasedRandom()
+{ return ::counterBasedRandom; }
+
+void SetCounterBasedRandom( bool counterBased )
+{ ::counterBasedRandom = counterBased; }
+
+unsigned long long RandomStreamSeed()
+{ return ::streamSeed; }
+
+void SetRandomStreamSeed( unsigned long long seed )
+{
+    ::streamSeed = seed;
+    ::numRandomStreams = 0;
+}
+
+RandomStream NewRandomStream( mpi::Comm comm )
+{
+    DEBUG_CSE
+    const unsigned long long stream =
+      mpi::AllReduce( ::numRandomStreams, mpi::MAX, comm );
+    ::numRandomStreams = stream+1;
+    return RandomStream( ::streamSeed, stream );
+}
+
 #ifdef EL_HAVE_MPC
 namespace mpfr {
 
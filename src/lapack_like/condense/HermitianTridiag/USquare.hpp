@@ -53,7 +53,7 @@ void USquare
     DistMatrix<F,MC,  STAR> APan_MC_STAR(g), WPan_MC_STAR(g);
     DistMatrix<F,MR,  STAR> APan_MR_STAR(g), WPan_MR_STAR(g);
 
-    const Int bsize = Blocksize();
+    const Int bsize = TunedBlocksize<F>( "HermitianTridiag", g, n );
     const Int kLast = LastOffset( n, bsize );
     for( Int k=kLast; k>=0; k-=bsize )
     {
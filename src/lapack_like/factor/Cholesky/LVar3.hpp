@@ -78,7 +78,7 @@ void LVar3( Matrix<F>& A )
           LogicError("Can only compute Cholesky factor of square matrices");
     )
     const Int n = A.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = TunedBlocksize<F>( "Cholesky", n );
     for( Int k=0; k<n; k+=bsize )
     {
         const Int nb = Min(bsize,n-k);
@@ -105,7 +105,7 @@ void ReverseLVar3( Matrix<F>& A )
           LogicError("Can only compute Cholesky factor of square matrices");
     )
     const Int n = A.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = TunedBlocksize<F>( "Cholesky", n );
     const Int kLast = LastOffset( n, bsize );
     for( Int k=kLast; k>=0; k-=bsize )
     {
@@ -137,14 +137,14 @@ void LVar3( AbstractDistMatrix<F>& APre )
     DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
     auto& A = AProx.Get();
 
-    DistMatrix<F,STAR,STAR> A11_STAR_STAR(g);
-    DistMatrix<F,VC,  STAR> A21_VC_STAR(g);
-    DistMatrix<F,VR,  STAR> A21_VR_STAR(g);
-    DistMatrix<F,STAR,MC  > A21Trans_STAR_MC(g);
-    DistMatrix<F,STAR,MR  > A21Adj_STAR_MR(g);
+    WorkspaceDistMatrix<F,STAR,STAR> A11_STAR_STAR(g);
+    WorkspaceDistMatrix<F,VC,  STAR> A21_VC_STAR(g);
+    WorkspaceDistMatrix<F,VR,  STAR> A21_VR_STAR(g);
+    WorkspaceDistMatrix<F,STAR,MC  > A21Trans_STAR_MC(g);
+    WorkspaceDistMatrix<F,STAR,MR  > A21Adj_STAR_MR(g);
 
     const Int n = A.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = TunedBlocksize<F>( "Cholesky", g, n );
     for( Int k=0; k<n; k+=bsize )
     {
         const Int nb = Min(bsize,n-k);
@@ -195,13 +195,13 @@ void ReverseLVar3( AbstractDistMatrix<F>& APre )
     DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
     auto& A = AProx.Get();
 
-    DistMatrix<F,STAR,STAR> A11_STAR_STAR(g);
-    DistMatrix<F,STAR,VR  > A10_STAR_VR(g);
-    DistMatrix<F,STAR,MC  > A10_STAR_MC(g);
-    DistMatrix<F,STAR,MR  > A10_STAR_MR(g);
+    WorkspaceDistMatrix<F,STAR,STAR> A11_STAR_STAR(g);
+    WorkspaceDistMatrix<F,STAR,VR  > A10_STAR_VR(g);
+    WorkspaceDistMatrix<F,STAR,MC  > A10_STAR_MC(g);
+    WorkspaceDistMatrix<F,STAR,MR  > A10_STAR_MR(g);
 
     const Int n = A.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = TunedBlocksize<F>( "Cholesky", g, n );
     const Int kLast = LastOffset( n, bsize );
     for( Int k=kLast; k>=0; k-=bsize )
     {
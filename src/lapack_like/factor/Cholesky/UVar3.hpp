@@ -83,7 +83,7 @@ void UVar3( Matrix<F>& A )
           LogicError("Can only compute Cholesky factor of square matrices");
     )
     const Int n = A.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = TunedBlocksize<F>( "Cholesky", n );
     for( Int k=0; k<n; k+=bsize )
     {
         const Int nb = Min(bsize,n-k);
@@ -110,7 +110,7 @@ void ReverseUVar3( Matrix<F>& A )
           LogicError("Can only compute Cholesky factor of square matrices");
     )
     const Int n = A.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = TunedBlocksize<F>( "Cholesky", n );
     const Int kLast = LastOffset( n, bsize );
     for( Int k=kLast; k>=0; k-=bsize )
     {
@@ -142,13 +142,13 @@ void UVar3( AbstractDistMatrix<F>& APre )
     DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
     auto& A = AProx.Get();
 
-    DistMatrix<F,STAR,STAR> A11_STAR_STAR(g);
-    DistMatrix<F,STAR,VR  > A12_STAR_VR(g);
-    DistMatrix<F,STAR,MC  > A12_STAR_MC(g);
-    DistMatrix<F,STAR,MR  > A12_STAR_MR(g);
+    WorkspaceDistMatrix<F,STAR,STAR> A11_STAR_STAR(g);
+    WorkspaceDistMatrix<F,STAR,VR  > A12_STAR_VR(g);
+    WorkspaceDistMatrix<F,STAR,MC  > A12_STAR_MC(g);
+    WorkspaceDistMatrix<F,STAR,MR  > A12_STAR_MR(g);
 
     const Int n = A.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = TunedBlocksize<F>( "Cholesky", g, n );
     for( Int k=0; k<n; k+=bsize )
     {
         const Int nb = Min(bsize,n-k);
@@ -192,14 +192,14 @@ void ReverseUVar3( AbstractDistMatrix<F>& APre )
     DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
     auto& A = AProx.Get();
 
-    DistMatrix<F,STAR,STAR> A11_STAR_STAR(g);
-    DistMatrix<F,VC,  STAR> A01_VC_STAR(g);
-    DistMatrix<F,VR,  STAR> A01_VR_STAR(g);
-    DistMatrix<F,STAR,MC  > A01Trans_STAR_MC(g);
-    DistMatrix<F,STAR,MR  > A01Adj_STAR_MR(g);
+    WorkspaceDistMatrix<F,STAR,STAR> A11_STAR_STAR(g);
+    WorkspaceDistMatrix<F,VC,  STAR> A01_VC_STAR(g);
+    WorkspaceDistMatrix<F,VR,  STAR> A01_VR_STAR(g);
+    WorkspaceDistMatrix<F,STAR,MC  > A01Trans_STAR_MC(g);
+    WorkspaceDistMatrix<F,STAR,MR  > A01Adj_STAR_MR(g);
 
     const Int n = A.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = TunedBlocksize<F>( "Cholesky", g, n );
     const Int kLast = LastOffset( n, bsize );
     for( Int k=kLast; k>=0; k-=bsize )
     {
@@ -25,7 +25,7 @@ void LU( Matrix<F>& A )
     const Int m = A.Height();
     const Int n = A.Width();
     const Int minDim = Min(m,n);
-    const Int bsize = Blocksize();
+    const Int bsize = TunedBlocksize<F>( "LU", minDim );
     for( Int k=0; k<minDim; k+=bsize )
     {
         const Int nb = Min(bsize,minDim-k);
@@ -52,15 +52,15 @@ void LU( ElementalMatrix<F>& APre )
     auto& A = AProx.Get();
 
     const Grid& g = A.Grid();
-    DistMatrix<F,STAR,STAR> A11_STAR_STAR(g);
-    DistMatrix<F,MC,  STAR> A21_MC_STAR(g);
-    DistMatrix<F,STAR,VR  > A12_STAR_VR(g);
-    DistMatrix<F,STAR,MR  > A12_STAR_MR(g);
+    WorkspaceDistMatrix<F,STAR,STAR> A11_STAR_STAR(g);
+    WorkspaceDistMatrix<F,MC,  STAR> A21_MC_STAR(g);
+    WorkspaceDistMatrix<F,STAR,VR  > A12_STAR_VR(g);
+    WorkspaceDistMatrix<F,STAR,MR  > A12_STAR_MR(g);
 
     const Int m = A.Height();
     const Int n = A.Width();
     const Int minDim = Min(m,n);
-    const Int bsize = Blocksize();
+    const Int bsize = TunedBlocksize<F>( "LU", g, minDim );
     for( Int k=0; k<minDim; k+=bsize )
     {
         const Int nb = Min(bsize,minDim-k);
@@ -109,7 +109,7 @@ void LU( Matrix<F>& A, Permutation& P )
     const Int m = A.Height();
     const Int n = A.Width();
     const Int minDim = Min(m,n);
-    const Int bsize = Blocksize();
+    const Int bsize = TunedBlocksize<F>( "LU", minDim );
 
     P.MakeIdentity( m );
     P.ReserveSwaps( minDim );
@@ -160,10 +160,10 @@ void LU( ElementalMatrix<F>& APre, DistPermutation& P )
     auto& A = AProx.Get();
 
     const Grid& g = A.Grid();
-    DistMatrix<F,  STAR,STAR> A11_STAR_STAR(g);
-    DistMatrix<F,  MC,  STAR> A21_MC_STAR(g);
-    DistMatrix<F,  STAR,VR  > A12_STAR_VR(g);
-    DistMatrix<F,  STAR,MR  > A12_STAR_MR(g);
+    WorkspaceDistMatrix<F,  STAR,STAR> A11_STAR_STAR(g);
+    WorkspaceDistMatrix<F,  MC,  STAR> A21_MC_STAR(g);
+    WorkspaceDistMatrix<F,  STAR,VR  > A12_STAR_VR(g);
+    WorkspaceDistMatrix<F,  STAR,MR  > A12_STAR_MR(g);
 
     const Int m = A.Height();
     const Int n = A.Width();
@@ -176,7 +176,7 @@ void LU( ElementalMatrix<F>& APre, DistPermutation& P )
     DistPermutation PB(g);
 
     vector<F> panelBuf, pivotBuf;
-    const Int bsize = Blocksize();
+    const Int bsize = TunedBlocksize<F>( "LU", g, minDim );
     for( Int k=0; k<minDim; k+=bsize )
     {
         const Int nb = Min(bsize,minDim-k);
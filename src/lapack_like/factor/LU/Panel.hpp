@@ -74,6 +74,7 @@ void Panel
   vector<F>& pivotBuffer )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("LU::Panel")
     typedef Base<F> Real;
     const Int n = A.Width();
     const Int BLocHeight = B.LocalHeight();
@@ -74,6 +74,7 @@ void PanelHouseholder
   ElementalMatrix<Base<F>>& signature )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("QR::PanelHouseholder")
     DEBUG_ONLY(AssertSameGrids( A, householderScalars, signature ))
     typedef Base<F> Real;
     const Grid& g = A.Grid();
@@ -122,21 +122,13 @@ template<typename Real>
 Real NormFromScaledSquare
 ( Real localScale, Real localScaledSquare, mpi::Comm comm )
 {
-    // Find the maximum relative scale
-    const Real scale = mpi::AllReduce( localScale, mpi::MAX, comm );
-
-    if( scale != Real(0) )
-    {
-        // Equilibrate our local scaled sum to the maximum scale
-        Real relScale = localScale/scale;
-        localScaledSquare *= relScale*relScale;
-
-        // The scaled square is now the sum of the local contributions
-        const Real scaledSquare = mpi::AllReduce( localScaledSquare, comm );
-        return scale*Sqrt(scaledSquare);
-    }
-    else
-      return 0;
+    // Combine the maximum scale and the equilibrated scaled squares in a
+    // single reduction
+    DeferredReduction<Real> reduction( comm );
+    const Int slot =
+      reduction.QueueScaledSquare( localScale, localScaledSquare );
+    reduction.Flush();
+    return reduction.Norm( slot );
 }
 
 template<typename F> 
@@ -145,7 +137,16 @@ Base<F> FrobeniusNorm( const AbstractDistMatrix<F>& A )
     DEBUG_CSE
     typedef Base<F> Real;
     Real norm;
-    if( A.Participating() )
+    if( A.Participating() && UseReproducibleSum<F>() )
+    {
+        const Int localHeight = A.LocalHeight();
+        const Matrix<F>& ALoc = A.LockedMatrix();
+        auto entry = [&]( Int k )
+          { return ALoc(k%localHeight,k/localHeight); };
+        norm = ReproducibleNorm<F>
+          ( localHeight*A.LocalWidth(), entry, A.DistComm() );
+    }
+    else if( A.Participating() )
     {
         Real localScale=0, localScaledSquare=1;
         const Int localHeight = A.LocalHeight();
@@ -286,10 +287,17 @@ Base<F> FrobeniusNorm( const DistMultiVec<F>& A )
 {
     DEBUG_CSE
     typedef Base<F> Real;
-    Real localScale=0, localScaledSquare=1;
     const Int localHeight = A.LocalHeight();
     const Int width = A.Width();
     const Matrix<F>& ALoc = A.LockedMatrix();
+    if( UseReproducibleSum<F>() )
+    {
+        auto entry = [&]( Int k )
+          { return ALoc(k%localHeight,k/localHeight); };
+        return ReproducibleNorm<F>( localHeight*width, entry, A.Comm() );
+    }
+
+    Real localScale=0, localScaledSquare=1;
     for( Int j=0; j<width; ++j )
         for( Int iLoc=0; iLoc<localHeight; ++iLoc )
             UpdateScaledSquare( ALoc(iLoc,j), localScale, localScaledSquare );
@@ -297,12 +305,73 @@ Base<F> FrobeniusNorm( const DistMultiVec<F>& A )
     return NormFromScaledSquare( localScale, localScaledSquare, A.Comm() );
 }
 
+template<typename F>
+Int QueueFrobeniusNorm
+( const AbstractDistMatrix<F>& A, DeferredReduction<Base<F>>& reduction )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    // Only the first redundant copy of the participating processes contributes
+    const bool contribute = A.Participating() && A.RedundantRank() == 0;
+    if( UseReproducibleSum<F>() )
+    {
+        const Int localHeight = A.LocalHeight();
+        const Matrix<F>& ALoc = A.LockedMatrix();
+        auto entry = [&]( Int k )
+          { return ALoc(k%localHeight,k/localHeight); };
+        const Int numLocalEntries =
+          ( contribute ? localHeight*A.LocalWidth() : 0 );
+        return QueueReproducibleNorm<F>( numLocalEntries, entry, reduction );
+    }
+
+    Real localScale=0, localScaledSquare=1;
+    if( contribute )
+    {
+        const Int localHeight = A.LocalHeight();
+        const Int localWidth = A.LocalWidth();
+        const Matrix<F>& ALoc = A.LockedMatrix();
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                UpdateScaledSquare
+                ( ALoc(iLoc,jLoc), localScale, localScaledSquare );
+    }
+    return reduction.QueueScaledSquare( localScale, localScaledSquare );
+}
+
+template<typename F>
+Int QueueFrobeniusNorm
+( const DistMultiVec<F>& A, DeferredReduction<Base<F>>& reduction )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int localHeight = A.LocalHeight();
+    const Int width = A.Width();
+    const Matrix<F>& ALoc = A.LockedMatrix();
+    if( UseReproducibleSum<F>() )
+    {
+        auto entry = [&]( Int k )
+          { return ALoc(k%localHeight,k/localHeight); };
+        return QueueReproducibleNorm<F>
+          ( localHeight*width, entry, reduction );
+    }
+
+    Real localScale=0, localScaledSquare=1;
+    for( Int j=0; j<width; ++j )
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            UpdateScaledSquare( ALoc(iLoc,j), localScale, localScaledSquare );
+    return reduction.QueueScaledSquare( localScale, localScaledSquare );
+}
+
 #define PROTO(F) \
   template Base<F> FrobeniusNorm( const Matrix<F>& A ); \
   template Base<F> FrobeniusNorm ( const AbstractDistMatrix<F>& A ); \
   template Base<F> FrobeniusNorm( const SparseMatrix<F>& A ); \
   template Base<F> FrobeniusNorm( const DistSparseMatrix<F>& A ); \
   template Base<F> FrobeniusNorm ( const DistMultiVec<F>& A ); \
+  template Int QueueFrobeniusNorm \
+  ( const AbstractDistMatrix<F>& A, DeferredReduction<Base<F>>& reduction ); \
+  template Int QueueFrobeniusNorm \
+  ( const DistMultiVec<F>& A, DeferredReduction<Base<F>>& reduction ); \
   template Base<F> HermitianFrobeniusNorm \
   ( UpperOrLower uplo, const Matrix<F>& A ); \
   template Base<F> HermitianFrobeniusNorm \
@@ -221,6 +221,25 @@ Base<T> SymmetricMaxNorm( UpperOrLower uplo, const DistSparseMatrix<T>& A )
     return HermitianMaxNorm( uplo, A );
 }
 
+template<typename F>
+Int QueueMaxNorm
+( const AbstractDistMatrix<F>& A, DeferredReduction<Base<F>>& reduction )
+{
+    DEBUG_CSE
+    Base<F> localMaxAbs = 0;
+    if( A.Participating() )
+        localMaxAbs = MaxNorm( A.LockedMatrix() );
+    return reduction.QueueMax( localMaxAbs );
+}
+
+template<typename F>
+Int QueueMaxNorm
+( const DistMultiVec<F>& A, DeferredReduction<Base<F>>& reduction )
+{
+    DEBUG_CSE
+    return reduction.QueueMax( MaxNorm( A.LockedMatrix() ) );
+}
+
 #define PROTO(T) \
   template Base<T> MaxNorm( const Matrix<T>& A ); \
   template Base<T> MaxNorm ( const AbstractDistMatrix<T>& A ); \
@@ -251,4 +270,17 @@ Base<T> SymmetricMaxNorm( UpperOrLower uplo, const DistSparseMatrix<T>& A )
 #define EL_ENABLE_BIGFLOAT
 #include <El/macros/Instantiate.h>
 
+#define PROTO(F) \
+  template Int QueueMaxNorm \
+  ( const AbstractDistMatrix<F>& A, DeferredReduction<Base<F>>& reduction ); \
+  template Int QueueMaxNorm \
+  ( const DistMultiVec<F>& A, DeferredReduction<Base<F>>& reduction );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
 } // namespace El
@@ -0,0 +1,163 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+namespace {
+
+bool IsLocalRoutine( const string& routine )
+{ return routine == "LocalTrrk" || routine == "LocalSymv"; }
+
+// Return the best time over 'numReps' runs of 'run' (each preceded by
+// 'prepare'), where each run is timed by the slowest process of 'comm'
+template<class Prepare,class Run>
+double BestTime( Prepare prepare, Run run, Int numReps, mpi::Comm comm )
+{
+    double best = std::numeric_limits<double>::infinity();
+    Timer timer;
+    for( Int rep=0; rep<numReps; ++rep )
+    {
+        prepare();
+        mpi::Barrier( comm );
+        timer.Start();
+        run();
+        const double time = mpi::AllReduce( timer.Stop(), mpi::MAX, comm );
+        best = Min( best, time );
+    }
+    return best;
+}
+
+template<typename F>
+void RecordCandidate
+( const string& routine, int gridHeight, int gridWidth, Int n, Int nb )
+{
+    if( IsLocalRoutine(routine) )
+        SetTunedBlocksize( routine, TypeName<F>(), 0, 0, 0, nb );
+    else
+        SetTunedBlocksize
+        ( routine, TypeName<F>(), gridHeight, gridWidth, n, nb );
+}
+
+} // anonymous namespace
+
+template<typename F>
+Int TuneBlocksize
+( const string& routine, Int n, const vector<Int>& candidates, Int numReps )
+{
+    DEBUG_CSE
+    if( candidates.empty() )
+        LogicError("No candidate blocksizes were given");
+    Matrix<F> A, ACopy;
+    Permutation P;
+    std::function<void()> run;
+    if( routine == "LU" )
+    {
+        Uniform( A, n, n );
+        run = [&]() { LU( ACopy, P ); };
+    }
+    else if( routine == "Cholesky" )
+    {
+        HermitianUniformSpectrum( A, n, Base<F>(1), Base<F>(10) );
+        run = [&]() { Cholesky( LOWER, ACopy ); };
+    }
+    else
+        LogicError("Cannot tune the sequential blocksize of ",routine);
+
+    Int bestBlocksize = candidates[0];
+    double bestTime = std::numeric_limits<double>::infinity();
+    for( const Int nb : candidates )
+    {
+        RecordCandidate<F>( routine, 0, 0, n, nb );
+        const double time =
+          BestTime( [&]() { ACopy = A; }, run, numReps, mpi::COMM_WORLD );
+        if( time < bestTime )
+        {
+            bestTime = time;
+            bestBlocksize = nb;
+        }
+    }
+    RecordCandidate<F>( routine, 0, 0, n, bestBlocksize );
+    return bestBlocksize;
+}
+
+template<typename F>
+Int TuneBlocksize
+( const string& routine, const Grid& grid, Int n,
+  const vector<Int>& candidates, Int numReps )
+{
+    DEBUG_CSE
+    if( candidates.empty() )
+        LogicError("No candidate blocksizes were given");
+    DistMatrix<F> A(grid), ACopy(grid), C(grid), x(grid), y(grid);
+    DistMatrix<F,STAR,STAR> phase(grid);
+    DistPermutation P(grid);
+    std::function<void()> run;
+    if( routine == "LU" )
+    {
+        Uniform( A, n, n );
+        run = [&]() { LU( ACopy, P ); };
+    }
+    else if( routine == "Cholesky" )
+    {
+        HermitianUniformSpectrum( A, n, Base<F>(1), Base<F>(10) );
+        run = [&]() { Cholesky( LOWER, ACopy ); };
+    }
+    else if( routine == "HermitianTridiag" )
+    {
+        HermitianUniformSpectrum( A, n, Base<F>(-1), Base<F>(1) );
+        run = [&]() { HermitianTridiag( LOWER, ACopy, phase ); };
+    }
+    else if( routine == "LocalTrrk" )
+    {
+        Uniform( A, n, n );
+        Zeros( C, n, n );
+        run = [&]() { Herk( LOWER, NORMAL, Base<F>(1), ACopy, C ); };
+    }
+    else if( routine == "LocalSymv" )
+    {
+        HermitianUniformSpectrum( A, n, Base<F>(-1), Base<F>(1) );
+        Uniform( x, n, 1 );
+        Zeros( y, n, 1 );
+        run = [&]() { Symv( LOWER, F(1), ACopy, x, F(0), y, true ); };
+    }
+    else
+        LogicError("Cannot tune the blocksize of ",routine);
+
+    Int bestBlocksize = candidates[0];
+    double bestTime = std::numeric_limits<double>::infinity();
+    for( const Int nb : candidates )
+    {
+        RecordCandidate<F>( routine, grid.Height(), grid.Width(), n, nb );
+        const double time =
+          BestTime
+          ( [&]() { ACopy = A; }, run, numReps, grid.ViewingComm() );
+        if( time < bestTime )
+        {
+            bestTime = time;
+            bestBlocksize = nb;
+        }
+    }
+    RecordCandidate<F>
+    ( routine, grid.Height(), grid.Width(), n, bestBlocksize );
+    return bestBlocksize;
+}
+
+#define PROTO(F) \
+  template Int TuneBlocksize<F> \
+  ( const string& routine, Int n, \
+    const vector<Int>& candidates, Int numReps ); \
+  template Int TuneBlocksize<F> \
+  ( const string& routine, const Grid& grid, Int n, \
+    const vector<Int>& candidates, Int numReps );
+
+#define EL_NO_INT_PROTO
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -9,6 +9,7 @@
 #include <El-lite.hpp>
 #include <El/blas_like/level1.hpp>
 #include <El/matrices.hpp>
+#include "./StreamFill.hpp"
 
 namespace El {
 
@@ -39,13 +40,27 @@ void Bernoulli( AbstractDistMatrix<T>& A, Int m, Int n, double p )
         ("Invalid choice of parameter p for Bernoulli distribution: ",p);
     A.Resize( m, n );
     const double q = 1-p;
+    if( CounterBasedRandom() )
+    {
+        const RandomStream stream =
+          NewRandomStream( A.Grid().ViewingComm() );
+        auto sample = [&]( Int i, Int j ) -> T
+          {
+              if( stream.Uniform( i, j ) < q ) return T(0);
+              else                             return T(1);
+          };
+        StreamFill( A, sample );
+        return;
+    }
     auto doubleCoin = [=]() -> T
     {
         const double alpha = SampleUniform<double>(0,1);
         if( alpha <= q ) return T(0); 
         else             return T(1);
     };
-    EntrywiseFill( A, function<T()>(doubleCoin) );
+    if( A.RedundantRank() == 0 )
+        EntrywiseFill( A, function<T()>(doubleCoin) );
+    Broadcast( A, A.RedundantComm(), 0 );
 }
 
 #define PROTO(T) \
@@ -9,6 +9,7 @@
 #include <El-lite.hpp>
 #include <El/blas_like/level1.hpp>
 #include <El/matrices.hpp>
+#include "./StreamFill.hpp"
 
 namespace El {
 
@@ -25,6 +26,15 @@ template<typename F>
 void MakeGaussian( AbstractDistMatrix<F>& A, F mean, Base<F> stddev )
 {
     DEBUG_CSE
+    if( UseRandomStream<F>() )
+    {
+        const RandomStream stream =
+          NewRandomStream( A.Grid().ViewingComm() );
+        auto sample =
+          [&]( Int i, Int j ) { return stream.Normal( i, j, mean, stddev ); };
+        StreamFill( A, sample );
+        return;
+    }
     if( A.RedundantRank() == 0 )
         MakeGaussian( A.Matrix(), mean, stddev );
     Broadcast( A, A.RedundantComm(), 0 );
@@ -34,6 +44,14 @@ template<typename F>
 void MakeGaussian( DistMultiVec<F>& A, F mean, Base<F> stddev )
 {
     DEBUG_CSE
+    if( UseRandomStream<F>() )
+    {
+        const RandomStream stream = NewRandomStream( A.Comm() );
+        auto sample =
+          [&]( Int i, Int j ) { return stream.Normal( i, j, mean, stddev ); };
+        StreamFill( A, sample );
+        return;
+    }
     auto sampleNormal = [=]() { return SampleNormal(mean,stddev); };
     EntrywiseFill( A, function<F()>(sampleNormal) );
 }
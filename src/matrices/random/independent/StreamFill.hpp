@@ -0,0 +1,62 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+namespace El {
+
+// Set each local entry of A to sample(i,j), where (i,j) is its global index,
+// with the columns split between the threads. Since 'sample' draws from a
+// RandomStream, every redundant copy of A generates the same entries and no
+// broadcast is required.
+template<typename T,class Sampler>
+void StreamFill( AbstractDistMatrix<T>& A, Sampler sample )
+{
+    DEBUG_CSE
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    T* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+    const Int numChunks =
+      Min( NumParallelChunks<T>(localHeight*localWidth), localWidth );
+    EL_PARALLEL_FOR_IF(numChunks > 1)
+    for( Int chunk=0; chunk<numChunks; ++chunk )
+    {
+        const Int jLocStart = (chunk*localWidth) / numChunks;
+        const Int jLocEnd = ((chunk+1)*localWidth) / numChunks;
+        for( Int jLoc=jLocStart; jLoc<jLocEnd; ++jLoc )
+        {
+            const Int j = A.GlobalCol(jLoc);
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                ABuf[iLoc+jLoc*ALDim] = sample( A.GlobalRow(iLoc), j );
+        }
+    }
+}
+
+template<typename T,class Sampler>
+void StreamFill( DistMultiVec<T>& A, Sampler sample )
+{
+    DEBUG_CSE
+    const Int localHeight = A.LocalHeight();
+    const Int width = A.Width();
+    const Int firstLocalRow = A.FirstLocalRow();
+    T* ABuf = A.Matrix().Buffer();
+    const Int ALDim = A.Matrix().LDim();
+    const Int numChunks = Min( NumParallelChunks<T>(localHeight*width), width );
+    EL_PARALLEL_FOR_IF(numChunks > 1)
+    for( Int chunk=0; chunk<numChunks; ++chunk )
+    {
+        const Int jStart = (chunk*width) / numChunks;
+        const Int jEnd = ((chunk+1)*width) / numChunks;
+        for( Int j=jStart; j<jEnd; ++j )
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                ABuf[iLoc+j*ALDim] = sample( firstLocalRow+iLoc, j );
+    }
+}
+
+} // namespace El
@@ -9,6 +9,7 @@
 #include <El-lite.hpp>
 #include <El/blas_like/level1.hpp>
 #include <El/matrices.hpp>
+#include "./StreamFill.hpp"
 
 namespace El {
 
@@ -32,6 +33,20 @@ void ThreeValued( AbstractDistMatrix<T>& A, Int m, Int n, double p )
 {
     DEBUG_CSE
     A.Resize( m, n );
+    if( CounterBasedRandom() )
+    {
+        const RandomStream stream =
+          NewRandomStream( A.Grid().ViewingComm() );
+        auto sample = [&]( Int i, Int j ) -> T
+          {
+              const double alpha = stream.Uniform( i, j );
+              if( alpha < p/2 ) return T(-1);
+              else if( alpha < p ) return T(1);
+              else return T(0);
+          };
+        StreamFill( A, sample );
+        return;
+    }
     if( A.RedundantRank() == 0 )
         ThreeValued( A.Matrix(), A.LocalHeight(), A.LocalWidth(), p );
     Broadcast( A, A.RedundantComm(), 0 );
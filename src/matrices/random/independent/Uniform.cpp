@@ -9,6 +9,7 @@
 #include <El-lite.hpp>
 #include <El/blas_like/level1.hpp>
 #include <El/matrices.hpp>
+#include "./StreamFill.hpp"
 
 namespace El {
 
@@ -34,6 +35,15 @@ template<typename T>
 void MakeUniform( AbstractDistMatrix<T>& A, T center, Base<T> radius )
 {
     DEBUG_CSE
+    if( UseRandomStream<T>() )
+    {
+        const RandomStream stream =
+          NewRandomStream( A.Grid().ViewingComm() );
+        auto sample =
+          [&]( Int i, Int j ) { return stream.Ball( i, j, center, radius ); };
+        StreamFill( A, sample );
+        return;
+    }
     if( A.RedundantRank() == 0 )
         MakeUniform( A.Matrix(), center, radius );
     Broadcast( A, A.RedundantComm(), 0 );
@@ -51,6 +61,14 @@ template<typename T>
 void MakeUniform( DistMultiVec<T>& X, T center, Base<T> radius )
 {
     DEBUG_CSE
+    if( UseRandomStream<T>() )
+    {
+        const RandomStream stream = NewRandomStream( X.Comm() );
+        auto sample =
+          [&]( Int i, Int j ) { return stream.Ball( i, j, center, radius ); };
+        StreamFill( X, sample );
+        return;
+    }
     const int localHeight = X.LocalHeight();
     const int width = X.Width();
     for( int j=0; j<width; ++j )
@@ -542,8 +542,12 @@ void Mehrotra
         }
 
         // Rescale || b ||_max and || c||_max to roughly one (similar to PDCO)
-        bScale = Max(MaxNorm(b),Real(1));
-        cScale = Max(MaxNorm(c),Real(1));
+        DeferredReduction<Real> scaleReduction( grid.ViewingComm() );
+        const Int bMaxNormSlot = QueueMaxNorm( b, scaleReduction );
+        const Int cMaxNormSlot = QueueMaxNorm( c, scaleReduction );
+        scaleReduction.Flush();
+        bScale = Max(scaleReduction.Max(bMaxNormSlot),Real(1));
+        cScale = Max(scaleReduction.Max(cMaxNormSlot),Real(1));
         b *= Real(1)/bScale;
         c *= Real(1)/cScale;
         if( ctrl.primalInit )
@@ -569,8 +573,12 @@ void Mehrotra
         Ones( dCol, n, 1 );
     }
 
-    const Real bNrm2 = Nrm2( b );
-    const Real cNrm2 = Nrm2( c );
+    DeferredReduction<Real> normReduction( grid.ViewingComm() );
+    const Int bNrm2Slot = QueueNrm2( b, normReduction );
+    const Int cNrm2Slot = QueueNrm2( c, normReduction );
+    normReduction.Flush();
+    const Real bNrm2 = normReduction.Norm(bNrm2Slot);
+    const Real cNrm2 = normReduction.Norm(cNrm2Slot);
     if( ctrl.print )
     {
         const Real ANrm1 = OneNorm( A );
@@ -613,43 +621,61 @@ void Mehrotra
             (xNumNonPos," entries of x were nonpositive and ",
              zNumNonPos," entries of z were nonpositive");
 
+        // The inner products and norms of this iteration are queued and
+        // then combined with a single reduction
+        DeferredReduction<Real> reduction( grid.ViewingComm() );
+
         // Compute the barrier parameter
         // =============================
-        Real mu = Dot(x,z) / degree;
+        const Int muSlot = QueueDot( x, z, reduction );
         const Real compRatio = pos_orth::ComplementRatio( x, z );
-        mu = ( compRatio > balanceTol ? muOld : Min(mu,muOld) );
-        muOld = mu;
 
         // Check for convergence
         // =====================
         // |primal - dual| / (1 + |primal|) <= tol ?
         // -----------------------------------------
-        const Real primObj = Dot(c,x);
-        const Real dualObj = -Dot(b,y); 
-        const Real objConv = Abs(primObj-dualObj) / (1+Abs(primObj));
+        const Int primObjSlot = QueueDot( c, x, reduction );
+        const Int dualObjSlot = QueueDot( b, y, reduction );
         // || r_b ||_2 / (1 + || b ||_2) <= tol ?
         // --------------------------------------
         rb = b;
         Gemv( NORMAL, Real(1), A, x, Real(-1), rb );
-        const Real rbNrm2 = Nrm2( rb );
-        const Real rbConv = rbNrm2 / (1+bNrm2);
+        const Int rbNrm2Slot = QueueNrm2( rb, reduction );
         Axpy( -deltaPerm*deltaPerm, y, rb ); 
         // || r_c ||_2 / (1 + || c ||_2) <= tol ?
         // --------------------------------------
         rc = c;
         Gemv( TRANSPOSE, Real(1), A, y, Real(1), rc );
         rc -= z;
-        const Real rcNrm2 = Nrm2( rc );
-        const Real rcConv = rcNrm2 / (1+cNrm2);
+        const Int rcNrm2Slot = QueueNrm2( rc, reduction );
         Axpy( gammaPerm*gammaPerm, x, rc );
+        Int xNrm2Slot=-1, yNrm2Slot=-1, zNrm2Slot=-1;
+        if( ctrl.print )
+        {
+            xNrm2Slot = QueueNrm2( x, reduction );
+            yNrm2Slot = QueueNrm2( y, reduction );
+            zNrm2Slot = QueueNrm2( z, reduction );
+        }
+        reduction.Flush();
+
+        Real mu = reduction.Sum(muSlot) / degree;
+        mu = ( compRatio > balanceTol ? muOld : Min(mu,muOld) );
+        muOld = mu;
+        const Real primObj = reduction.Sum(primObjSlot);
+        const Real dualObj = -reduction.Sum(dualObjSlot);
+        const Real objConv = Abs(primObj-dualObj) / (1+Abs(primObj));
+        const Real rbNrm2 = reduction.Norm(rbNrm2Slot);
+        const Real rbConv = rbNrm2 / (1+bNrm2);
+        const Real rcNrm2 = reduction.Norm(rcNrm2Slot);
+        const Real rcConv = rcNrm2 / (1+cNrm2);
         // Now check the pieces
         // --------------------
         relError = Max(Max(objConv,rbConv),rcConv);
         if( ctrl.print )
         {
-            const Real xNrm2 = Nrm2( x );
-            const Real yNrm2 = Nrm2( y );
-            const Real zNrm2 = Nrm2( z );
+            const Real xNrm2 = reduction.Norm(xNrm2Slot);
+            const Real yNrm2 = reduction.Norm(yNrm2Slot);
+            const Real zNrm2 = reduction.Norm(zNrm2Slot);
             if( commRank == 0 )
                 Output
                 ("iter ",numIts,":\n",Indent(),
@@ -1561,8 +1587,12 @@ void Mehrotra
         }
 
         // Rescale || b ||_max and || c||_max to roughly one (similar to PDCO)
-        bScale = Max(MaxNorm(b),Real(1));
-        cScale = Max(MaxNorm(c),Real(1));
+        DeferredReduction<Real> scaleReduction( comm );
+        const Int bMaxNormSlot = QueueMaxNorm( b, scaleReduction );
+        const Int cMaxNormSlot = QueueMaxNorm( c, scaleReduction );
+        scaleReduction.Flush();
+        bScale = Max(scaleReduction.Max(bMaxNormSlot),Real(1));
+        cScale = Max(scaleReduction.Max(cMaxNormSlot),Real(1));
         b *= Real(1)/bScale;
         c *= Real(1)/cScale;
         if( ctrl.primalInit )
@@ -1588,8 +1618,12 @@ void Mehrotra
         Ones( dCol, n, 1 );
     }
 
-    const Real bNrm2 = Nrm2( b );
-    const Real cNrm2 = Nrm2( c );
+    DeferredReduction<Real> normReduction( comm );
+    const Int bNrm2Slot = QueueNrm2( b, normReduction );
+    const Int cNrm2Slot = QueueNrm2( c, normReduction );
+    normReduction.Flush();
+    const Real bNrm2 = normReduction.Norm(bNrm2Slot);
+    const Real cNrm2 = normReduction.Norm(cNrm2Slot);
     const Real twoNormEstA = TwoNormEstimate( A, ctrl.basisSize );
     const Real origTwoNormEst = twoNormEstA + 1;
     if( ctrl.print )
@@ -1689,46 +1723,65 @@ void Mehrotra
             (xNumNonPos," entries of x were nonpositive and ",
              zNumNonPos," entries of z were nonpositive");
 
+        // The inner products and norms of this iteration are queued and
+        // then combined with a single reduction
+        DeferredReduction<Real> reduction( comm );
+
         // Compute the barrier parameter
         // =============================
-        Real mu = Dot(x,z) / degree;
+        const Int muSlot = QueueDot( x, z, reduction );
         const Real compRatio = pos_orth::ComplementRatio( x, z );
-        mu = ( compRatio > balanceTol ? muOld : Min(mu,muOld) );
-        muOld = mu;
 
         pos_orth::NesterovTodd( x, z, w );
-        const Real wMaxNorm = MaxNorm( w );
+        const Int wMaxNormSlot = QueueMaxNorm( w, reduction );
 
         // Check for convergence
         // =====================
         // |primal - dual| / (1 + |primal|) <= tol ?
         // -----------------------------------------
-        const Real primObj = Dot(c,x);
-        const Real dualObj = -Dot(b,y); 
-        const Real objConv = Abs(primObj-dualObj) / (1+Abs(primObj));
+        const Int primObjSlot = QueueDot( c, x, reduction );
+        const Int dualObjSlot = QueueDot( b, y, reduction );
         // || r_b ||_2 / (1 + || b ||_2) <= tol ?
         // --------------------------------------
         rb = b;
         Multiply( NORMAL, Real(1), A, x, Real(-1), rb );
-        const Real rbNrm2 = Nrm2( rb );
-        const Real rbConv = rbNrm2 / (1+bNrm2);
+        const Int rbNrm2Slot = QueueNrm2( rb, reduction );
         Axpy( -deltaPerm*deltaPerm, y, rb ); 
         // || r_c ||_2 / (1 + || c ||_2) <= tol ?
         // --------------------------------------
         rc = c;
         Multiply( TRANSPOSE, Real(1), A, y, Real(1), rc );
         rc -= z;
-        const Real rcNrm2 = Nrm2( rc );
-        const Real rcConv = rcNrm2 / (1+cNrm2);
+        const Int rcNrm2Slot = QueueNrm2( rc, reduction );
         Axpy( gammaPerm*gammaPerm, x, rc );
+        Int xNrm2Slot=-1, yNrm2Slot=-1, zNrm2Slot=-1;
+        if( ctrl.print )
+        {
+            xNrm2Slot = QueueNrm2( x, reduction );
+            yNrm2Slot = QueueNrm2( y, reduction );
+            zNrm2Slot = QueueNrm2( z, reduction );
+        }
+        reduction.Flush();
+
+        Real mu = reduction.Sum(muSlot) / degree;
+        mu = ( compRatio > balanceTol ? muOld : Min(mu,muOld) );
+        muOld = mu;
+        const Real wMaxNorm = reduction.Max(wMaxNormSlot);
+        const Real primObj = reduction.Sum(primObjSlot);
+        const Real dualObj = -reduction.Sum(dualObjSlot);
+        const Real objConv = Abs(primObj-dualObj) / (1+Abs(primObj));
+        const Real rbNrm2 = reduction.Norm(rbNrm2Slot);
+        const Real rbConv = rbNrm2 / (1+bNrm2);
+        const Real rcNrm2 = reduction.Norm(rcNrm2Slot);
+        const Real rcConv = rcNrm2 / (1+cNrm2);
         // Now check the pieces
         // --------------------
         relError = Max(Max(objConv,rbConv),rcConv);
         if( ctrl.print )
         {
-            const Real xNrm2 = Nrm2( x );
-            const Real yNrm2 = Nrm2( y );
-            const Real zNrm2 = Nrm2( z );
+            const Real xNrm2 = reduction.Norm(xNrm2Slot);
+            const Real yNrm2 = reduction.Norm(yNrm2Slot);
+            const Real zNrm2 = reduction.Norm(zNrm2Slot);
             if( commRank == 0 )
                 Output
                 ("iter ",numIts,":\n",Indent(),
@@ -0,0 +1,252 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Compare the blocked blas::Trsm, blas::Trmm, blas::Syrk, and blas::Herk used
+// for the datatypes without BLAS support against naive loops for sizes which
+// span several of their blocks (KC=128 for Trsm/Trmm and MC=64 for Syrk/Herk)
+
+template<typename T>
+T OpEntry( char trans, const Matrix<T>& X, Int i, Int j )
+{
+    if( trans == 'N' )
+        return X.Get(i,j);
+    else if( trans == 'T' )
+        return X.Get(j,i);
+    else
+        return Conj(X.Get(j,i));
+}
+
+// Return op(A)(i,j), where A is implicitly triangular with an implicit unit
+// diagonal if unit == 'U'
+template<typename T>
+T TriangularEntry
+( char uplo, char trans, char unit, const Matrix<T>& A, Int i, Int j )
+{
+    const Int iA = ( trans == 'N' ? i : j );
+    const Int jA = ( trans == 'N' ? j : i );
+    if( iA == jA && unit == 'U' )
+        return T(1);
+    if( (uplo == 'L' && iA < jA) || (uplo == 'U' && iA > jA) )
+        return T(0);
+    return OpEntry(trans,A,i,j);
+}
+
+// B := op(A) B or B op(A)
+template<typename T>
+void NaiveTrmm
+( char side, char uplo, char trans, char unit,
+  const T& alpha, const Matrix<T>& A, Matrix<T>& B )
+{
+    const Int m = B.Height();
+    const Int n = B.Width();
+    Matrix<T> BOrig( B );
+    for( Int j=0; j<n; ++j )
+    {
+        for( Int i=0; i<m; ++i )
+        {
+            T gamma = 0;
+            if( side == 'L' )
+                for( Int l=0; l<m; ++l )
+                    gamma += TriangularEntry(uplo,trans,unit,A,i,l)*
+                             BOrig.Get(l,j);
+            else
+                for( Int l=0; l<n; ++l )
+                    gamma += BOrig.Get(i,l)*
+                             TriangularEntry(uplo,trans,unit,A,l,j);
+            B.Set( i, j, alpha*gamma );
+        }
+    }
+}
+
+template<typename T>
+void CheckTriangular
+( const string& label, char side, char uplo, char trans, char unit,
+  const Matrix<T>& B, const Matrix<T>& BRef, const Base<T>& bound )
+{
+    for( Int j=0; j<B.Width(); ++j )
+        for( Int i=0; i<B.Height(); ++i )
+            if( Abs(B.Get(i,j)-BRef.Get(i,j)) > bound )
+                LogicError
+                (label,"(",side,",",uplo,",",trans,",",unit,") with m=",
+                 B.Height(),", n=",B.Width()," differed by ",
+                 Abs(B.Get(i,j)-BRef.Get(i,j))," at (",i,",",j,")");
+}
+
+template<typename T>
+void TestTrmm
+( char side, char uplo, char trans, char unit, Int m, Int n,
+  const Base<T>& tol )
+{
+    const Int mA = ( side == 'L' ? m : n );
+    const T alpha = T(3);
+    Matrix<T> A, B, BRef;
+    Uniform( A, mA, mA, T(0), Base<T>(10) );
+    Uniform( B, m, n, T(0), Base<T>(10) );
+
+    BRef = B;
+    NaiveTrmm( side, uplo, trans, unit, alpha, A, BRef );
+    blas::Trmm
+    ( side, uplo, trans, unit, m, n,
+      alpha, A.LockedBuffer(), A.LDim(), B.Buffer(), B.LDim() );
+
+    // Each entry sums mA products of magnitude at most 100
+    const Base<T> bound = tol*Base<T>(300*mA+200);
+    CheckTriangular( "Trmm", side, uplo, trans, unit, B, BRef, bound );
+}
+
+// The generic blas::Trsm is only instantiated for fields
+template<typename T,typename=EnableIf<IsIntegral<T>>>
+void TestTrsm
+( char side, char uplo, char trans, char unit, Int m, Int n,
+  const Base<T>& tol )
+{ }
+
+template<typename F,typename=DisableIf<IsIntegral<F>>,typename=void>
+void TestTrsm
+( char side, char uplo, char trans, char unit, Int m, Int n,
+  const Base<F>& tol )
+{
+    typedef Base<F> Real;
+    const Int mA = ( side == 'L' ? m : n );
+    const F alpha = F(2);
+
+    // Keep op(A) diagonally dominant so that the solves are well-conditioned
+    Matrix<F> A, X, B;
+    Uniform( A, mA, mA, F(0), Real(1)/Real(2*mA) );
+    for( Int j=0; j<mA; ++j )
+        A.Set( j, j, F(2) );
+    Uniform( X, m, n, F(0), Real(10) );
+
+    // Solve op(A) X = alpha B or X op(A) = alpha B for B := op(A) X or
+    // X op(A), which should yield alpha X
+    B = X;
+    NaiveTrmm( side, uplo, trans, unit, F(1), A, B );
+    blas::Trsm
+    ( side, uplo, trans, unit, m, n,
+      alpha, A.LockedBuffer(), A.LDim(), B.Buffer(), B.LDim() );
+    X *= alpha;
+
+    const Real bound = tol*Real(100*mA);
+    CheckTriangular( "Trsm", side, uplo, trans, unit, B, X, bound );
+}
+
+// C := alpha op(A) op(A)^{T/H} + beta C within the uplo triangle of C
+template<typename T>
+void TestUpdate
+( bool hermitian, char uplo, char trans, Int n, Int k, const Base<T>& tol )
+{
+    const Base<T> alpha = Base<T>(3), beta = Base<T>(-2);
+    const char adjoint = ( hermitian ? 'C' : 'T' );
+    Matrix<T> A, C, CRef;
+    if( trans == 'N' )
+        Uniform( A, n, k, T(0), Base<T>(10) );
+    else
+        Uniform( A, k, n, T(0), Base<T>(10) );
+    Uniform( C, n, n, T(0), Base<T>(10) );
+
+    CRef = C;
+    for( Int j=0; j<n; ++j )
+    {
+        const Int iBeg = ( uplo == 'L' ? j : 0 );
+        const Int iEnd = ( uplo == 'L' ? n : j+1 );
+        for( Int i=iBeg; i<iEnd; ++i )
+        {
+            T gamma = 0;
+            for( Int l=0; l<k; ++l )
+            {
+                if( trans == 'N' )
+                    gamma += A.Get(i,l)*OpEntry(adjoint,A,l,j);
+                else
+                    gamma += OpEntry(adjoint,A,i,l)*A.Get(l,j);
+            }
+            CRef.Set( i, j, alpha*gamma + beta*CRef.Get(i,j) );
+        }
+    }
+    const string label = ( hermitian ? "Herk" : "Syrk" );
+    if( hermitian )
+        blas::Herk
+        ( uplo, trans, n, k,
+          alpha, A.LockedBuffer(), A.LDim(), beta, C.Buffer(), C.LDim() );
+    else
+        blas::Syrk
+        ( uplo, trans, n, k,
+          T(alpha), A.LockedBuffer(), A.LDim(), T(beta), C.Buffer(), C.LDim() );
+
+    // Each entry sums k products of magnitude at most 100
+    const Base<T> bound = tol*Base<T>(300*k+200);
+    for( Int j=0; j<n; ++j )
+    {
+        const Int iBeg = ( uplo == 'L' ? j : 0 );
+        const Int iEnd = ( uplo == 'L' ? n : j+1 );
+        for( Int i=iBeg; i<iEnd; ++i )
+            if( Abs(C.Get(i,j)-CRef.Get(i,j)) > bound )
+                LogicError
+                (label,"(",uplo,",",trans,") with n=",n,", k=",k,
+                 " differed by ",Abs(C.Get(i,j)-CRef.Get(i,j))," at (",i,
+                 ",",j,")");
+    }
+}
+
+template<typename T>
+void TestBlocked( const Base<T>& tol )
+{
+    Output("Testing with ",TypeName<T>());
+    const Int triangularSizes[][2] = { {259,3}, {3,259}, {131,130} };
+    const Int updateSizes[][2] = { {150,7}, {70,131} };
+    const char sides[] = { 'L', 'R' };
+    const char uplos[] = { 'L', 'U' };
+    const char transposes[] = { 'N', 'T', 'C' };
+    const char units[] = { 'N', 'U' };
+    for( const char side : sides )
+        for( const char uplo : uplos )
+            for( const char trans : transposes )
+                for( const char unit : units )
+                    for( const auto& size : triangularSizes )
+                    {
+                        TestTrmm<T>
+                        ( side, uplo, trans, unit, size[0], size[1], tol );
+                        TestTrsm<T>
+                        ( side, uplo, trans, unit, size[0], size[1], tol );
+                    }
+    for( const char uplo : uplos )
+        for( const auto& size : updateSizes )
+        {
+            for( const char trans : { 'N', 'T' } )
+                TestUpdate<T>( false, uplo, trans, size[0], size[1], tol );
+            for( const char trans : { 'N', 'C' } )
+                TestUpdate<T>( true, uplo, trans, size[0], size[1], tol );
+        }
+    Output("PASSED");
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        ProcessInput();
+        PrintInputReport();
+
+        TestBlocked<Int>( 0 );
+#ifdef EL_HAVE_QD
+        TestBlocked<DoubleDouble>( limits::Epsilon<DoubleDouble>() );
+        TestBlocked<QuadDouble>( limits::Epsilon<QuadDouble>() );
+        TestBlocked<Complex<DoubleDouble>>( limits::Epsilon<DoubleDouble>() );
+#endif
+#ifdef EL_HAVE_MPC
+        TestBlocked<BigFloat>( limits::Epsilon<BigFloat>() );
+#endif
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,106 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Compare the packed blas::Gemm used for the datatypes without BLAS support
+// against a naive triple loop for sizes which are not multiples of the
+// register or cache blocksizes (MR,NR <= 8, MC=64, KC=128, NC=512)
+
+template<typename T>
+T OpEntry( char trans, const Matrix<T>& X, Int i, Int j )
+{
+    if( trans == 'N' )
+        return X.Get(i,j);
+    else if( trans == 'T' )
+        return X.Get(j,i);
+    else
+        return Conj(X.Get(j,i));
+}
+
+template<typename T>
+void TestGemm
+( char transA, char transB, Int m, Int n, Int k, const Base<T>& tol )
+{
+    const T alpha = T(3), beta = T(-2);
+    Matrix<T> A, B, C, CRef;
+    if( transA == 'N' )
+        Uniform( A, m, k, T(0), Base<T>(10) );
+    else
+        Uniform( A, k, m, T(0), Base<T>(10) );
+    if( transB == 'N' )
+        Uniform( B, k, n, T(0), Base<T>(10) );
+    else
+        Uniform( B, n, k, T(0), Base<T>(10) );
+    Uniform( C, m, n, T(0), Base<T>(10) );
+
+    CRef = C;
+    for( Int j=0; j<n; ++j )
+    {
+        for( Int i=0; i<m; ++i )
+        {
+            T gamma = 0;
+            for( Int l=0; l<k; ++l )
+                gamma += OpEntry(transA,A,i,l)*OpEntry(transB,B,l,j);
+            CRef.Set( i, j, alpha*gamma + beta*CRef.Get(i,j) );
+        }
+    }
+    blas::Gemm
+    ( transA, transB, m, n, k,
+      alpha, A.LockedBuffer(), A.LDim(), B.LockedBuffer(), B.LDim(),
+      beta, C.Buffer(), C.LDim() );
+
+    // Each entry sums k products of magnitude at most 100
+    const Base<T> bound = tol*Base<T>(300*k+200);
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            if( Abs(C.Get(i,j)-CRef.Get(i,j)) > bound )
+                LogicError
+                ("Gemm(",transA,",",transB,") with m=",m,", n=",n,", k=",k,
+                 " differed by ",Abs(C.Get(i,j)-CRef.Get(i,j))," at (",i,",",
+                 j,")");
+}
+
+template<typename T>
+void TestGemms( const Base<T>& tol )
+{
+    Output("Testing with ",TypeName<T>());
+    const Int sizes[][3] =
+      { {1,1,1}, {5,3,7}, {9,13,2}, {67,5,131}, {130,70,3}, {7,515,9} };
+    const char transposes[] = { 'N', 'T', 'C' };
+    for( const char transA : transposes )
+        for( const char transB : transposes )
+            for( const auto& size : sizes )
+                TestGemm<T>( transA, transB, size[0], size[1], size[2], tol );
+    Output("PASSED");
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        ProcessInput();
+        PrintInputReport();
+
+        TestGemms<Int>( 0 );
+#ifdef EL_HAVE_QD
+        TestGemms<DoubleDouble>( limits::Epsilon<DoubleDouble>() );
+        TestGemms<QuadDouble>( limits::Epsilon<QuadDouble>() );
+        TestGemms<Complex<DoubleDouble>>( limits::Epsilon<DoubleDouble>() );
+#endif
+#ifdef EL_HAVE_MPC
+        TestGemms<BigFloat>( limits::Epsilon<BigFloat>() );
+#endif
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
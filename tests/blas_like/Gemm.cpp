@@ -41,6 +41,72 @@ void TestAssociativity
       EFrobNorm, "/", YFrobNorm, "=", EFrobNorm/YFrobNorm );
 }
 
+// Compare the sequential Gemm using the Ozaki engine against the standard
+// engine entrywise, relative to |alpha| |op(A)| |op(B)| + |beta| |C|. The rows
+// of op(A) span many binades so that the per-row scalings of the split are
+// exercised.
+template<typename Real>
+void TestOzaki
+( Orientation orientA, Orientation orientB, Int m, Int n, Int k,
+  const Real& alpha, const Real& beta, bool print )
+{
+    OutputFromRoot
+    (mpi::COMM_WORLD,"Testing the Ozaki engine with ",TypeName<Real>());
+    PushIndent();
+
+    Matrix<Real> A, B, COrig, C, CRef;
+    if( orientA == NORMAL )
+        Uniform( A, m, k );
+    else
+        Uniform( A, k, m );
+    if( orientB == NORMAL )
+        Uniform( B, k, n );
+    else
+        Uniform( B, n, k );
+    Uniform( COrig, m, n );
+    for( Int i=0; i<m; ++i )
+    {
+        const Real scale = std::ldexp( 1., Int(i % 61) - 30 );
+        for( Int l=0; l<k; ++l )
+        {
+            if( orientA == NORMAL )
+                A.Set( i, l, scale*A.Get(i,l) );
+            else
+                A.Set( l, i, scale*A.Get(l,i) );
+        }
+    }
+
+    C = COrig;
+    CRef = COrig;
+    Gemm( orientA, orientB, alpha, A, B, beta, C, GEMM_OZAKI );
+    Gemm( orientA, orientB, alpha, A, B, beta, CRef );
+    if( print )
+    {
+        Print( C, "C from the Ozaki engine" );
+        Print( CRef, "C from the standard engine" );
+    }
+
+    auto absFunc = function<Real(Real)>( []( Real x ) { return Abs(x); } );
+    Matrix<Real> AAbs( A ), BAbs( B ), bound( COrig );
+    EntrywiseMap( AAbs, absFunc );
+    EntrywiseMap( BAbs, absFunc );
+    EntrywiseMap( bound, absFunc );
+    Gemm( orientA, orientB, Abs(alpha), AAbs, BAbs, Abs(beta), bound );
+
+    const Real eps = limits::Epsilon<Real>();
+    Real maxRelError = 0;
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            maxRelError =
+              Max( maxRelError, Abs(C.Get(i,j)-CRef.Get(i,j))/bound.Get(i,j) );
+    OutputFromRoot
+    (mpi::COMM_WORLD,"max_{i,j} |E(i,j)| / (|alpha| |op(A)| |op(B)| + "
+     "|beta| |C|)(i,j) = ",maxRelError);
+    if( maxRelError > Real(4*k+16)*eps )
+        LogicError("The Ozaki engine was inaccurate");
+    PopIndent();
+}
+
 template<typename T> 
 void TestGemm
 ( Orientation orientA,
@@ -141,6 +207,95 @@ void TestGemm
     if( correctness )
         TestAssociativity( orientA, orientB, alpha, A, B, beta, COrig, C, print );
     PopIndent();
+
+    // Test the variant of Gemm that keeps C stationary and overlaps the
+    // panel broadcasts with the local updates
+    C = COrig;
+    OutputFromRoot(g.Comm(),"Pipelined stationary C Algorithm:");
+    PushIndent();
+    mpi::Barrier( g.Comm() );
+    timer.Start();
+    Gemm( orientA, orientB, alpha, A, B, beta, C, GEMM_SUMMA_C_PIPELINED );
+    mpi::Barrier( g.Comm() );
+    runTime = timer.Stop();
+    realGFlops = 2.*double(m)*double(n)*double(k)/(1.e9*runTime);
+    gFlops = ( IsComplex<T>::value ? 4*realGFlops : realGFlops );
+    OutputFromRoot
+    (g.Comm(),"Finished in ",runTime," seconds (",gFlops," GFlop/s)");
+    if( print )
+        Print( C, BuildString("C := ",alpha," A B + ",beta," C") );
+    if( correctness )
+        TestAssociativity( orientA, orientB, alpha, A, B, beta, COrig, C, print );
+    PopIndent();
+
+    // Test Cannon's algorithm (which requires a square grid)
+    if( g.Height() == g.Width() )
+    {
+        C = COrig;
+        OutputFromRoot(g.Comm(),"Cannon's Algorithm:");
+        PushIndent();
+        mpi::Barrier( g.Comm() );
+        timer.Start();
+        Gemm( orientA, orientB, alpha, A, B, beta, C, GEMM_CANNON );
+        mpi::Barrier( g.Comm() );
+        runTime = timer.Stop();
+        realGFlops = 2.*double(m)*double(n)*double(k)/(1.e9*runTime);
+        gFlops = ( IsComplex<T>::value ? 4*realGFlops : realGFlops );
+        OutputFromRoot
+        (g.Comm(),"Finished in ",runTime," seconds (",gFlops," GFlop/s)");
+        if( print )
+            Print( C, BuildString("C := ",alpha," A B + ",beta," C") );
+        if( correctness )
+            TestAssociativity
+            ( orientA, orientB, alpha, A, B, beta, COrig, C, print );
+        PopIndent();
+    }
+
+    // Test the 2.5D variant of Gemm, which multiplies slices of the summation
+    // dimension on layers of the process grid
+    C = COrig;
+    OutputFromRoot(g.Comm(),"2.5D Algorithm (depth ",Gemm25DDepth(),"):");
+    PushIndent();
+    mpi::Barrier( g.Comm() );
+    timer.Start();
+    Gemm( orientA, orientB, alpha, A, B, beta, C, GEMM_25D );
+    mpi::Barrier( g.Comm() );
+    runTime = timer.Stop();
+    realGFlops = 2.*double(m)*double(n)*double(k)/(1.e9*runTime);
+    gFlops = ( IsComplex<T>::value ? 4*realGFlops : realGFlops );
+    OutputFromRoot
+    (g.Comm(),"Finished in ",runTime," seconds (",gFlops," GFlop/s)");
+    if( print )
+        Print( C, BuildString("C := ",alpha," A B + ",beta," C") );
+    if( correctness )
+        TestAssociativity( orientA, orientB, alpha, A, B, beta, COrig, C, print );
+    PopIndent();
+
+    // Test the default variant of Gemm with the Ozaki engine for the local
+    // products (the engine only applies to the real types of precision beyond
+    // double; see TestOzaki for a direct test of its accuracy)
+    if( IsReal<T>::value && !IsBlasScalar<T>::value )
+    {
+        C = COrig;
+        OutputFromRoot(g.Comm(),"Ozaki engine:");
+        PushIndent();
+        mpi::Barrier( g.Comm() );
+        timer.Start();
+        Gemm
+        ( orientA, orientB, alpha, A, B, beta, C, GEMM_DEFAULT, GEMM_OZAKI );
+        mpi::Barrier( g.Comm() );
+        runTime = timer.Stop();
+        realGFlops = 2.*double(m)*double(n)*double(k)/(1.e9*runTime);
+        gFlops = realGFlops;
+        OutputFromRoot
+        (g.Comm(),"Finished in ",runTime," seconds (",gFlops," GFlop/s)");
+        if( print )
+            Print( C, BuildString("C := ",alpha," A B + ",beta," C") );
+        if( correctness )
+            TestAssociativity
+            ( orientA, orientB, alpha, A, B, beta, COrig, C, print );
+        PopIndent();
+    }
     
     if( orientA == NORMAL && orientB == NORMAL )
     {
@@ -183,6 +338,9 @@ main( int argc, char* argv[] )
         const Int n = Input("--n","width of result",100);
         const Int k = Input("--k","inner dimension",100);
         const Int nb = Input("--nb","algorithmic blocksize",96);
+        const Int depth = Input("--depth","2.5D replication depth (0=auto)",0);
+        const bool model =
+          Input("--model","choose the default algorithm from a model?",false);
         const bool print = Input("--print","print matrices?",false);
         const bool correctness = Input("--correctness","correctness?",true);
         const Int colAlignA = Input("--colAlignA","column align of A",0);
@@ -201,6 +359,9 @@ main( int argc, char* argv[] )
         const Orientation orientA = CharToOrientation( transA );
         const Orientation orientB = CharToOrientation( transB );
         SetBlocksize( nb );
+        SetGemm25DDepth( depth );
+        if( model )
+            SetPerfModel( CalibratePerfModel( g ) );
 
         ComplainIfDebug();
         OutputFromRoot(comm,"Will test Gemm",transA,transB);
@@ -253,6 +414,8 @@ main( int argc, char* argv[] )
           colAlignA, rowAlignA,
           colAlignB, rowAlignB,
           colAlignC, rowAlignC );
+        TestOzaki<DoubleDouble>
+        ( orientA, orientB, m, n, k, DoubleDouble(3), DoubleDouble(4), print );
         TestGemm<QuadDouble>
         ( orientA, orientB,
           m, n, k,
@@ -262,6 +425,8 @@ main( int argc, char* argv[] )
           colAlignA, rowAlignA,
           colAlignB, rowAlignB,
           colAlignC, rowAlignC );
+        TestOzaki<QuadDouble>
+        ( orientA, orientB, m, n, k, QuadDouble(3), QuadDouble(4), print );
 
         TestGemm<Complex<DoubleDouble>>
         ( orientA, orientB,
@@ -293,6 +458,8 @@ main( int argc, char* argv[] )
           colAlignA, rowAlignA,
           colAlignB, rowAlignB,
           colAlignC, rowAlignC );
+        TestOzaki<Quad>
+        ( orientA, orientB, m, n, k, Quad(3), Quad(4), print );
         TestGemm<Complex<Quad>>
         ( orientA, orientB,
           m, n, k, 
@@ -314,6 +481,8 @@ main( int argc, char* argv[] )
           colAlignA, rowAlignA,
           colAlignB, rowAlignB,
           colAlignC, rowAlignC );
+        TestOzaki<BigFloat>
+        ( orientA, orientB, m, n, k, BigFloat(3), BigFloat(4), print );
         TestGemm<Complex<BigFloat>>
         ( orientA, orientB,
           m, n, k,
@@ -0,0 +1,138 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Compare the 2.5D Gemm with each replication depth which divides the number
+// of owning processes against SUMMA, both on a grid over all of the processes
+// and on a grid over half of them (which the others merely view). This test
+// requires at least two processes, as the depth is otherwise always one.
+
+template<typename T>
+void Check
+( const string& label, Orientation orientA, Orientation orientB,
+  const DistMatrix<T>& A, const DistMatrix<T>& B,
+  const DistMatrix<T>& C, const DistMatrix<T>& CRef )
+{
+    const Int k = ( orientA == NORMAL ? A.Width() : A.Height() );
+    const Base<T> eps = limits::Epsilon<Base<T>>();
+    DistMatrix<T> E( CRef );
+    E -= C;
+    const Base<T> errorNorm = FrobeniusNorm( E );
+    const Base<T> bound =
+      Base<T>(k)*eps*FrobeniusNorm(A)*FrobeniusNorm(B);
+    OutputFromRoot
+    (A.Grid().Comm(),label," (",OrientationToChar(orientA),
+     OrientationToChar(orientB),"): || C - C_SUMMA ||_F = ",errorNorm);
+    if( errorNorm > bound )
+        LogicError
+        (label," differed from SUMMA by ",errorNorm," > ",bound);
+}
+
+template<typename T>
+void TestGemm25D
+( Orientation orientA, Orientation orientB, Int m, Int n, Int k,
+  const Grid& g, const Grid& gHalf )
+{
+    DistMatrix<T> A(g), B(g), C(g), CRef(g);
+    if( orientA == NORMAL )
+        Uniform( A, m, k );
+    else
+        Uniform( A, k, m );
+    if( orientB == NORMAL )
+        Uniform( B, k, n );
+    else
+        Uniform( B, n, k );
+    Uniform( CRef, m, n );
+    C = CRef;
+    const T alpha = T(3), beta = T(-2);
+    Gemm( orientA, orientB, alpha, A, B, beta, CRef, GEMM_SUMMA_C );
+
+    // Each depth is run twice so that the cached layers are reused
+    const DistMatrix<T> COrig( C );
+    for( Int depth=2; depth<=g.Size(); ++depth )
+    {
+        if( g.Size() % depth != 0 )
+            continue;
+        SetGemm25DDepth( depth );
+        for( Int rep=0; rep<2; ++rep )
+        {
+            C = COrig;
+            Gemm( orientA, orientB, alpha, A, B, beta, C, GEMM_25D );
+            Check
+            ( BuildString("Depth ",depth), orientA, orientB, A, B, C, CRef );
+        }
+    }
+
+    // The processes outside of the half grid only take part in the
+    // redistributions
+    for( Int depth=2; depth<=gHalf.Size(); ++depth )
+    {
+        if( gHalf.Size() % depth != 0 )
+            continue;
+        SetGemm25DDepth( depth );
+        DistMatrix<T> AHalf(gHalf), BHalf(gHalf), CHalf(gHalf);
+        AHalf = A;
+        BHalf = B;
+        CHalf = COrig;
+        Gemm( orientA, orientB, alpha, AHalf, BHalf, beta, CHalf, GEMM_25D );
+        C = CHalf;
+        Check
+        ( BuildString("Depth ",depth," on half of the processes"),
+          orientA, orientB, A, B, C, CRef );
+    }
+    SetGemm25DDepth( 0 );
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commSize = mpi::Size( comm );
+
+    try
+    {
+        const Int m = Input("--m","height of result",50);
+        const Int n = Input("--n","width of result",40);
+        const Int k = Input("--k","inner dimension",60);
+        ProcessInput();
+        PrintInputReport();
+
+        if( commSize < 2 )
+        {
+            OutputFromRoot
+            (comm,"The 2.5D Gemm requires at least two processes");
+            return 0;
+        }
+
+        const Grid g( comm );
+        vector<int> halfRanks( commSize/2 );
+        for( int q=0; q<commSize/2; ++q )
+            halfRanks[q] = q;
+        mpi::Group group, halfGroup;
+        mpi::CommGroup( comm, group );
+        mpi::Incl( group, halfRanks.size(), halfRanks.data(), halfGroup );
+        const Grid gHalf
+        ( comm, halfGroup, Grid::FindFactor(commSize/2) );
+        mpi::Free( halfGroup );
+        mpi::Free( group );
+
+        for( const Orientation orientA : { NORMAL, TRANSPOSE } )
+            for( const Orientation orientB : { NORMAL, ADJOINT } )
+            {
+                TestGemm25D<float>( orientA, orientB, m, n, k, g, gHalf );
+                TestGemm25D<double>( orientA, orientB, m, n, k, g, gHalf );
+                TestGemm25D<Complex<double>>
+                ( orientA, orientB, m, n, k, g, gHalf );
+            }
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,175 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+#ifdef EL_HAVE_QD
+// Compare the vectorized DoubleDouble kernels against the generic templates
+// (which they fall back to for non-unit strides or without SIMD support)
+
+void CheckClose
+( const string& kernel, const DoubleDouble& value,
+  const DoubleDouble& reference, const DoubleDouble& scale, Int n )
+{
+    const DoubleDouble eps = limits::Epsilon<DoubleDouble>();
+    const DoubleDouble error = Abs(value-reference);
+    if( error > DoubleDouble(4*n+4)*eps*scale )
+        LogicError
+        (kernel," differed from the generic kernel by ",error,
+         " (relative to a scale of ",scale,")");
+}
+
+void TestLevel1( Int n )
+{
+    Matrix<DoubleDouble> x, y, yRef;
+    Uniform( x, n, 1 );
+    Uniform( y, n, 1 );
+    const DoubleDouble alpha = DoubleDouble(1)/3;
+
+    DoubleDouble scale = 0;
+    for( Int i=0; i<n; ++i )
+        scale += Abs(x.Get(i,0))*Abs(y.Get(i,0));
+
+    const DoubleDouble dot =
+      blas::Dot( n, x.LockedBuffer(), 1, y.LockedBuffer(), 1 );
+    const DoubleDouble dotRef =
+      blas::Dot<DoubleDouble>( n, x.LockedBuffer(), 1, y.LockedBuffer(), 1 );
+    CheckClose( "Dot", dot, dotRef, scale, n );
+    const DoubleDouble dotu =
+      blas::Dotu( n, x.LockedBuffer(), 1, y.LockedBuffer(), 1 );
+    CheckClose( "Dotu", dotu, dotRef, scale, n );
+
+    const DoubleDouble nrm2 = blas::Nrm2( n, x.LockedBuffer(), 1 );
+    const DoubleDouble nrm2Ref =
+      blas::Nrm2<DoubleDouble>( n, x.LockedBuffer(), 1 );
+    CheckClose( "Nrm2", nrm2, nrm2Ref, nrm2Ref, n );
+
+    yRef = y;
+    blas::Axpy( n, alpha, x.LockedBuffer(), 1, y.Buffer(), 1 );
+    blas::Axpy<DoubleDouble>
+    ( n, alpha, x.LockedBuffer(), 1, yRef.Buffer(), 1 );
+    for( Int i=0; i<n; ++i )
+        CheckClose
+        ( "Axpy", y.Get(i,0), yRef.Get(i,0),
+          Abs(alpha*x.Get(i,0))+Abs(yRef.Get(i,0)), 1 );
+}
+
+void TestGemv( char trans, Int m, Int n )
+{
+    const bool normal = ( trans == 'N' );
+    const Int xLength = ( normal ? n : m );
+    const Int yLength = ( normal ? m : n );
+    Matrix<DoubleDouble> A, x, y, yRef;
+    Uniform( A, m, n );
+    Uniform( x, xLength, 1 );
+    Uniform( y, yLength, 1 );
+    const DoubleDouble alpha = DoubleDouble(1)/3, beta = DoubleDouble(-1)/7;
+
+    // The scaling bound is the same for every entry since |A|,|x|,|y| <= 1
+    const DoubleDouble scale = DoubleDouble(xLength+1);
+
+    yRef = y;
+    blas::Gemv
+    ( trans, m, n, alpha, A.LockedBuffer(), A.LDim(), x.LockedBuffer(), 1,
+      beta, y.Buffer(), 1 );
+    blas::Gemv<DoubleDouble>
+    ( trans, m, n, alpha, A.LockedBuffer(), A.LDim(), x.LockedBuffer(), 1,
+      beta, yRef.Buffer(), 1 );
+    for( Int i=0; i<yLength; ++i )
+        CheckClose( "Gemv", y.Get(i,0), yRef.Get(i,0), scale, xLength );
+
+    // With beta=0, any NaN in y must be overwritten
+    const DoubleDouble nan =
+      DoubleDouble( std::numeric_limits<double>::quiet_NaN() );
+    Fill( y, nan );
+    Zeros( yRef, yLength, 1 );
+    blas::Gemv
+    ( trans, m, n, alpha, A.LockedBuffer(), A.LDim(), x.LockedBuffer(), 1,
+      DoubleDouble(0), y.Buffer(), 1 );
+    blas::Gemv<DoubleDouble>
+    ( trans, m, n, alpha, A.LockedBuffer(), A.LDim(), x.LockedBuffer(), 1,
+      DoubleDouble(0), yRef.Buffer(), 1 );
+    for( Int i=0; i<yLength; ++i )
+        CheckClose( "Gemv", y.Get(i,0), yRef.Get(i,0), scale, xLength );
+}
+
+void TestGemm( char transA, char transB, Int m, Int n, Int k )
+{
+    Matrix<DoubleDouble> A, B, C, CRef;
+    if( transA == 'N' )
+        Uniform( A, m, k );
+    else
+        Uniform( A, k, m );
+    if( transB == 'N' )
+        Uniform( B, k, n );
+    else
+        Uniform( B, n, k );
+    Uniform( C, m, n );
+    const DoubleDouble alpha = DoubleDouble(1)/3, beta = DoubleDouble(-1)/7;
+
+    // Compare the SIMD micro-kernel against the generic micro-kernel
+    CRef = C;
+    blas::Gemm
+    ( transA, transB, m, n, k,
+      alpha, A.LockedBuffer(), A.LDim(), B.LockedBuffer(), B.LDim(),
+      beta, C.Buffer(), C.LDim() );
+    const qd::SIMD simd = qd::GetSIMD();
+    qd::SetSIMD( qd::SIMD_NONE );
+    blas::Gemm
+    ( transA, transB, m, n, k,
+      alpha, A.LockedBuffer(), A.LDim(), B.LockedBuffer(), B.LDim(),
+      beta, CRef.Buffer(), CRef.LDim() );
+    qd::SetSIMD( simd );
+
+    const DoubleDouble scale = DoubleDouble(k+1);
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            CheckClose( "Gemm", C.Get(i,j), CRef.Get(i,j), scale, k );
+}
+#endif
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+#ifdef EL_HAVE_QD
+    try
+    {
+        ProcessInput();
+        PrintInputReport();
+
+        const qd::SIMD simd = qd::DetectedSIMD();
+        Output
+        ("Detected SIMD support: ",
+         simd==qd::SIMD_AVX512 ? "AVX-512" :
+         simd==qd::SIMD_AVX2 ? "AVX2" : "none (only the fallbacks are tested)");
+
+        // Lengths which are not multiples of the vector widths
+        for( const Int n : { 1, 3, 8, 13, 1001 } )
+            TestLevel1( n );
+        Output("Level 1: PASSED");
+
+        const Int sizes[][3] =
+          { {1,1,1}, {8,4,3}, {13,7,130}, {67,33,5}, {9,515,17} };
+        for( const char trans : { 'N', 'T' } )
+            for( const auto& size : sizes )
+                TestGemv( trans, size[0], size[1] );
+        Output("Gemv: PASSED");
+
+        for( const char transA : { 'N', 'T' } )
+            for( const char transB : { 'N', 'T' } )
+                for( const auto& size : sizes )
+                    TestGemm( transA, transB, size[0], size[1], size[2] );
+        Output("Gemm: PASSED");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+#endif
+
+    return 0;
+}
@@ -0,0 +1,129 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Compare the threaded local level-1 routines (with a grain size small enough
+// to split every loop) against their serial versions. The threaded sums are
+// accumulated in a different order, so they are only required to agree up to
+// rounding, but the entrywise routines and the routines over non-packed
+// datatypes (which are never threaded) must agree exactly.
+
+template<typename T>
+void CheckEqual
+( const string& routine, const T& value, const T& serial,
+  const Base<T>& scale, Int n )
+{
+    const Base<T> error = Abs(value-serial);
+    const Base<T> tol =
+      ( IsPacked<T>::value ? Base<T>(n+1)*limits::Epsilon<Base<T>>()*scale
+                           : Base<T>(0) );
+    if( error > tol )
+        LogicError
+        (routine," differed from the serial version by ",error,
+         " (relative to a scale of ",scale,")");
+}
+
+template<typename T>
+void CheckEqual( const string& routine, const Matrix<T>& A, const Matrix<T>& B )
+{
+    for( Int j=0; j<A.Width(); ++j )
+        for( Int i=0; i<A.Height(); ++i )
+            if( A.Get(i,j) != B.Get(i,j) )
+                LogicError
+                (routine," differed from the serial version at (",i,",",j,
+                 ")");
+}
+
+template<typename T>
+void TestReductions( Int m, Int n, Int grainSize )
+{
+    Output("Testing with ",TypeName<T>());
+    PushIndent();
+
+    Matrix<T> A, B, x, y;
+    Uniform( A, m, n );
+    Uniform( B, m, n );
+    Uniform( x, m*n, 1 );
+    Uniform( y, m*n, 1 );
+    // A view with a leading dimension larger than its height
+    auto AView = A( IR(0,m-1), ALL );
+    auto BView = B( IR(0,m-1), ALL );
+    const T alpha = T(1)/T(3);
+
+    Base<T> scale = 0;
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            scale += Abs(A.Get(i,j))*Abs(B.Get(i,j));
+    Base<T> vecScale = 0;
+    for( Int i=0; i<m*n; ++i )
+        vecScale += Abs(x.Get(i,0))*Abs(y.Get(i,0));
+
+    // The serial versions
+    SetParallelGrainSize( std::numeric_limits<Int>::max() );
+    const T dotu = Dotu( A, B );
+    const T dot = Dot( A, B );
+    const T hs = HilbertSchmidt( AView, BView );
+    const T vecDot = Dot( x, y );
+    const Base<T> nrm2 = Nrm2( x );
+    Matrix<T> AxpySerial( B ), vecAxpySerial( y ), mapSerial;
+    Axpy( alpha, A, AxpySerial );
+    Axpy( alpha, x, vecAxpySerial );
+    EntrywiseMap( A, mapSerial, function<T(T)>
+      ( []( T beta ) { return beta*beta+beta; } ) );
+
+    // The threaded versions
+    SetParallelGrainSize( grainSize );
+    CheckEqual( "Dotu", Dotu(A,B), dotu, scale, m*n );
+    CheckEqual( "Dot", Dot(A,B), dot, scale, m*n );
+    CheckEqual( "HilbertSchmidt", HilbertSchmidt(AView,BView), hs, scale, m*n );
+    CheckEqual( "Dot (vector)", Dot(x,y), vecDot, vecScale, m*n );
+    CheckEqual( "Nrm2", Nrm2(x), nrm2, nrm2, m*n );
+    Matrix<T> AxpyThreaded( B ), vecAxpyThreaded( y ), mapThreaded;
+    Axpy( alpha, A, AxpyThreaded );
+    Axpy( alpha, x, vecAxpyThreaded );
+    EntrywiseMap( A, mapThreaded, function<T(T)>
+      ( []( T beta ) { return beta*beta+beta; } ) );
+    CheckEqual( "Axpy", AxpyThreaded, AxpySerial );
+    CheckEqual( "Axpy (vector)", vecAxpyThreaded, vecAxpySerial );
+    CheckEqual( "EntrywiseMap", mapThreaded, mapSerial );
+
+    Output("PASSED");
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int m = Input("--m","height of matrices",300);
+        const Int n = Input("--n","width of matrices",70);
+        const Int grainSize = Input("--grainSize","threaded grain size",64);
+        ProcessInput();
+        PrintInputReport();
+
+        const Int defaultGrainSize = ParallelGrainSize();
+        TestReductions<float>( m, n, grainSize );
+        TestReductions<double>( m, n, grainSize );
+        TestReductions<Complex<double>>( m, n, grainSize );
+#ifdef EL_HAVE_QD
+        TestReductions<DoubleDouble>( m, n, grainSize );
+#endif
+#ifdef EL_HAVE_MPC
+        TestReductions<BigFloat>( m, n, grainSize );
+        TestReductions<Complex<BigFloat>>( m, n, grainSize );
+#endif
+        SetParallelGrainSize( defaultGrainSize );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -97,6 +97,8 @@ main( int argc, char* argv[] )
         const Int n = Input("--n","width of result",100);
         const Int nb = Input("--nb","algorithmic blocksize",96);
         const bool print = Input("--print","print matrices?",false);
+        const bool model =
+          Input("--model","choose the default algorithm from a model?",false);
         ProcessInput();
         PrintInputReport();
 
@@ -109,6 +111,8 @@ main( int argc, char* argv[] )
         const Orientation orientation = CharToOrientation( transChar );
         const UnitOrNonUnit diag = CharToUnitOrNonUnit( diagChar );
         SetBlocksize( nb );
+        if( model )
+            SetPerfModel( CalibratePerfModel( g ) );
 
         ComplainIfDebug();
         OutputFromRoot
@@ -0,0 +1,70 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+template<typename T>
+void TestAllocator( AllocatorType type, Int n, Int numResizes )
+{
+    Output("Testing with ",TypeName<T>());
+    PushIndent();
+
+    AllocatorCtrl ctrl = GetAllocatorCtrl();
+    ctrl.type = type;
+    SetAllocatorCtrl( ctrl );
+    ResetAllocatorStatistics();
+
+    Matrix<T> A;
+    for( Int k=0; k<numResizes; ++k )
+    {
+        // Mimic the growing and shrinking of panel temporaries
+        A.Empty();
+        A.Resize( n, 1 + k % 16 );
+        Fill( A, T(k) );
+        if( type != SYSTEM_ALLOCATOR &&
+            reinterpret_cast<std::uintptr_t>(A.Buffer()) % ctrl.alignment != 0 )
+            LogicError("Buffer was not ",ctrl.alignment,"-byte aligned");
+        if( A.Get(n-1,0) != T(k) )
+            LogicError("Buffer was corrupted");
+    }
+
+    const AllocatorStatistics stats = GetAllocatorStatistics();
+    if( type == POOLED_ALLOCATOR && stats.HitRate() < 0.5 )
+        LogicError("Pooled allocator hit rate was only ",stats.HitRate());
+    if( stats.highWaterMark < stats.liveBytes )
+        LogicError("High-water mark was below the live bytes");
+    PrintAllocatorStatistics();
+
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int n = Input("--n","height of matrices",1000);
+        const Int numResizes = Input("--numResizes","number of resizes",1000);
+        ProcessInput();
+        PrintInputReport();
+
+        const AllocatorType types[] =
+          { SYSTEM_ALLOCATOR, ALIGNED_ALLOCATOR, POOLED_ALLOCATOR };
+        for( const AllocatorType type : types )
+        {
+            TestAllocator<float>( type, n, numResizes );
+            TestAllocator<Complex<double>>( type, n, numResizes );
+        }
+        TrimAllocator();
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
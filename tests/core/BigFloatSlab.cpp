@@ -0,0 +1,102 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+#ifdef EL_HAVE_MPC
+void TestSlab( Int n, mpfr_prec_t prec )
+{
+    Output("Testing with ",prec," bits of precision");
+    PushIndent();
+    mpfr::SetPrecision( prec );
+    const size_t liveBytes = GetAllocatorStatistics().liveBytes;
+    {
+        Matrix<BigFloat> A;
+        A.Resize( n, n );
+        for( Int j=0; j<n; ++j )
+            for( Int i=0; i<n; ++i )
+                A.Set( i, j, BigFloat(i+j*n)/3 );
+        if( !A.CRef(0,0).SlabBacked() || A.CRef(0,0).Precision() != prec )
+            LogicError("Entries were not slab-backed at the given precision");
+        if( GetAllocatorStatistics().liveBytes <= liveBytes )
+            LogicError("The slab was not drawn from the allocator");
+
+        // Moves into and out of slab-backed entries must copy the values
+        BigFloat alpha( A.CRef(n-1,n-1) );
+        A.Ref(0,0) = std::move(alpha);
+        BigFloat beta( std::move(A.Ref(1,0)) );
+        if( A.CRef(0,0) != BigFloat(n*n-1)/3 || beta != BigFloat(1)/3 ||
+            A.CRef(1,0) != beta )
+            LogicError("A moved value was corrupted");
+
+        // Growing the matrix replaces the slab
+        Matrix<BigFloat> B( A );
+        A.Resize( 2*n, 2*n );
+        for( Int j=0; j<n; ++j )
+            for( Int i=0; i<n; ++i )
+                A.Set( i, j, B.Get(i,j) );
+        if( !A.CRef(0,0).SlabBacked() || A.CRef(n-1,n-1) != B.CRef(n-1,n-1) )
+            LogicError("Values were lost when replacing the slab");
+
+        // The precision of a slab-backed entry is fixed
+        bool threw = false;
+        try { A.Ref(0,0).SetPrecision( 2*prec ); }
+        catch( std::exception& ) { threw = true; }
+        if( !threw )
+            LogicError("Changed the precision of a slab-backed entry");
+
+        // ...even when deserializing a value of a different precision
+        mpfr::SetPrecision( 2*prec );
+        BigFloat gamma( 1 );
+        vector<byte> buf( gamma.SerializedSize() );
+        gamma.Serialize( buf.data() );
+        mpfr::SetPrecision( prec );
+        threw = false;
+        try { A.Ref(0,0).Deserialize( buf.data() ); }
+        catch( std::exception& ) { threw = true; }
+        if( !threw || A.CRef(0,0).Precision() != prec )
+            LogicError("Deserialized a different precision into a slab entry");
+
+        // Buffers remember how they were allocated
+        mpfr::SetSlabStorage( false );
+        Matrix<BigFloat> C( n, n );
+        if( C.CRef(0,0).SlabBacked() || !A.CRef(0,0).SlabBacked() )
+            LogicError("Toggling the slab storage affected existing buffers");
+        mpfr::SetSlabStorage( true );
+    }
+    if( GetAllocatorStatistics().liveBytes != liveBytes )
+        LogicError("The slabs were not released");
+    Output("PASSED");
+    PopIndent();
+}
+#endif
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+#ifdef EL_HAVE_MPC
+    try
+    {
+        const Int n = Input("--n","matrix size",20);
+        ProcessInput();
+        PrintInputReport();
+
+        if( mpfr::SlabStorage() )
+            LogicError("Slab storage should be disabled by default");
+        mpfr::SetSlabStorage( true );
+        TestSlab( n, 128 );
+        TestSlab( n, 512 );
+        mpfr::SetSlabStorage( false );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+#endif
+
+    return 0;
+}
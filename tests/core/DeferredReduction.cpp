@@ -0,0 +1,149 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Queue several inner products and norms of matrices whose entries have
+// wildly different magnitudes (including entries whose squares overflow or
+// underflow) into a single deferred reduction and compare the results with
+// those of the eager routines
+
+template<typename F>
+void CheckResult
+( const string& label, const F& queued, const F& eager,
+  const Base<F>& scale, Int n, mpi::Comm comm )
+{
+    typedef Base<F> Real;
+    const Real eps = limits::Epsilon<Real>();
+    const Real error = Abs(queued-eager);
+    // Written so that NaN or infinite results also fail
+    if( !(error <= Real(n+10)*eps*scale) )
+        LogicError
+        (label,": the queued result ",queued," differed from the eager result ",
+         eager," by ",error);
+    OutputFromRoot(comm,label,": PASSED");
+}
+
+// Scale the rows of A by 'big', one, and 'small' in turn
+template<typename F>
+void MixMagnitudes( DistMatrix<F>& A, const Base<F>& big, const Base<F>& small )
+{
+    for( Int jLoc=0; jLoc<A.LocalWidth(); ++jLoc )
+    {
+        for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+        {
+            const Int i = A.GlobalRow(iLoc);
+            const Base<F> scale =
+              ( i % 3 == 0 ? big : (i % 3 == 1 ? Base<F>(1) : small) );
+            A.SetLocal( iLoc, jLoc, scale*A.GetLocal(iLoc,jLoc) );
+        }
+    }
+}
+
+template<typename F>
+void TestDeferredReduction( Int m, Int n, const Grid& g )
+{
+    typedef Base<F> Real;
+    mpi::Comm comm = g.Comm();
+    OutputFromRoot(comm,"Testing with ",TypeName<F>());
+    PushIndent();
+
+    // The sums of the squares of entries of magnitude 'big' overflow and the
+    // squares of entries of magnitude 'small' underflow
+    const Real big = 4*Sqrt(limits::Max<Real>())/Sqrt(Real(m*n));
+    const Real small = Sqrt(limits::Min<Real>())/4;
+
+    DistMatrix<F> A(g), B(g), ABig(g), ASmall(g), AMixed(g);
+    Uniform( A, m, n );
+    Uniform( B, m, n );
+    Uniform( ABig, m, n );
+    Uniform( ASmall, m, n );
+    Uniform( AMixed, m, n );
+    ABig *= big;
+    ASmall *= small;
+    MixMagnitudes( AMixed, big, small );
+    // Inner products of entries of moderately different magnitudes
+    MixMagnitudes( A, Real(1024), Real(1)/Real(1024) );
+
+    DistMatrix<F,VC,STAR> x(g), y(g);
+    Uniform( x, m, 1 );
+    Uniform( y, m, 1 );
+    DistMatrix<F,STAR,STAR> xMixed(g);
+    Uniform( xMixed, m, 1 );
+    for( Int i=0; i<m; ++i )
+    {
+        const Real scale =
+          ( i % 3 == 0 ? big : (i % 3 == 1 ? Real(1) : small) );
+        xMixed.SetLocal( i, 0, scale*xMixed.GetLocal(i,0) );
+    }
+
+    DeferredReduction<Real> reduction( comm );
+    const Int dotSlot = QueueDot( A, B, reduction );
+    const Int vecDotSlot = QueueDot( x, y, reduction );
+    const Int nrm2Slot = QueueNrm2( xMixed, reduction );
+    const Int bigSlot = QueueFrobeniusNorm( ABig, reduction );
+    const Int smallSlot = QueueFrobeniusNorm( ASmall, reduction );
+    const Int mixedSlot = QueueFrobeniusNorm( AMixed, reduction );
+    const Int maxSlot = QueueMaxNorm( AMixed, reduction );
+    reduction.Flush();
+
+    const Real dotScale = FrobeniusNorm( A )*FrobeniusNorm( B );
+    CheckResult
+    ( "Dot", reduction.template Sum<F>(dotSlot), Dot(A,B), dotScale, m*n,
+      comm );
+    const Real vecDotScale = FrobeniusNorm( x )*FrobeniusNorm( y );
+    CheckResult
+    ( "Dot (vector)", reduction.template Sum<F>(vecDotSlot), Dot(x,y),
+      vecDotScale, m, comm );
+    const Real nrm2 = Nrm2( xMixed );
+    CheckResult( "Nrm2", reduction.Norm(nrm2Slot), nrm2, nrm2, m, comm );
+    const Real bigNorm = FrobeniusNorm( ABig );
+    CheckResult
+    ( "FrobeniusNorm (overflow)", reduction.Norm(bigSlot), bigNorm, bigNorm,
+      m*n, comm );
+    const Real smallNorm = FrobeniusNorm( ASmall );
+    CheckResult
+    ( "FrobeniusNorm (underflow)", reduction.Norm(smallSlot), smallNorm,
+      smallNorm, m*n, comm );
+    const Real mixedNorm = FrobeniusNorm( AMixed );
+    CheckResult
+    ( "FrobeniusNorm (mixed)", reduction.Norm(mixedSlot), mixedNorm,
+      mixedNorm, m*n, comm );
+    const Real maxNorm = MaxNorm( AMixed );
+    CheckResult
+    ( "MaxNorm", reduction.Max(maxSlot), maxNorm, maxNorm, 0, comm );
+
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of matrices",100);
+        const Int n = Input("--n","width of matrices",50);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        TestDeferredReduction<float>( m, n, g );
+        TestDeferredReduction<Complex<float>>( m, n, g );
+        TestDeferredReduction<double>( m, n, g );
+        TestDeferredReduction<Complex<double>>( m, n, g );
+#ifdef EL_HAVE_QD
+        TestDeferredReduction<DoubleDouble>( m, n, g );
+#endif
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
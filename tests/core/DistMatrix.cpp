@@ -50,6 +50,37 @@ Check( DistMatrix<T,AColDist,ARowDist>& A,
             break;
     }
 
+    // Redistribute again (twice) with a reusable plan
+    DistMatrix<T,AColDist,ARowDist> APlan(g);
+    APlan.Align( colAlign, rowAlign );
+    RedistPlan plan( B, APlan );
+    Execute( plan, B, APlan );
+    Zero( APlan );
+    Execute( plan, B, APlan );
+    // Redistributions from [STAR,STAR] never communicate, and those from
+    // [MC,MR] to [STAR,STAR] are a single AllGather
+    if( BColDist == STAR && BRowDist == STAR && plan.kernel != REDIST_LOCAL )
+        myErrorFlag = 1;
+    if( BColDist == MC && BRowDist == MR &&
+        AColDist == STAR && ARowDist == STAR &&
+        g.Size() > 1 && plan.kernel != REDIST_ALLGATHER )
+        myErrorFlag = 1;
+
+    // Redistribute again asynchronously
+    DistMatrix<T,AColDist,ARowDist> AAsync(g);
+    AAsync.Align( colAlign, rowAlign );
+    auto request = CopyAsync( B, AAsync );
+    request.Wait();
+
+    if( APlan.ColAlign() != A.ColAlign() || APlan.RowAlign() != A.RowAlign() ||
+        AAsync.ColAlign() != A.ColAlign() || AAsync.RowAlign() != A.RowAlign() )
+        myErrorFlag = 1;
+    for( Int jLoc=0; jLoc<A.LocalWidth(); ++jLoc )
+        for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+            if( APlan.GetLocal(iLoc,jLoc) != A.GetLocal(iLoc,jLoc) ||
+                AAsync.GetLocal(iLoc,jLoc) != A.GetLocal(iLoc,jLoc) )
+                myErrorFlag = 1;
+
     Int summedErrorFlag;
     mpi::AllReduce( &myErrorFlag, &summedErrorFlag, 1, mpi::SUM, g.Comm() );
 
@@ -157,6 +188,79 @@ void CheckAll( Int m, Int n, const Grid& g, bool print )
     }
 }
 
+// Gather the diagonal distributions into [STAR,STAR] asynchronously and check
+// each entry on every process (including those off of the diagonal, which
+// only receive the entries through the cross communicator)
+template<typename T,Dist U,Dist V>
+void CheckAsyncGather( Int m, Int n, const Grid& g )
+{
+    OutputFromRoot
+    (g.Comm(),
+     "Testing asynchronous [STAR,STAR] <- [",DistToString(U),",",
+     DistToString(V),"]");
+    DistMatrix<T,U,V> A(g);
+    A.Resize( m, n );
+    for( Int jLoc=0; jLoc<A.LocalWidth(); ++jLoc )
+        for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+            A.SetLocal
+            ( iLoc, jLoc, T(A.GlobalRow(iLoc)+A.GlobalCol(jLoc)*m) );
+
+    DistMatrix<T,STAR,STAR> A_STAR_STAR(g);
+    auto request = CopyAsync( A, A_STAR_STAR );
+    request.Wait();
+    Int myErrorFlag = 0;
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            if( A_STAR_STAR.GetLocal(i,j) != T(i+j*m) )
+                myErrorFlag = 1;
+    if( mpi::AllReduce( myErrorFlag, mpi::MAX, g.Comm() ) != 0 )
+        LogicError("Asynchronous redistribution test failed");
+    OutputFromRoot(g.Comm(),"PASSED");
+}
+
+// Check that writing into a node-shared [STAR,STAR] replica on one process
+// does not affect the copies held by the other processes of its node, and
+// that gathering into it again reuses its window
+template<typename T>
+void CheckSharedWrites( Int m, Int n, const Grid& g )
+{
+    if( !SharedReplication() || m == 0 || n == 0 )
+        return;
+    OutputFromRoot(g.Comm(),"Testing writes into node-shared replicas");
+    DistMatrix<T,MC,MR> A(g);
+    A.Resize( m, n );
+    for( Int jLoc=0; jLoc<A.LocalWidth(); ++jLoc )
+        for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+            A.SetLocal
+            ( iLoc, jLoc, T(A.GlobalRow(iLoc)+A.GlobalCol(jLoc)*m) );
+
+    DistMatrix<T,STAR,STAR> A_STAR_STAR(g);
+    A_STAR_STAR = A;
+    const bool shared = A_STAR_STAR.NodeShared();
+    const void* base =
+      ( shared ? A_STAR_STAR.SharedWindow()->base : nullptr );
+    A_STAR_STAR.Matrix().Set( 0, 0, T(-1-g.VCRank()) );
+    mpi::Barrier( g.Comm() );
+    Int myErrorFlag = 0;
+    if( A_STAR_STAR.NodeShared() ||
+        A_STAR_STAR.GetLocal(0,0) != T(-1-g.VCRank()) )
+        myErrorFlag = 1;
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            if( (i != 0 || j != 0) && A_STAR_STAR.GetLocal(i,j) != T(i+j*m) )
+                myErrorFlag = 1;
+
+    A_STAR_STAR = A;
+    if( shared && (!A_STAR_STAR.NodeShared() ||
+                   A_STAR_STAR.SharedWindow()->base != base) )
+        myErrorFlag = 1;
+    if( A_STAR_STAR.GetLocal(0,0) != T(0) )
+        myErrorFlag = 1;
+    if( mpi::AllReduce( myErrorFlag, mpi::MAX, g.Comm() ) != 0 )
+        LogicError("Node-shared replica test failed");
+    OutputFromRoot(g.Comm(),"PASSED");
+}
+
 template<typename T>
 void
 DistMatrixTest( Int m, Int n, const Grid& g, bool print )
@@ -177,6 +281,9 @@ DistMatrixTest( Int m, Int n, const Grid& g, bool print )
     CheckAll<T,STAR,VR  >( m, n, g, print );
     CheckAll<T,VC,  STAR>( m, n, g, print );
     CheckAll<T,VR,  STAR>( m, n, g, print );
+    CheckAsyncGather<T,MD,STAR>( m, n, g );
+    CheckAsyncGather<T,STAR,MD>( m, n, g );
+    CheckSharedWrites<T>( m, n, g );
 }
 
 int 
@@ -189,16 +296,25 @@ main( int argc, char* argv[] )
     {
         int gridHeight = Input("--gridHeight","height of process grid",0);
         const bool colMajor = Input("--colMajor","column-major ordering?",true);
+        const bool nodeAware =
+          Input("--nodeAware","place processes by node?",false);
         const Int m = Input("--height","height of matrix",50);
         const Int n = Input("--width","width of matrix",50);
         const bool print = Input("--print","print wrong matrices?",false);
+        const Int redistMemory =
+          Input("--redistMemory","redistribution memory limit (bytes)",0);
+        const bool sharedReplication =
+          Input("--sharedReplication","node-shared replicas?",false);
         ProcessInput();
         PrintInputReport();
 
-        if( gridHeight == 0 )
-            gridHeight = Grid::FindFactor( mpi::Size(comm) );
+        SetRedistMemoryLimit( redistMemory );
+        SetSharedReplication( sharedReplication );
+
         const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
-        const Grid g( comm, gridHeight, order );
+        const GridPlacement placement =
+          ( nodeAware ? NODE_AWARE : RANK_ORDERED );
+        const Grid g( comm, gridHeight, placement, order );
 
         DistMatrixTest<Int>( m, n, g, print );
 
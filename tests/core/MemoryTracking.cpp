@@ -0,0 +1,122 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Allocate and free buffers of known sizes within nested profile regions
+// while memory tracking is enabled and check the live bytes, the high-water
+// mark and its region, and the written summary. A buffer allocated before
+// tracking was enabled must be ignored when it is freed.
+
+void CheckLive( size_t expected, const string& when )
+{
+    if( TrackedLiveBytes() != expected )
+        LogicError
+        (TrackedLiveBytes()," bytes were live ",when," rather than ",
+         expected);
+}
+
+void TestMemoryTracking( mpi::Comm comm )
+{
+    const bool tracking = MemoryTracking();
+    SetMemoryTracking( false );
+    Memory<double> untracked( 1000 );
+
+    SetMemoryTracking( true );
+    ClearMemoryTracking();
+    const size_t live = TrackedLiveBytes();
+    const size_t outerBytes = 2000*sizeof(double);
+    const size_t peakBytes = 500*sizeof(Complex<double>);
+    {
+        ProfileRegion outer("Outer");
+        Memory<double> A( 2000 );
+        CheckLive( live+outerBytes, "after allocating in Outer" );
+
+        // Freeing the untracked buffer (while a tracked one is live) must
+        // not change the live bytes
+        untracked.Empty();
+        CheckLive( live+outerBytes, "after freeing the untracked buffer" );
+        {
+            ProfileRegion peak("Peak");
+            Memory<Complex<double>> B( 500 );
+            CheckLive( live+outerBytes+peakBytes, "in Outer/Peak" );
+        }
+        CheckLive( live+outerBytes, "after leaving Outer/Peak" );
+
+        // A smaller allocation in another region does not move the mark
+        ProfileRegion other("Other");
+        Memory<float> C( 10 );
+        CheckLive
+        ( live+outerBytes+10*sizeof(float), "after allocating in Other" );
+    }
+    CheckLive( live, "after leaving Outer" );
+    SetMemoryTracking( false );
+
+    if( TrackedHighWaterMark() != live+outerBytes+peakBytes )
+        LogicError
+        ("The high-water mark was ",TrackedHighWaterMark()," rather than ",
+         live+outerBytes+peakBytes);
+    if( TrackedHighWaterRegion() != "Outer/Peak" )
+        LogicError
+        ("The high-water mark was reached in ",TrackedHighWaterRegion(),
+         " rather than Outer/Peak");
+
+    // Each process allocated once in Outer/Peak
+    std::ostringstream os;
+    WriteMemoryTracking( os, comm );
+    if( mpi::Rank(comm) == 0 )
+    {
+        const string summary = os.str();
+        if( summary.find("in region Outer/Peak") == string::npos )
+            LogicError("The summary did not name Outer/Peak:\n",summary);
+        std::istringstream stream( summary );
+        string line;
+        bool found = false;
+        while( std::getline( stream, line ) )
+        {
+            std::istringstream lineStream( line );
+            string name;
+            int numProcs;
+            size_t numAllocs, numBytes;
+            lineStream >> name >> numProcs >> numAllocs >> numBytes;
+            if( name != "Outer/Peak" )
+                continue;
+            found = true;
+            const int commSize = mpi::Size( comm );
+            if( numProcs != commSize || numAllocs != size_t(commSize) ||
+                numBytes != commSize*peakBytes )
+                LogicError("The summary of Outer/Peak was wrong:\n",line);
+        }
+        if( !found )
+            LogicError("The summary did not list Outer/Peak:\n",summary);
+    }
+    else if( !os.str().empty() )
+        LogicError("Only the root should write the summary");
+
+    ClearMemoryTracking();
+    SetMemoryTracking( tracking );
+    OutputFromRoot(comm,"PASSED");
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        ProcessInput();
+        PrintInputReport();
+
+        TestMemoryTracking( comm );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
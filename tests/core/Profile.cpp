@@ -0,0 +1,200 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Enter nested regions along paths which differ between the processes (the
+// even processes enter Outer/Even and the odd processes Outer/Odd/Deep, and
+// each process enters Outer/Inner a different number of times), then parse
+// the JSON profile and check the union of the paths, the call counts, and
+// that the exclusive times are the inclusive times minus those of the
+// children.
+
+void Spin( double seconds )
+{
+    const auto start = Clock::now();
+    while( duration_cast<duration<double>>(Clock::now()-start).count() <
+           seconds ) { }
+}
+
+struct RegionStats
+{
+    string path;
+    double processes;
+    // The minimum, average, and maximum of the calls and the inclusive and
+    // exclusive times
+    double stats[3][3];
+};
+
+double NumberAfter( const string& line, size_t& pos, const string& key )
+{
+    pos = line.find( key, pos );
+    if( pos == string::npos )
+        LogicError("Could not find ",key," in ",line);
+    pos += key.size();
+    return std::strtod( line.c_str()+pos, nullptr );
+}
+
+vector<RegionStats> ParseProfile( const string& profile, int commSize )
+{
+    std::istringstream stream( profile );
+    string line;
+    std::getline( stream, line );
+    if( line != "{" )
+        LogicError("The profile did not begin with an object");
+    std::getline( stream, line );
+    size_t pos = 0;
+    if( NumberAfter( line, pos, "\"numProcesses\": " ) != commSize )
+        LogicError("The profile reported the wrong number of processes");
+
+    vector<RegionStats> regions;
+    const string pathKey = "{\"path\": \"";
+    const char* statNames[3] = { "calls", "inclusive", "exclusive" };
+    while( std::getline( stream, line ) )
+    {
+        pos = line.find( pathKey );
+        if( pos == string::npos )
+            continue;
+        RegionStats region;
+        pos += pathKey.size();
+        region.path = line.substr( pos, line.find('"',pos)-pos );
+        region.processes = NumberAfter( line, pos, "\"processes\": " );
+        for( int s=0; s<3; ++s )
+        {
+            NumberAfter( line, pos, string("\"")+statNames[s]+"\": {" );
+            region.stats[s][0] = NumberAfter( line, pos, "\"min\": " );
+            region.stats[s][1] = NumberAfter( line, pos, "\"avg\": " );
+            region.stats[s][2] = NumberAfter( line, pos, "\"max\": " );
+            if( region.stats[s][0] > region.stats[s][1] ||
+                region.stats[s][1] > region.stats[s][2] )
+                LogicError
+                ("The ",statNames[s]," statistics of ",region.path,
+                 " were not ordered");
+        }
+        regions.push_back( region );
+    }
+    return regions;
+}
+
+void TestProfile( mpi::Comm comm )
+{
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+    ClearProfile();
+    for( Int rep=0; rep<2; ++rep )
+    {
+        ProfileRegion outer("Outer");
+        Spin( 1e-3 );
+        for( int i=0; i<commRank+1; ++i )
+        {
+            ProfileRegion inner("Inner");
+            Spin( 1e-4 );
+        }
+        if( commRank % 2 == 0 )
+        {
+            ProfileRegion even("Even");
+            Spin( 1e-4 );
+        }
+        else
+        {
+            ProfileRegion odd("Odd");
+            ProfileRegion deep("Deep");
+            if( ProfileRegionPath() != "Outer/Odd/Deep" )
+                LogicError("Unexpected region path ",ProfileRegionPath());
+            Spin( 1e-4 );
+        }
+    }
+
+    // Popping more regions than were pushed is an error rather than a
+    // corruption of the profile
+    bool threw = false;
+    try { PopProfileRegion(); }
+    catch( std::exception& ) { threw = true; }
+    if( !threw || ProfileRegionPath() != "" )
+        LogicError("Popping the root of the profile was not caught");
+
+    std::ostringstream os;
+    os.precision( 17 );
+    WriteProfile( os, PROFILE_JSON, comm );
+    if( commRank != 0 )
+    {
+        if( !os.str().empty() )
+            LogicError("Only the root should write the profile");
+        return;
+    }
+
+    // The paths are sorted so that each region precedes its children
+    vector<string> paths = { "Outer", "Outer/Even", "Outer/Inner" };
+    vector<double> processes = { double(commSize), double((commSize+1)/2),
+                                 double(commSize) };
+    vector<double> maxCalls = { 2, 2, double(2*commSize) };
+    if( commSize > 1 )
+    {
+        paths.push_back( "Outer/Odd" );
+        paths.push_back( "Outer/Odd/Deep" );
+        processes.push_back( commSize/2 );
+        processes.push_back( commSize/2 );
+        maxCalls.push_back( 2 );
+        maxCalls.push_back( 2 );
+    }
+    const vector<RegionStats> regions = ParseProfile( os.str(), commSize );
+    if( regions.size() != paths.size() )
+        LogicError
+        ("Expected ",paths.size()," regions but found ",regions.size());
+    for( Int k=0; k<Int(paths.size()); ++k )
+    {
+        const RegionStats& region = regions[k];
+        if( region.path != paths[k] )
+            LogicError("Expected region ",paths[k]," but found ",region.path);
+        if( region.processes != processes[k] )
+            LogicError
+            (region.path," was entered by ",region.processes,
+             " processes rather than ",processes[k]);
+        if( region.stats[0][0] != 2 || region.stats[0][2] != maxCalls[k] )
+            LogicError
+            (region.path," had between ",region.stats[0][0]," and ",
+             region.stats[0][2]," calls rather than 2 and ",maxCalls[k]);
+
+        // The total exclusive time of a region is its total inclusive time
+        // minus the total inclusive times of its children
+        double childTime = 0;
+        const string prefix = region.path + "/";
+        for( const auto& child : regions )
+            if( child.path.compare( 0, prefix.size(), prefix ) == 0 &&
+                child.path.find( '/', prefix.size() ) == string::npos )
+                childTime += child.processes*child.stats[1][1];
+        const double inclusive = region.processes*region.stats[1][1];
+        const double exclusive = region.processes*region.stats[2][1];
+        if( Abs(exclusive-(inclusive-childTime)) > 1e-9*inclusive )
+            LogicError
+            (region.path," had an exclusive time of ",exclusive,
+             " rather than ",inclusive-childTime);
+        if( inclusive <= 0 || exclusive < 0 )
+            LogicError(region.path," had invalid times");
+    }
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        ProcessInput();
+        PrintInputReport();
+
+        TestProfile( comm );
+        ClearProfile();
+        OutputFromRoot(comm,"PASSED");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,95 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// The counter-based random matrices must not depend upon the process grid,
+// even if the processes have generated different numbers of random matrices
+// beforehand (e.g., on a grid over a subset of the processes)
+
+template<typename T>
+void MakeRandom( bool gaussian, DistMatrix<T>& A, Int m, Int n )
+{
+    if( gaussian )
+        Gaussian( A, m, n );
+    else
+        Uniform( A, m, n );
+}
+
+template<typename T>
+void CheckIdentical
+( const string& label, const DistMatrix<T>& A, const DistMatrix<T>& B )
+{
+    DistMatrix<T,STAR,STAR> A_STAR_STAR( A ), B_STAR_STAR( B );
+    const Matrix<T>& ALoc = A_STAR_STAR.LockedMatrix();
+    const Matrix<T>& BLoc = B_STAR_STAR.LockedMatrix();
+    for( Int j=0; j<A.Width(); ++j )
+        for( Int i=0; i<A.Height(); ++i )
+            if( ALoc(i,j) != BLoc(i,j) )
+                LogicError
+                (label," differed at (",i,",",j,"): ",ALoc(i,j)," vs. ",
+                 BLoc(i,j));
+}
+
+template<typename T>
+void TestRandomStreams( bool gaussian, Int m, Int n, mpi::Comm comm )
+{
+    const string label = string(gaussian ? "Gaussian" : "Uniform") + " " +
+                         TypeName<T>();
+    const int commSize = mpi::Size( comm );
+    const Grid gRow( comm, 1 ), gCol( comm, commSize );
+
+    // Generate the first two random matrices on a 1 x p grid
+    const unsigned long long seed = RandomStreamSeed();
+    SetRandomStreamSeed( seed );
+    DistMatrix<T> A0(gRow), A1(gRow);
+    MakeRandom( gaussian, A0, m, n );
+    MakeRandom( gaussian, A1, m, n );
+
+    // Generate a random matrix on the first process alone before generating
+    // the second random matrix on a p x 1 grid
+    SetRandomStreamSeed( seed );
+    if( mpi::Rank(comm) == 0 )
+    {
+        const Grid gSelf( mpi::COMM_SELF );
+        DistMatrix<T> C(gSelf);
+        MakeRandom( gaussian, C, m, n );
+    }
+    DistMatrix<T> B1(gCol);
+    MakeRandom( gaussian, B1, m, n );
+    CheckIdentical( label, A1, B1 );
+
+    OutputFromRoot(comm,label,": PASSED");
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of matrices",100);
+        const Int n = Input("--n","width of matrices",50);
+        ProcessInput();
+        PrintInputReport();
+
+        if( !CounterBasedRandom() )
+            LogicError("Counter-based random matrices should be the default");
+        for( const bool gaussian : { false, true } )
+        {
+            TestRandomStreams<float>( gaussian, m, n, comm );
+            TestRandomStreams<double>( gaussian, m, n, comm );
+            TestRandomStreams<Complex<double>>( gaussian, m, n, comm );
+        }
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
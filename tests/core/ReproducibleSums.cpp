@@ -0,0 +1,152 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// With reproducible sums enabled, the inner products and norms of the same
+// matrices distributed over grids of different shapes (and computed either
+// eagerly or via a deferred reduction) must be bitwise identical
+
+// A deterministic function of the global indices whose magnitudes vary over
+// several dozen binary orders of magnitude
+template<typename F>
+F TestEntry( Int i, Int j, Int seed )
+{
+    typedef Base<F> Real;
+    const Int hash = (i*7919 + j*104729 + seed*15485863) % 2003;
+    const Real scale = Pow( Real(2), Real((i+2*j+seed) % 41 - 20) );
+    F alpha = scale*Real(hash-1001)/Real(1001);
+    if( IsComplex<F>::value )
+        SetImagPart( alpha, scale*Real((hash*31) % 2003 - 1001)/Real(1001) );
+    return alpha;
+}
+
+template<typename F,Dist U,Dist V>
+void Fill( DistMatrix<F,U,V>& A, Int m, Int n, Int seed )
+{
+    A.Resize( m, n );
+    for( Int jLoc=0; jLoc<A.LocalWidth(); ++jLoc )
+        for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+            A.SetLocal
+            ( iLoc, jLoc,
+              TestEntry<F>(A.GlobalRow(iLoc),A.GlobalCol(jLoc),seed) );
+}
+
+template<typename F>
+struct Results
+{
+    F dot, vecDot;
+    Base<F> frobNorm, nrm2;
+};
+
+template<typename F>
+void CheckIdentical
+( const string& label, const F& value, const F& reference )
+{
+    if( value != reference )
+        LogicError
+        (label,": ",value," was not identical to ",reference);
+}
+
+template<typename F>
+Results<F> Compute( Int m, Int n, const Grid& g )
+{
+    DistMatrix<F> A(g), B(g);
+    Fill( A, m, n, 0 );
+    Fill( B, m, n, 1 );
+    DistMatrix<F,VC,STAR> x(g), y(g);
+    Fill( x, m*n, 1, 2 );
+    Fill( y, m*n, 1, 3 );
+
+    Results<F> results;
+    results.dot = Dot( A, B );
+    results.vecDot = Dot( x, y );
+    results.frobNorm = FrobeniusNorm( A );
+    results.nrm2 = Nrm2( x );
+
+    // The deferred reductions must agree with the eager routines
+    DeferredReduction<Base<F>> reduction( g.Comm() );
+    const Int dotSlot = QueueDot( A, B, reduction );
+    const Int vecDotSlot = QueueDot( x, y, reduction );
+    const Int frobSlot = QueueFrobeniusNorm( A, reduction );
+    const Int nrm2Slot = QueueNrm2( x, reduction );
+    reduction.Flush();
+    CheckIdentical
+    ( "Queued Dot", reduction.template Sum<F>(dotSlot), results.dot );
+    CheckIdentical
+    ( "Queued Dot (vector)", reduction.template Sum<F>(vecDotSlot),
+      results.vecDot );
+    CheckIdentical
+    ( "Queued FrobeniusNorm", reduction.Norm(frobSlot), results.frobNorm );
+    CheckIdentical( "Queued Nrm2", reduction.Norm(nrm2Slot), results.nrm2 );
+
+    return results;
+}
+
+template<typename F>
+void TestReproducibleSums( Int m, Int n, mpi::Comm comm )
+{
+    OutputFromRoot(comm,"Testing with ",TypeName<F>());
+    PushIndent();
+
+    const int commSize = mpi::Size( comm );
+    const Grid gRow( comm, 1 ), gCol( comm, commSize ), g( comm );
+    const Results<F> reference = Compute<F>( m, n, gRow );
+    for( const Grid* grid : { &gCol, &g } )
+    {
+        const Results<F> results = Compute<F>( m, n, *grid );
+        CheckIdentical( "Dot", results.dot, reference.dot );
+        CheckIdentical( "Dot (vector)", results.vecDot, reference.vecDot );
+        CheckIdentical
+        ( "FrobeniusNorm", results.frobNorm, reference.frobNorm );
+        CheckIdentical( "Nrm2", results.nrm2, reference.nrm2 );
+    }
+
+    // Entries of very different magnitudes are binned separately, so the
+    // small entries are not lost relative to the large ones
+    const Base<F> big = Base<F>(1e30), small = Base<F>(1e-30);
+    vector<F> sums( 2 );
+    sums[0] = ( mpi::Rank(comm) == 0 ? big : F(0) );
+    sums[1] = small;
+    mpi::AllReduce( sums.data(), 2, comm );
+    const Base<F> eps = limits::Epsilon<Base<F>>();
+    if( sums[0] != big ||
+        Abs(sums[1]-Base<F>(commSize)*small) > 4*eps*Base<F>(commSize)*small )
+        LogicError
+        ("The binned sums {",sums[0],",",sums[1],"} should have been {",big,
+         ",",Base<F>(commSize)*small,"}");
+
+    OutputFromRoot(comm,"PASSED");
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of matrices",100);
+        const Int n = Input("--n","width of matrices",50);
+        ProcessInput();
+        PrintInputReport();
+
+        const bool reproducible = ReproducibleSums();
+        SetReproducibleSums( true );
+        TestReproducibleSums<float>( m, n, comm );
+        TestReproducibleSums<Complex<float>>( m, n, comm );
+        TestReproducibleSums<double>( m, n, comm );
+        TestReproducibleSums<Complex<double>>( m, n, comm );
+        SetReproducibleSums( reproducible );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,92 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Gather matrices of each distribution into the same node-shared [* ,* ]
+// matrix in sequence so that its window is successively shared over the
+// node-local portions of the process columns, the process rows, and the
+// entire grid. The shared all-gathers only run on more than one process.
+
+template<typename T,Dist U,Dist V>
+void Fill( DistMatrix<T,U,V>& A, Int m, Int n, Int offset )
+{
+    A.Resize( m, n );
+    for( Int jLoc=0; jLoc<A.LocalWidth(); ++jLoc )
+        for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+            A.SetLocal
+            ( iLoc, jLoc, T(A.GlobalRow(iLoc)+A.GlobalCol(jLoc)*m+offset) );
+}
+
+template<typename T,Dist U,Dist V>
+void GatherInto
+( DistMatrix<T,STAR,STAR>& B, Int m, Int n, Int offset, const Grid& g )
+{
+    OutputFromRoot
+    (g.Comm(),"[* ,* ] <- [",DistToString(U),",",DistToString(V),"]");
+    DistMatrix<T,U,V> A(g);
+    Fill( A, m, n, offset );
+    B = A;
+
+    Int myErrorFlag = 0;
+    if( B.Height() != m || B.Width() != n )
+        myErrorFlag = 1;
+    else
+        for( Int j=0; j<n; ++j )
+            for( Int i=0; i<m; ++i )
+                if( B.GetLocal(i,j) != T(i+j*m+offset) )
+                    myErrorFlag = 1;
+    if( mpi::AllReduce( myErrorFlag, mpi::MAX, g.Comm() ) != 0 )
+        LogicError
+        ("The replica gathered from [",DistToString(U),",",DistToString(V),
+         "] was corrupted");
+}
+
+template<typename T>
+void TestSharedReplicas( Int m, Int n, const Grid& g )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<T>());
+    PushIndent();
+    DistMatrix<T,STAR,STAR> B(g);
+    GatherInto<T,MC,  STAR>( B, m, n, 0, g );
+    GatherInto<T,STAR,MR  >( B, m, n, 1, g );
+    GatherInto<T,MC,  MR  >( B, m, n, 2, g );
+    GatherInto<T,MC,  STAR>( B, m, n, 3, g );
+    GatherInto<T,STAR,MR  >( B, m, n, 4, g );
+    GatherInto<T,VC,  STAR>( B, m, n, 5, g );
+    if( g.NodeSize() > 1 && !B.NodeShared() )
+        LogicError("The replica was not shared within the node");
+    OutputFromRoot(g.Comm(),"PASSED");
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--height","height of matrix",30);
+        const Int n = Input("--width","width of matrix",20);
+        ProcessInput();
+        PrintInputReport();
+
+        const bool sharedReplication = SharedReplication();
+        SetSharedReplication( true );
+        const Grid g( comm );
+        TestSharedReplicas<float>( m, n, g );
+        TestSharedReplicas<double>( m, n, g );
+        TestSharedReplicas<Complex<double>>( m, n, g );
+        SetSharedReplication( sharedReplication );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,168 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Account for a known AllGather and Broadcast over the VC communicator of a
+// grid and check the local and the written statistics, then check that
+// unnamed communicators which are freed do not lend their names to others
+
+const mpi::TrafficEntry* FindEntry
+( const vector<mpi::TrafficEntry>& summary,
+  const string& commName, const string& operation )
+{
+    for( const auto& entry : summary )
+        if( entry.commName == commName && entry.operation == operation )
+            return &entry;
+    return nullptr;
+}
+
+void CheckEntry
+( const vector<mpi::TrafficEntry>& summary,
+  const string& commName, const string& operation,
+  Int numCalls, long long bytesSent, long long bytesRecv )
+{
+    const mpi::TrafficEntry* entry = FindEntry( summary, commName, operation );
+    if( entry == nullptr )
+        LogicError("No ",operation," was recorded over ",commName);
+    const mpi::TrafficStats& stats = entry->stats;
+    if( stats.numCalls != numCalls || stats.bytesSent != bytesSent ||
+        stats.bytesRecv != bytesRecv )
+        LogicError
+        (operation," over ",commName," recorded ",stats.numCalls," calls, ",
+         stats.bytesSent," bytes sent, and ",stats.bytesRecv,
+         " bytes received rather than ",numCalls,", ",bytesSent,", and ",
+         bytesRecv);
+}
+
+// Return the line of the written statistics of the given communicator and
+// operation as {procs, calls, bytes sent, bytes received}
+vector<long long> WrittenEntry
+( const string& traffic, const string& commName, const string& operation )
+{
+    std::istringstream stream( traffic );
+    string line;
+    while( std::getline( stream, line ) )
+    {
+        std::istringstream lineStream( line );
+        string name, op;
+        lineStream >> name >> op;
+        if( name != commName || op != operation )
+            continue;
+        vector<long long> values( 4 );
+        for( auto& value : values )
+            lineStream >> value;
+        return values;
+    }
+    LogicError("No ",operation," over ",commName," was written");
+    return vector<long long>();
+}
+
+void TestTraffic( mpi::Comm comm )
+{
+    const Grid g( comm );
+    const int commSize = mpi::Size( comm );
+    const bool root = ( mpi::Rank(comm) == 0 );
+    const string vcName = "VC#" + std::to_string(g.Id());
+
+    const bool accounting = mpi::TrafficAccounting();
+    mpi::ClearTraffic();
+    mpi::SetTrafficAccounting( true );
+    const int sendSize = 3;
+    vector<double> sendBuf( sendSize, double(g.VCRank()) ),
+                   recvBuf( sendSize*commSize );
+    mpi::AllGather
+    ( sendBuf.data(), sendSize, recvBuf.data(), sendSize, g.VCComm() );
+    vector<double> bcastBuf( 5, 1. );
+    mpi::Broadcast( bcastBuf.data(), 5, 0, g.VCComm() );
+    mpi::SetTrafficAccounting( false );
+
+    const long long gatherBytes = sendSize*sizeof(double);
+    const long long bcastBytes = 5*sizeof(double);
+    const vector<mpi::TrafficEntry> summary = mpi::TrafficSummary();
+    CheckEntry
+    ( summary, vcName, "AllGather", 1, gatherBytes, commSize*gatherBytes );
+    // Broadcasts over a single process are skipped
+    if( commSize > 1 )
+        CheckEntry
+        ( summary, vcName, "Broadcast", 1, root ? bcastBytes : 0,
+          root ? 0 : bcastBytes );
+    else if( FindEntry( summary, vcName, "Broadcast" ) != nullptr )
+        LogicError("A broadcast over a single process was recorded");
+
+    // The written statistics are summed over the processes
+    std::ostringstream os;
+    mpi::WriteTraffic( os, comm );
+    if( root )
+    {
+        const vector<long long> gather =
+          WrittenEntry( os.str(), vcName, "AllGather" );
+        if( gather[0] != commSize || gather[1] != commSize ||
+            gather[2] != commSize*gatherBytes ||
+            gather[3] != commSize*commSize*gatherBytes )
+            LogicError("The written AllGather statistics were incorrect");
+        if( commSize > 1 )
+        {
+            const vector<long long> bcast =
+              WrittenEntry( os.str(), vcName, "Broadcast" );
+            if( bcast[0] != commSize || bcast[1] != commSize ||
+                bcast[2] != bcastBytes ||
+                bcast[3] != (commSize-1)*bcastBytes )
+                LogicError("The written Broadcast statistics were incorrect");
+        }
+    }
+    else if( !os.str().empty() )
+        LogicError("Only the root should write the statistics");
+
+    // Three unnamed communicators, the first of which is freed before the
+    // third is used, must have three distinct names
+    mpi::ClearTraffic();
+    mpi::SetTrafficAccounting( true );
+    mpi::Comm comm0, comm1, comm2;
+    mpi::Split( comm, 0, mpi::Rank(comm), comm0 );
+    mpi::Split( comm, 0, mpi::Rank(comm), comm1 );
+    mpi::Barrier( comm0 );
+    mpi::Barrier( comm1 );
+    mpi::Free( comm0 );
+    mpi::Split( comm, 0, mpi::Rank(comm), comm2 );
+    mpi::Barrier( comm2 );
+    mpi::SetTrafficAccounting( false );
+    Int numUnnamed = 0;
+    for( const auto& entry : mpi::TrafficSummary() )
+        if( entry.operation == "Barrier" &&
+            entry.commName.compare( 0, 8, "unnamed(" ) == 0 )
+            ++numUnnamed;
+    if( numUnnamed != 3 )
+        LogicError
+        ("Expected three distinct unnamed communicators but found ",
+         numUnnamed);
+    mpi::Free( comm1 );
+    mpi::Free( comm2 );
+
+    mpi::ClearTraffic();
+    mpi::SetTrafficAccounting( accounting );
+    OutputFromRoot(comm,"PASSED");
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        ProcessInput();
+        PrintInputReport();
+
+        TestTraffic( comm );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
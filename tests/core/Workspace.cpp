@@ -0,0 +1,129 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+// The bytes of a local buffer which can hold any alignment of an m x n matrix
+template<typename T,Dist U,Dist V>
+size_t ReservedBytes( Int m, Int n, const Grid& g )
+{
+    DistMatrix<T,U,V> A(g);
+    return MaxLength(m,A.ColStride())*MaxLength(n,A.RowStride())*sizeof(T);
+}
+
+template<typename T>
+void TestWorkspace( Int m, Int n, const Grid& g )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<T>());
+    PushIndent();
+
+    EnableWorkspaceCache();
+    SetWorkspaceCacheLimit( size_t(1) << 27 );
+    ReleaseWorkspaceCache();
+
+    // A returned buffer should be handed out again for the same distribution
+    const T* buffer;
+    bool haveLocalData;
+    {
+        WorkspaceDistMatrix<T,MC,STAR> A(g);
+        A.Resize( m, n );
+        Fill( A, T(1) );
+        buffer = A.LockedBuffer();
+        haveLocalData = ( A.LocalHeight()*A.LocalWidth() > 0 );
+    }
+    if( haveLocalData && WorkspaceCacheBytes() == 0 )
+        LogicError("The workspace was not returned to the cache");
+    {
+        WorkspaceDistMatrix<T,MC,STAR> A(g);
+        A.Resize( m, n );
+        if( haveLocalData && A.LockedBuffer() != buffer )
+            LogicError("The cached workspace was not reused");
+        if( WorkspaceCacheBytes() != 0 )
+            LogicError("The borrowed workspace was still counted as idle");
+    }
+    OutputFromRoot(g.Comm(),"Reuse: PASSED");
+
+    // A small temporary should borrow the smallest buffer which fits rather
+    // than the largest one
+    ReleaseWorkspaceCache();
+    ReserveWorkspace<T,MC,STAR>( g, 4*m, n );
+    ReserveWorkspace<T,MC,STAR>( g, m, n );
+    const size_t largeBytes = ReservedBytes<T,MC,STAR>( 4*m, n, g );
+    {
+        WorkspaceDistMatrix<T,MC,STAR> A(g);
+        A.Resize( m, n );
+        if( haveLocalData && WorkspaceCacheBytes() != largeBytes )
+            LogicError
+            ("The small temporary left ",WorkspaceCacheBytes(),
+             " idle bytes rather than the ",largeBytes," of the large buffer");
+    }
+    ReleaseWorkspaceCache();
+    OutputFromRoot(g.Comm(),"Best fit: PASSED");
+
+    // Buffers beyond the limit should be freed rather than cached
+    SetWorkspaceCacheLimit( 0 );
+    if( WorkspaceCacheBytes() != 0 )
+        LogicError("Lowering the limit did not trim the cache");
+    {
+        WorkspaceDistMatrix<T,MC,STAR> A(g);
+        A.Resize( m, n );
+    }
+    if( WorkspaceCacheBytes() != 0 )
+        LogicError("A buffer beyond the limit was cached");
+    SetWorkspaceCacheLimit( size_t(1) << 27 );
+    ReserveWorkspace<T,MR,STAR>( g, m, n, 2 );
+    const size_t entryBytes = ReservedBytes<T,MR,STAR>( m, n, g );
+    if( WorkspaceCacheBytes() != 2*entryBytes )
+        LogicError("Reserved ",2*entryBytes," bytes but ",
+                   WorkspaceCacheBytes()," are cached");
+    SetWorkspaceCacheLimit( entryBytes );
+    if( WorkspaceCacheBytes() != entryBytes )
+        LogicError
+        ("Trimming to one entry left ",WorkspaceCacheBytes()," bytes");
+    OutputFromRoot(g.Comm(),"Limit: PASSED");
+
+    // Disabling the cache should release it and bypass it from then on
+    DisableWorkspaceCache();
+    if( WorkspaceCacheBytes() != 0 )
+        LogicError("Disabling the cache did not release it");
+    {
+        WorkspaceDistMatrix<T,MC,STAR> A(g);
+        A.Resize( m, n );
+        Fill( A, T(2) );
+    }
+    if( WorkspaceCacheBytes() != 0 )
+        LogicError("A disabled cache retained a buffer");
+    OutputFromRoot(g.Comm(),"Disable: PASSED");
+
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of matrices",100);
+        const Int n = Input("--n","width of matrices",50);
+        ProcessInput();
+        PrintInputReport();
+
+        if( WorkspaceCacheEnabled() )
+            LogicError("The workspace cache should be disabled by default");
+
+        const Grid g( comm );
+        TestWorkspace<float>( m, n, g );
+        TestWorkspace<Complex<double>>( m, n, g );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
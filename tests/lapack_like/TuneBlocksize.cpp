@@ -0,0 +1,196 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Check the lookup of the nearest size bucket of the tuned blocksizes, the
+// round trip through a tuning file, the rejection of malformed tuning files,
+// the precedence of explicitly set local Symv and Trrk blocksizes over tuned
+// ones, and the entries recorded by short runs of TuneBlocksize
+
+void CheckLookup
+( const string& routine, const string& type,
+  int gridHeight, int gridWidth, Int n, Int expected )
+{
+    const Int nb =
+      LookupTunedBlocksize( routine, type, gridHeight, gridWidth, n );
+    if( nb != expected )
+        LogicError
+        ("The tuned blocksize of ",routine," for ",type," on a ",gridHeight,
+         " x ",gridWidth," grid with n=",n," was ",nb," rather than ",
+         expected);
+}
+
+// The buckets of n=100, 400, and 2000 are 6, 8, and 10 (the floor of the
+// logarithm base two), and ties go to the smaller bucket
+void CheckLUTable( const string& type )
+{
+    CheckLookup( "LU", type, 0, 0, 10, 32 );
+    CheckLookup( "LU", type, 0, 0, 100, 32 );
+    CheckLookup( "LU", type, 0, 0, 200, 32 );
+    CheckLookup( "LU", type, 0, 0, 300, 64 );
+    CheckLookup( "LU", type, 0, 0, 700, 64 );
+    CheckLookup( "LU", type, 0, 0, 1500, 128 );
+    CheckLookup( "LU", type, 0, 0, 100000, 128 );
+    CheckLookup( "LU", type, 2, 2, 100, 16 );
+    CheckLookup( "LU", type, 2, 1, 100, 0 );
+    CheckLookup( "Cholesky", type, 0, 0, 100, 0 );
+}
+
+void TestTable( mpi::Comm comm )
+{
+    OutputFromRoot(comm,"Testing the tuning table");
+    const string type = TypeName<double>();
+    const bool root = ( mpi::Rank(comm) == 0 );
+    ClearTunedBlocksizes();
+    SetTunedBlocksize( "LU", type, 0, 0, 100, 32 );
+    SetTunedBlocksize( "LU", type, 0, 0, 400, 64 );
+    SetTunedBlocksize( "LU", type, 0, 0, 2000, 128 );
+    SetTunedBlocksize( "LU", type, 2, 2, 1000, 16 );
+    CheckLUTable( type );
+    CheckLookup( "LU", TypeName<float>(), 0, 0, 100, 0 );
+    if( TunedBlocksize<double>("Cholesky",100) != Blocksize() )
+        LogicError("Untuned routines did not fall back to Blocksize()");
+
+    // Only the root writes the file, but every process loads it
+    const string filename = "TuneBlocksize.txt";
+    if( root )
+        SaveTunedBlocksizes( filename );
+    mpi::Barrier( comm );
+    ClearTunedBlocksizes();
+    CheckLookup( "LU", type, 0, 0, 100, 0 );
+    LoadTunedBlocksizes( filename );
+    CheckLUTable( type );
+
+    const vector<string> malformed =
+      { "LU double 0 0 6",
+        "LU double 0 0 6 0",
+        "LU double 0 0 6 -32",
+        "LU double zero 0 6 32" };
+    for( const auto& line : malformed )
+    {
+        if( root )
+        {
+            std::ofstream file( filename.c_str() );
+            file << "# A comment and an empty line are skipped\n\n"
+                 << "LU double 0 0 6 32\n" << line << "\n";
+        }
+        mpi::Barrier( comm );
+        bool threw = false;
+        try { LoadTunedBlocksizes( filename ); }
+        catch( std::exception& ) { threw = true; }
+        if( !threw )
+            LogicError("The tuning entry '",line,"' was accepted");
+        mpi::Barrier( comm );
+    }
+    if( root )
+        std::remove( filename.c_str() );
+    mpi::Barrier( comm );
+    bool threw = false;
+    try { LoadTunedBlocksizes( filename ); }
+    catch( std::exception& ) { threw = true; }
+    if( !threw )
+        LogicError("Loading a missing tuning file did not fail");
+    ClearTunedBlocksizes();
+}
+
+// The local blocksizes default to 64, are overridden by tuned values, and
+// those are overridden by explicitly set values (until they are reset to 0)
+void CheckLocal
+( const string& routine, std::function<void(Int)> set,
+  std::function<Int()> get )
+{
+    const string type = TypeName<double>();
+    ClearTunedBlocksizes();
+    if( get() != 64 )
+        LogicError("The default ",routine," blocksize was ",get());
+    SetTunedBlocksize( routine, type, 0, 0, 0, 24 );
+    if( get() != 24 )
+        LogicError("The tuned ",routine," blocksize was ignored");
+    set( 40 );
+    if( get() != 40 )
+        LogicError
+        ("The explicit ",routine," blocksize did not take precedence");
+    SetTunedBlocksize( routine, type, 0, 0, 0, 48 );
+    if( get() != 40 )
+        LogicError("Retuning overrode the explicit ",routine," blocksize");
+    set( 0 );
+    if( get() != 48 )
+        LogicError("Resetting the ",routine," blocksize ignored the tuning");
+    ClearTunedBlocksizes();
+    if( get() != 64 )
+        LogicError("Clearing the ",routine," tuning was ignored");
+}
+
+void TestLocal( mpi::Comm comm )
+{
+    OutputFromRoot(comm,"Testing the local blocksizes");
+    CheckLocal
+    ( "LocalSymv",
+      []( Int nb ) { SetLocalSymvBlocksize<double>( nb ); },
+      []() { return LocalSymvBlocksize<double>(); } );
+    CheckLocal
+    ( "LocalTrrk",
+      []( Int nb ) { SetLocalTrrkBlocksize<double>( nb ); },
+      []() { return LocalTrrkBlocksize<double>(); } );
+}
+
+void CheckTuned
+( const string& routine, int gridHeight, int gridWidth, Int n, Int nb )
+{
+    if( nb != 16 && nb != 32 )
+        LogicError("Tuning ",routine," chose ",nb," from {16,32}");
+    CheckLookup( routine, TypeName<double>(), gridHeight, gridWidth, n, nb );
+}
+
+void TestTune( mpi::Comm comm, Int n )
+{
+    OutputFromRoot(comm,"Testing TuneBlocksize");
+    const Grid g( comm );
+    const vector<Int> candidates = { 16, 32 };
+    ClearTunedBlocksizes();
+
+    Int nb = TuneBlocksize<double>( "Cholesky", n, candidates, 1 );
+    CheckTuned( "Cholesky", 0, 0, n, nb );
+    nb = TuneBlocksize<double>( "LU", g, n, candidates, 1 );
+    CheckTuned( "LU", g.Height(), g.Width(), n, nb );
+    // The local blocksizes are recorded independently of the grid and size
+    nb = TuneBlocksize<double>( "LocalTrrk", g, n, candidates, 1 );
+    CheckTuned( "LocalTrrk", 0, 0, 0, nb );
+    if( LocalTrrkBlocksize<double>() != nb )
+        LogicError("The tuned LocalTrrk blocksize was not used");
+
+    bool threw = false;
+    try { TuneBlocksize<double>( "Gemm", n, candidates, 1 ); }
+    catch( std::exception& ) { threw = true; }
+    if( !threw )
+        LogicError("Tuning an unsupported routine did not fail");
+    ClearTunedBlocksizes();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n = Input("--n","size of the tuning problems",100);
+        ProcessInput();
+        PrintInputReport();
+
+        TestTable( comm );
+        TestLocal( comm );
+        TestTune( comm, n );
+        OutputFromRoot(comm,"PASSED");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}